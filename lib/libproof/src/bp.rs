@@ -21,7 +21,12 @@ use std::io::{BufRead, BufReader};
 use std::io::Read;
 //use std::io::Write;
 use std::fs;
+use std::time::Instant;
+use std::io::Cursor;
+use std::path::Path;
+use std::cell::RefCell;
 use utils;
+use r1cs_bin;
 
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
@@ -152,82 +157,54 @@ pub fn load_inputs<CS: ConstraintSystem>(filename: String, cs: &mut CS, is_prove
 
 pub fn generate_constraints<CS: ConstraintSystem, R: Read>(
     cs: &mut CS,
-    reader: &mut BufReader<R>,
+    reader: &mut r1cs_bin::Reader<R>,
 	r1: &mut R1csInputs,
     is_prover: bool
 )
 {
-	let mut len = 1;
-	let mut line = String::new();
-	//Read the file line by line using the lines() iterator from std::io::BufRead.
-	while (len != 0)
+	let one = Scalar::one();
+	//Stream the constraints, the rows are read in place from the reader buffers
+	while let Some((a, b, c)) = reader.next_constraint().expect("Invalid r1cs file")
     {
-		line.clear();
-		len = reader.read_line(&mut line).unwrap();
-      
-		if (len > 0)
+		let A_lc = parseLinearComb(&a, r1, cs, is_prover);
+		let B_lc = parseLinearComb(&b, r1, cs, is_prover);
+		let c_idx: usize = if (c.len() > 0) { c.index(0) } else { 0 };
+		if (c.len() == 1 && c_idx > 0 && c.coeff(0) == one && !r1.var.contains_key(&c_idx)) //TODO A TESTER!!
 		{
-			// Convert the JSON string
-			let json: serde_json::Value =
-				serde_json::from_str(&line).expect("JSON was not well-formatted");
-			let aslc: serde_json::Value = json["A"].clone();	//TODO should not have to clone...
-			let a: Vec<serde_json::Value> = serde_json::from_value(aslc).unwrap();
-			let bslc: serde_json::Value = json["B"].clone();	//TODO should not have to clone...
-			let b: Vec<serde_json::Value> = serde_json::from_value(bslc).unwrap();
-			let cslc: serde_json::Value = json["C"].clone();	//TODO should not have to clone...
-			let c: Vec<serde_json::Value> = serde_json::from_value(cslc).unwrap();
-
-			let A_lc = parseLinearCombJson(a, r1, cs, is_prover);
-			let B_lc = parseLinearCombJson(b, r1, cs, is_prover);
-			let c_idx: usize =  serde_json::from_value(c[0][0].clone()).unwrap();
-			let c_str: String = serde_json::from_value(c[0][1].clone()).unwrap();
-			if (c.len() == 1 && c_idx > 0 &&  c[0][1] == "1" && !r1.var.contains_key(&c_idx)) //TODO A TESTER!!
-			{
-				let (_, _, var_c) =  cs.multiply(A_lc, B_lc);
-				r1.set_var(c_idx, var_c.into());
-			}
-			else
-			{
-				let C_lc = parseLinearCombJson(c, r1, cs, is_prover);
-				let (_, _, o) =  cs.multiply(A_lc, B_lc);
-				cs.constrain(o-C_lc);
-	
-			}
+			let (_, _, var_c) =  cs.multiply(A_lc, B_lc);
+			r1.set_var(c_idx, var_c.into());
+		}
+		else
+		{
+			let C_lc = parseLinearComb(&c, r1, cs, is_prover);
+			let (_, _, o) =  cs.multiply(A_lc, B_lc);
+			cs.constrain(o-C_lc);
 
 		}
- 
     }
 	
 }
 
 
 //Generate a proof
-//inputs: file name of the r1cs in json format. We need the full assignments as .in file
+//inputs: file name of the r1cs in json format (or binary, see r1cs_bin). We need the full assignments as .in file
 //proof_file: file name of the out file that will contain the proof in json format.
 pub fn Prove(inputs: String, proof_file: String)
 {
 	let inputfile = format!("{}{}",inputs,".in");
-    //1. Open the j1cs file in read-only mode (ignoring errors).
-    let file = File::open(inputs).unwrap();
-    let mut reader = BufReader::new(file);
-	let mut line = String::new();
-	let mut len = reader.read_line(&mut line).unwrap();
-	if (len == 0)
+    //1. Open the r1cs file, converting it to the binary format if needed
+	let load_start = Instant::now();
+	let mut reader = match r1cs_bin::open(&inputs)
 	{
-		println!("ERRROR, file is empty");
-		return;
-	}
+		Ok(r) => r,
+		Err(e) => { println!("ERRROR, cannot load {}: {}", inputs, e); return; }
+	};
 	//2. parse header
-	let json: serde_json::Value = serde_json::from_str(&line).expect("JSON was not well-formatted");
-	let header: serde_json::Value = json["r1cs"].clone();
-	let constraint_nb : u32 =	serde_json::from_value(header["constraint_nb"].clone()).unwrap();
-	let instance_nb : u32 =	serde_json::from_value(header["instance_nb"].clone()).unwrap();
-	let witness_nb : u32 =	serde_json::from_value(header["witness_nb"].clone()).unwrap();
+	let constraint_nb : u32 = reader.header.constraint_nb;
+	let witness_nb : u32 = reader.header.witness_nb;
 	let gen_nb = 1 << (utils::bits(constraint_nb+witness_nb));					//TODO count the nb of allocations
 	println!("generator length =  {:?}", gen_nb);
-	let prime_str: String = serde_json::from_value(header["field_characteristic"].clone()).unwrap();
-    let prime = utils::string_to_scalar(prime_str);
-	if (curve25519_dalek::constants::BASEPOINT_ORDER != prime)
+	if (curve25519_dalek::constants::BASEPOINT_ORDER != Scalar::from_bits(reader.header.field_characteristic))
 	{
 		println!("Invalid field characteristic");
 		println!("Please make sure constraints where generated with the correct scheme");
@@ -235,7 +212,6 @@ pub fn Prove(inputs: String, proof_file: String)
 	}
 	//3. Create some generators that will be used by both the prover and verifier
 	let pc_gens = PedersenGens::default();
-	let bp_gens = BulletproofGens::new(gen_nb, 1);
 		
 	//4. Instantiate a prover
 	let mut prover_transcript = Transcript::new(b"r1cs");
@@ -245,11 +221,14 @@ pub fn Prove(inputs: String, proof_file: String)
 	let mut r1 = load_inputs(inputfile, &mut prover, true);
 	println!("...loading input file");
 	
-    //6. Read the file line by line using the lines() iterator from std::io::BufRead.
+    //6. Stream the constraints into the prover
 	generate_constraints(&mut prover, &mut reader, &mut r1, true);
 	println!("constraints are generated - {:?} allocations", r1.dbg_allocations);
+	let load_time = load_start.elapsed();
     //7. Prover creates the proof
-	let proof = prover.prove(&bp_gens).unwrap();
+	let prove_start = Instant::now();
+	let proof = with_gens(gen_nb, |bp_gens| prover.prove(bp_gens)).unwrap();
+	println!("load time: {:?}, proving time: {:?}", load_time, prove_start.elapsed());
 
 	//8. Serialize into json
 	let mut jproof : JsonProof = JsonProof { proof: Vec::new(), name: "no comment".to_string(), scheme: "dalek-bulletproof".to_string()};//TODO constructor
@@ -261,62 +240,152 @@ pub fn Prove(inputs: String, proof_file: String)
 }
 
 
+//Load the r1cs and the inputs into a prover without proving, to measure the loading time separately
+//inputs: file name of the r1cs in json or binary format, with the full assignments as .in file
+pub fn Load(inputs: String) -> bool
+{
+	let inputfile = format!("{}{}",inputs,".in");
+	let start = Instant::now();
+	let mut reader = match r1cs_bin::open(&inputs)
+	{
+		Ok(r) => r,
+		Err(e) => { println!("ERRROR, cannot load {}: {}", inputs, e); return false; }
+	};
+	let pc_gens = PedersenGens::default();
+	let mut prover_transcript = Transcript::new(b"r1cs");
+	let mut prover = Prover::new(&pc_gens, &mut prover_transcript);
+	let mut r1 = load_inputs(inputfile, &mut prover, true);
+	generate_constraints(&mut prover, &mut reader, &mut r1, true);
+	println!("load time: {:?}", start.elapsed());
+	return true;
+}
+
+
 //Verify a proof, from a proof file (proof_file) and j1cs file (filename)
-//inputs: file name of the r1cs in json format. The public inputs must also be present as .in
+//inputs: file name of the r1cs in json format (or binary, see r1cs_bin). The public inputs must also be present as .in
 //proof_file: file name of the proof in json format.
 pub fn Verify(inputs: String, proof_file: String) -> bool
 {
 	let inputfile = format!("{}{}",inputs,".in");
-    //1. Open the j1cs file in read-only mode (ignoring errors).
-    let file = File::open(inputs).unwrap();
-    let mut reader = BufReader::new(file);
-	let mut line = String::new();
-	let mut len = reader.read_line(&mut line).unwrap();
-	if (len == 0)
+    //1. Open the r1cs file, converting it to the binary format if needed
+	let mut reader = match r1cs_bin::open(&inputs)
 	{
-		println!("ERRROR, file is empty");
-		return false;
-	}
+		Ok(r) => r,
+		Err(e) => { println!("ERRROR, cannot load {}: {}", inputs, e); return false; }
+	};
 	//2. parse header
-	let json: serde_json::Value = serde_json::from_str(&line).expect("JSON was not well-formatted");
-	let header: serde_json::Value = json["r1cs"].clone();
-	let constraint_nb : u32 =	serde_json::from_value(header["constraint_nb"].clone()).unwrap();
-	let instance_nb : u32 =	serde_json::from_value(header["instance_nb"].clone()).unwrap();
-	let witness_nb : u32 =	serde_json::from_value(header["witness_nb"].clone()).unwrap();
-	let gen_nb = 1 << (utils::bits(constraint_nb+witness_nb));
+	let gen_nb = 1 << (utils::bits(reader.header.constraint_nb+reader.header.witness_nb));
 	println!("generator length =  {:?}", gen_nb);
-	//3. Create some generators that will be used by both the prover and verifier
+	//3. Get the generators, they are shared with the prover
 	let pc_gens = PedersenGens::default();
-	let bp_gens = BulletproofGens::new(gen_nb, 1);
+	let result = with_gens(gen_nb, |bp_gens| verify_proof(&mut reader, inputfile, &proof_file, &pc_gens, bp_gens));
+	if (result)
+	{
+		println!("verification SUCCESS");
+	}
+	else
+	{
+		println!("verification FAIL");
+	}
+	return result;
+}
+
 
-	//4. Instantiate a the verifier
+//Verify several proofs of the same r1cs. The r1cs is read once in memory and the generators are shared,
+//but each proof is verified on its own, with its own multiscalar multiplication: the cost is the one of
+//separate verifications, minus the r1cs parsing and the generators creation.
+//inputs: file name of the r1cs in json format (or binary, see r1cs_bin)
+//proof_files: comma separated list of proof files. The public inputs of a proof are in <proof>.in if it exists, else in <inputs>.in
+//Returns true if all the proofs are valid
+pub fn VerifyBatch(inputs: String, proof_files: String) -> bool
+{
+	let data = match r1cs_bin::binary_file(&inputs).and_then(|f| fs::read(f))
+	{
+		Ok(d) => d,
+		Err(e) => { println!("ERRROR, cannot load {}: {}", inputs, e); return false; }
+	};
+	let header = match r1cs_bin::Reader::new(Cursor::new(&data[..]))
+	{
+		Ok(r) => r.header,
+		Err(e) => { println!("ERRROR, cannot load {}: {}", inputs, e); return false; }
+	};
+	let gen_nb = 1 << (utils::bits(header.constraint_nb+header.witness_nb));
+	let pc_gens = PedersenGens::default();
+	let start = Instant::now();
+	let mut proof_nb = 0;
+	let mut valid_nb = 0;
+	with_gens(gen_nb, |bp_gens|
+	{
+		for proof_file in proof_files.split(',').map(|p| p.trim()).filter(|p| !p.is_empty())
+		{
+			let proof_inputs = format!("{}{}", proof_file, ".in");
+			let inputfile = if (Path::new(&proof_inputs).exists()) { proof_inputs } else { format!("{}{}", inputs, ".in") };
+			let mut reader = r1cs_bin::Reader::new(Cursor::new(&data[..])).unwrap();
+			proof_nb += 1;
+			if (verify_proof(&mut reader, inputfile, proof_file, &pc_gens, bp_gens))
+			{
+				valid_nb += 1;
+			}
+			else
+			{
+				println!("verification FAIL for {}", proof_file);
+			}
+		}
+	});
+	println!("{} proofs out of {} are valid, verified in {:?}", valid_nb, proof_nb, start.elapsed());
+	return proof_nb > 0 && valid_nb == proof_nb;
+}
+
+
+//Replays the constraints into a verifier and checks the proof
+fn verify_proof<R: Read>(reader: &mut r1cs_bin::Reader<R>, inputfile: String, proof_file: &str, pc_gens: &PedersenGens, bp_gens: &BulletproofGens) -> bool
+{
+	//1. Instantiate a the verifier
 	let mut verifier_transcript = Transcript::new(b"r1cs");
 	let mut verifier = Verifier::new(&mut verifier_transcript);
 
-		
-	//5. Load the proof
-   	let data = fs::read_to_string(proof_file).expect("Unable to read proof file");
-   	let my_proof : JsonProof = serde_json::from_str(&data).unwrap();
-   	let proof : R1CSProof = R1CSProof::from_bytes(&my_proof.proof).unwrap();
+	//2. Load the proof
+	let proof = match fs::read_to_string(proof_file).ok()
+		.and_then(|data| serde_json::from_str::<JsonProof>(&data).ok())
+		.and_then(|p| R1CSProof::from_bytes(&p.proof).ok())
+	{
+		Some(p) => p,
+		None => { println!("Unable to read proof file {}", proof_file); return false; }
+	};
 	println!("proof  is loaded");
-	//6. Load inputs from .r1cs1.in file:
+	//3. Load inputs from .r1cs1.in file:
 	let mut r1: R1csInputs = load_inputs(inputfile,  &mut verifier, false);
-    //8. Read the file line by line using the lines() iterator from std::io::BufRead.
-	generate_constraints(&mut verifier, &mut reader, &mut r1, false);
+    //4. Stream the constraints into the verifier
+	generate_constraints(&mut verifier, reader, &mut r1, false);
    	println!("commit is done");
 
-	//9. Finally the verifier verifies the proof.
-	if (verifier.verify(&proof, &pc_gens, &bp_gens).is_ok())
-	{
-		println!("verification SUCCESS");
-    	return true;
-	}
-	else
+	//5. Finally the verifier verifies the proof.
+	return verifier.verify(&proof, pc_gens, bp_gens).is_ok();
+}
+
+
+thread_local! {
+	//Creating the generators is a large fixed cost, so they are kept between the calls of the same process and grown
+	//(BulletproofGens::increase_capacity) when a larger circuit needs more of them. They are not saved to disk:
+	//a process which proves or verifies once (isekai --verify) still creates them, the reuse is for the
+	//verification following a proof (isekai --prove), the benchmark and bpVerifyBatch
+	static BP_GENS: RefCell<Option<BulletproofGens>> = RefCell::new(None);
+}
+
+//Calls 'f' with the cached generators, after making sure they have a capacity of at least gen_nb
+fn with_gens<T, F: FnOnce(&BulletproofGens) -> T>(gen_nb: usize, f: F) -> T
+{
+	return BP_GENS.with(|cell|
 	{
-		println!("verification FAIL");
-	}
-	//Ok(verifier.verify(&proof, &pc_gens, &bp_gens)?);
-  	return false;
+		let mut gens = cell.borrow_mut();
+		match *gens
+		{
+			Some(ref g) if g.gens_capacity >= gen_nb => {},
+			Some(ref mut g) => { println!("...increasing generators to {:?}", gen_nb); g.increase_capacity(gen_nb); },
+			None => { *gens = Some(BulletproofGens::new(gen_nb, 1)); }
+		}
+		return f(gens.as_ref().unwrap());
+	});
 }
 
 
@@ -331,22 +400,21 @@ struct JsonProof {
 
 
 
-//Parse a json array (A, B or C), into the bulletproof type
-fn parseLinearCombJson(jlc: Vec<serde_json::Value>, r1: &mut R1csInputs, cs: &mut ConstraintSystem, is_prover: bool) -> LinearCombination
+//Convert a row of the r1cs (A, B or C) into the bulletproof type
+fn parseLinearComb(row: &r1cs_bin::Row, r1: &mut R1csInputs, cs: &mut ConstraintSystem, is_prover: bool) -> LinearCombination
 {
 	let mut lc: LinearCombination = LinearCombination::default();
 	
-	if (jlc.len() == 0 )
+	if (row.len() == 0 )
 	{
 		return lc;
 	}
 	let mut first: bool = true;
-	for term in jlc.iter()
+	for i in 0..row.len()
 	{
       	//TODO handle negative index
- 		let idx: usize =  serde_json::from_value(term[0].clone()).unwrap();
-    	let c_str: String = serde_json::from_value(term[1].clone()).unwrap();
-    	let coef = utils::string_to_scalar(c_str);//Handle big integers. TODO check this is correct
+ 		let idx: usize = row.index(i);
+    	let coef = row.coeff(i);
    		if (first == true)
     	{
     		lc = coef * r1.as_linear_term(cs, idx, is_prover);
@@ -359,5 +427,3 @@ fn parseLinearCombJson(jlc: Vec<serde_json::Value>, r1: &mut R1csInputs, cs: &mu
   	}
   	return lc;
 }
-
-
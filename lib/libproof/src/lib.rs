@@ -9,6 +9,7 @@ extern crate serde_derive;
 extern crate num_bigint;
 
 pub mod bp;
+pub mod r1cs_bin;
 pub mod utils;
 
 use std::os::raw::c_char;     //use libc::c_char;??
@@ -42,6 +43,14 @@ pub unsafe extern  "C" fn bpProve(inputs: *const c_char, proofFile: *const c_cha
 
 }
 
+//Load the r1cs and the inputs without proving (benchmark of the loading time)
+#[no_mangle]
+pub unsafe extern  "C" fn bpLoadR1cs(inputs: *const c_char) -> bool
+{
+    let inputs_str : String = utils::char_to_string(inputs);
+    return bp::Load(inputs_str);
+}
+
 #[no_mangle]
 pub unsafe extern  "C" fn bpVerify(inputs: *const c_char, proofFile: *const c_char) -> bool
  {
@@ -52,6 +61,16 @@ pub unsafe extern  "C" fn bpVerify(inputs: *const c_char, proofFile: *const c_ch
 
 }
 
+//Verify several proofs of the same r1cs, one after the other (they are not combined into a single verification)
+//proofFiles: comma separated list of proof files; the public inputs of each proof are in <proof>.in, or else in <inputs>.in
+#[no_mangle]
+pub unsafe extern  "C" fn bpVerifyBatch(inputs: *const c_char, proofFiles: *const c_char) -> bool
+{
+    let inputs_str : String = utils::char_to_string(inputs);
+    let proof_files : String = utils::char_to_string(proofFiles);
+    return bp::VerifyBatch(inputs_str, proof_files);
+}
+
 
 #[cfg(test)]
 mod tests {
@@ -0,0 +1,225 @@
+
+//Compact binary R1CS, streamed by the prover and the verifier instead of the json lines of the j1cs file.
+//Layout, little endian:
+//  magic "BPR1CS01", constraint_nb: u32, instance_nb: u32, witness_nb: u32, field characteristic: 32 bytes
+//  then for each constraint the rows A, B and C, each as term_nb: u32 followed by term_nb (index: u32, coefficient: 32 bytes)
+
+use curve25519_dalek::scalar::Scalar;
+
+use std::fs::{self, File};
+use std::io::{self, BufRead, BufReader, BufWriter, Read, Seek, SeekFrom, Write};
+use utils;
+
+use serde::Deserialize;
+
+const MAGIC: &[u8; 8] = b"BPR1CS01";
+const TERM_SIZE: usize = 36;
+const HEADER_SIZE: usize = 8 + 3 * 4 + 32;
+
+
+pub struct Header
+{
+	pub constraint_nb: u32,
+	pub instance_nb: u32,
+	pub witness_nb: u32,
+	pub field_characteristic: [u8; 32]
+}
+
+
+//A row (linear combination) of the constraint system; it borrows the reader's buffer
+pub struct Row<'a>
+{
+	data: &'a [u8]
+}
+
+impl<'a> Row<'a> {
+
+	pub fn len(&self) -> usize
+	{
+		return self.data.len() / TERM_SIZE;
+	}
+
+	pub fn index(&self, i: usize) -> usize
+	{
+		let t = &self.data[i * TERM_SIZE..];
+		return read_u32(&t[0..4]) as usize;
+	}
+
+	pub fn coeff(&self, i: usize) -> Scalar
+	{
+		let t = &self.data[i * TERM_SIZE + 4..(i + 1) * TERM_SIZE];
+		let mut bytes = [0u8; 32];
+		bytes.copy_from_slice(t);
+		return Scalar::from_bits(bytes);
+	}
+}
+
+
+//Streams the constraints of a binary R1CS; the three row buffers are reused for every constraint
+pub struct Reader<R: Read>
+{
+	reader: BufReader<R>,
+	pub header: Header,
+	rows: [Vec<u8>; 3],
+	read_nb: u32
+}
+
+impl<R: Read> Reader<R> {
+
+	pub fn new(inner: R) -> io::Result<Reader<R>>
+	{
+		let mut reader = BufReader::new(inner);
+		let mut h = [0u8; HEADER_SIZE];
+		reader.read_exact(&mut h)?;
+		if (&h[0..8] != MAGIC)
+		{
+			return Err(io::Error::new(io::ErrorKind::InvalidData, "not a binary r1cs"));
+		}
+		let mut field_characteristic = [0u8; 32];
+		field_characteristic.copy_from_slice(&h[20..52]);
+		let header = Header {
+			constraint_nb: read_u32(&h[8..12]),
+			instance_nb: read_u32(&h[12..16]),
+			witness_nb: read_u32(&h[16..20]),
+			field_characteristic: field_characteristic
+		};
+		return Ok(Reader { reader: reader, header: header, rows: [Vec::new(), Vec::new(), Vec::new()], read_nb: 0 });
+	}
+
+	//Returns the rows A, B and C of the next constraint, or None at the end of the constraint system
+	pub fn next_constraint(&mut self) -> io::Result<Option<(Row, Row, Row)>>
+	{
+		if (self.read_nb == self.header.constraint_nb)
+		{
+			return Ok(None);
+		}
+		self.read_nb += 1;
+		for row in self.rows.iter_mut()
+		{
+			let mut n = [0u8; 4];
+			self.reader.read_exact(&mut n)?;
+			row.resize(read_u32(&n) as usize * TERM_SIZE, 0);
+			self.reader.read_exact(row)?;
+		}
+		return Ok(Some((Row { data: &self.rows[0] }, Row { data: &self.rows[1] }, Row { data: &self.rows[2] })));
+	}
+}
+
+
+#[derive(Deserialize)]
+struct JsonHeader
+{
+	r1cs: JsonHeaderFields
+}
+
+#[derive(Deserialize)]
+struct JsonHeaderFields
+{
+	instance_nb: u32,
+	witness_nb: u32,
+	field_characteristic: String
+}
+
+#[allow(non_snake_case)]
+#[derive(Deserialize)]
+struct JsonConstraint
+{
+	A: Vec<(usize, String)>,
+	B: Vec<(usize, String)>,
+	C: Vec<(usize, String)>
+}
+
+
+//Converts a j1cs file (json lines) into the binary format
+pub fn convert_json(j1cs: &str, out_file: &str) -> io::Result<()>
+{
+	let mut reader = BufReader::new(File::open(j1cs)?);
+	let mut line = String::new();
+	if (reader.read_line(&mut line)? == 0)
+	{
+		return Err(io::Error::new(io::ErrorKind::InvalidData, "r1cs file is empty"));
+	}
+	let header: JsonHeader = serde_json::from_str(&line)?;
+	let prime = utils::string_to_scalar(header.r1cs.field_characteristic);
+
+	let mut out = BufWriter::new(File::create(out_file)?);
+	out.write_all(MAGIC)?;
+	out.write_all(&[0u8; 4])?;		//constraint_nb, written at the end
+	out.write_all(&u32_bytes(header.r1cs.instance_nb))?;
+	out.write_all(&u32_bytes(header.r1cs.witness_nb))?;
+	out.write_all(prime.as_bytes())?;
+
+	let mut constraint_nb: u32 = 0;
+	loop
+	{
+		line.clear();
+		if (reader.read_line(&mut line)? == 0)
+		{
+			break;
+		}
+		if (line.trim().is_empty())
+		{
+			continue;
+		}
+		let c: JsonConstraint = serde_json::from_str(&line)?;
+		for row in [&c.A, &c.B, &c.C].iter()
+		{
+			out.write_all(&u32_bytes(row.len() as u32))?;
+			for (idx, coeff) in row.iter()
+			{
+				out.write_all(&u32_bytes(*idx as u32))?;
+				out.write_all(utils::string_to_scalar(coeff.clone()).as_bytes())?;
+			}
+		}
+		constraint_nb += 1;
+	}
+
+	let mut file = out.into_inner()?;
+	file.seek(SeekFrom::Start(8))?;
+	file.write_all(&u32_bytes(constraint_nb))?;
+	return Ok(());
+}
+
+
+//Returns the binary form of an r1cs file. A j1cs file is converted once into <j1cs>.bin, which is
+//reused by the next calls (prover and verifier) as long as it is newer than the j1cs file.
+pub fn binary_file(r1cs_file: &str) -> io::Result<String>
+{
+	let mut magic = [0u8; 8];
+	let is_binary = File::open(r1cs_file)?.read_exact(&mut magic).is_ok() && &magic == MAGIC;
+	if (is_binary)
+	{
+		return Ok(r1cs_file.to_string());
+	}
+
+	let bin_file = format!("{}{}", r1cs_file, ".bin");
+	let json_time = fs::metadata(r1cs_file)?.modified()?;
+	let up_to_date = match fs::metadata(&bin_file).and_then(|m| m.modified())
+	{
+		Ok(bin_time) => bin_time >= json_time,
+		Err(_) => false
+	};
+	if (!up_to_date)
+	{
+		println!("...converting {} into {}", r1cs_file, bin_file);
+		convert_json(r1cs_file, &bin_file)?;
+	}
+	return Ok(bin_file);
+}
+
+//Opens an r1cs file (json or binary) for streaming
+pub fn open(r1cs_file: &str) -> io::Result<Reader<File>>
+{
+	return Reader::new(File::open(binary_file(r1cs_file)?)?);
+}
+
+
+fn read_u32(b: &[u8]) -> u32
+{
+	return (b[0] as u32) | (b[1] as u32) << 8 | (b[2] as u32) << 16 | (b[3] as u32) << 24;
+}
+
+fn u32_bytes(v: u32) -> [u8; 4]
+{
+	return [v as u8, (v >> 8) as u8, (v >> 16) as u8, (v >> 24) as u8];
+}
@@ -0,0 +1,745 @@
+#include "ArithOptimizer.hpp"
+#include "FieldCodec.hpp"
+#include "Trace.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+//Linear combinations with more terms are written as an add gate, so that long chains stay linear in time
+static const size_t kMaxTerms = 1024;
+
+skArithOptimizer::skArithOptimizer(long long oneWire)
+    : oneWire(oneWire), firstWire(0), nextWire(0), constraintsBefore(0), constraintsAfter(0), merged(0), folded(0), removed(0)
+{
+    libff::default_ec_pp::init_public_params();
+    for (int k = 0; k < KindCount; ++k)
+        gatesBefore[k] = gatesAfter[k] = 0;
+}
+
+const char *skArithOptimizer::KindName(Kind k)
+{
+    static const char *names[] = {"add", "mul", "const-mul", "pack", "split", "zerop", "xor", "or", "assert", "other"};
+    return names[k];
+}
+
+long long skArithOptimizer::Constraints(const Gate &g)
+{
+    switch (g.kind)
+    {
+    case Mul:
+    case Xor:
+    case Or:
+    case Assert:
+        return 1;
+    case Zerop:
+        return 2;
+    case Split:
+        //booleanity of each bit, and the packing
+        return g.out.size() + 1;
+    default:
+        return 0;
+    }
+}
+
+//Parse '<id id ...>' at p; returns false if the list is not well-formed
+static bool ParseIds(const char *&p, std::vector<skArithOptimizer::Wire> &ids)
+{
+    while (*p == ' ')
+        ++p;
+    if (*p++ != '<')
+        return false;
+    while (true)
+    {
+        while (*p == ' ')
+            ++p;
+        if (*p == '>')
+        {
+            ++p;
+            return true;
+        }
+        char *end;
+        unsigned long id = strtoul(p, &end, 10);
+        if (end == p)
+            return false;
+        ids.push_back(id);
+        p = end;
+    }
+}
+
+bool skArithOptimizer::ParseGate(const std::string &line, Gate &g)
+{
+    size_t hash = line.find('#');
+    std::string body = line.substr(0, hash);
+    g.comment.clear();
+    if (hash != std::string::npos)
+    {
+        size_t start = line.find_first_not_of(' ', hash + 1);
+        if (start != std::string::npos)
+            g.comment = line.substr(start);
+    }
+    const char *p = body.c_str();
+    const char *space = strchr(p, ' ');
+    if (space == NULL)
+        return false;
+    g.type.assign(p, space - p);
+    p = space;
+    unsigned int n, m;
+    int read;
+    g.in.clear();
+    g.out.clear();
+    if (sscanf(p, " in %u%n", &n, &read) != 1)
+        return false;
+    p += read;
+    if (!ParseIds(p, g.in))
+        return false;
+    if (sscanf(p, " out %u%n", &m, &read) != 1)
+        return false;
+    p += read;
+    if (!ParseIds(p, g.out) || g.in.size() != n || g.out.size() != m)
+        return false;
+
+    static const std::string constMulNeg = "const-mul-neg-", constMul = "const-mul-";
+    g.constant = FieldT::zero();
+    if (g.type.compare(0, constMulNeg.size(), constMulNeg) == 0)
+    {
+        g.kind = ConstMul;
+        g.constant = skFieldCodec<FieldT>::InternHex(g.type.c_str() + constMulNeg.size(), true);
+        g.type = constMul;
+    }
+    else if (g.type.compare(0, constMul.size(), constMul) == 0)
+    {
+        g.kind = ConstMul;
+        g.constant = skFieldCodec<FieldT>::InternHex(g.type.c_str() + constMul.size());
+        g.type = constMul;
+    }
+    else
+    {
+        g.kind = Other;
+        for (int k = 0; k < Other; ++k)
+            if (g.type == KindName(Kind(k)))
+                g.kind = Kind(k);
+    }
+    if ((g.kind == ConstMul && (n != 1 || m != 1)) || ((g.kind == Mul || g.kind == Xor || g.kind == Or || g.kind == Assert) && (n != 2 || m != 1))
+        || (g.kind == Zerop && (n != 1 || m != 2)) || ((g.kind == Add || g.kind == Pack) && m != 1) || (g.kind == Split && n != 1))
+        return false;
+    return true;
+}
+
+//First pass: input lines, and the number of uses of each wire
+bool skArithOptimizer::ReadHeader(const std::string &arithFile)
+{
+    std::ifstream in(arithFile);
+    if (!in.good())
+    {
+        printf("Unable to open circuit file %s\n", arithFile.c_str());
+        return false;
+    }
+    std::string line;
+    unsigned int total = 0;
+    getline(in, line);
+    if (sscanf(line.c_str(), "total %u", &total) != 1)
+    {
+        printf("File Format Does not Match\n");
+        return false;
+    }
+    uses.assign(total, 0);
+    auto use = [this](Wire w) {
+        if (w >= uses.size())
+            uses.resize(w + 1, 0);
+        uses[w]++;
+    };
+    long long commentedOne = -1;
+    Wire w;
+    Gate g;
+    while (getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+        bool nizk = false;
+        if (sscanf(line.c_str(), "input %u", &w) == 1 || (nizk = sscanf(line.c_str(), "nizkinput %u", &w) == 1))
+        {
+            Gate input;
+            input.kind = Other;
+            input.type = nizk ? "nizkinput" : "input";
+            input.out.push_back(w);
+            size_t hash = line.find('#');
+            if (hash != std::string::npos)
+            {
+                size_t start = line.find_first_not_of(' ', hash + 1);
+                if (start != std::string::npos)
+                    input.comment = line.substr(start);
+                if (!nizk && commentedOne < 0 && input.comment.find("one-input") != std::string::npos)
+                    commentedOne = w;
+            }
+            header.push_back(input);
+            firstWire = std::max(firstWire, w + 1);
+        }
+        else if (sscanf(line.c_str(), "output %u", &w) == 1)
+            use(w);
+        else if (ParseGate(line, g))
+        {
+            for (Wire i : g.in)
+                use(i);
+            if (g.kind == Assert)
+                use(g.out[0]);
+        }
+        else
+        {
+            printf("Error: unrecognized line: %s\n", line.c_str());
+            return false;
+        }
+    }
+    if (oneWire < 0)
+    {
+        oneWire = commentedOne;
+        for (size_t i = 0; oneWire < 0 && i < header.size(); ++i)
+            if (header[i].type == "input")
+                oneWire = header[i].out[0];
+    }
+    if (oneWire < 0)
+    {
+        printf("The circuit has no one-input wire\n");
+        return false;
+    }
+    return true;
+}
+
+bool skArithOptimizer::Optimize(const std::string &arithFile)
+{
+    skTrace::Span span("optimize.arith");
+    if (!ReadHeader(arithFile))
+        return false;
+
+    nextWire = firstWire;
+    values.assign(std::max<size_t>(uses.size(), firstWire), LinearComb());
+    defined.assign(values.size(), false);
+    variable.assign(firstWire, false);
+    for (const Gate &input : header)
+    {
+        Define(input.out[0], Atom(input.out[0]));
+        variable[input.out[0]] = true;
+    }
+
+    std::ifstream in(arithFile);
+    std::string line;
+    getline(in, line);
+    std::vector<Wire> circuitOutputs;
+    Wire w;
+    Gate g;
+    while (getline(in, line))
+    {
+        if (line.empty() || line[0] == '#' || line.compare(0, 5, "input") == 0 || line.compare(0, 9, "nizkinput") == 0)
+            continue;
+        if (sscanf(line.c_str(), "output %u", &w) == 1)
+        {
+            circuitOutputs.push_back(w);
+            continue;
+        }
+        ParseGate(line, g);
+        gatesBefore[g.kind]++;
+        constraintsBefore += Constraints(g);
+        if (!Process(g))
+        {
+            printf("Error: undefined input wire in: %s\n", line.c_str());
+            return false;
+        }
+    }
+
+    //CircuitReader needs the outputs to be distinct variables, so a linear combination or an input is multiplied by the one-wire
+    std::vector<bool> isOutput;
+    for (Wire o : circuitOutputs)
+    {
+        LinearComb lc;
+        if (!Value(o, lc))
+        {
+            printf("Error: undefined output wire %u\n", o);
+            return false;
+        }
+        Wire v = Materialize(lc);
+        isOutput.resize(std::max<size_t>(isOutput.size(), nextWire), false);
+        if (!variable[v] || isOutput[v] || v < firstWire)
+        {
+            Gate cast;
+            cast.kind = Mul;
+            cast.type = KindName(Mul);
+            cast.in = {Wire(oneWire), v};
+            cast.out = {Fresh()};
+            cast.comment = "output-cast";
+            gates.push_back(cast);
+            v = cast.out[0];
+            isOutput.resize(nextWire, false);
+        }
+        isOutput[v] = true;
+        outputs.push_back(v);
+    }
+    values.clear();
+    linear.clear();
+    written.clear();
+
+    RemoveDeadGates();
+    for (const Gate &gate : gates)
+    {
+        gatesAfter[gate.kind]++;
+        constraintsAfter += Constraints(gate);
+    }
+    skTrace::Count("gates.before", std::accumulate(gatesBefore, gatesBefore + KindCount, 0LL));
+    skTrace::Count("gates", gates.size());
+    skTrace::Count("constraints.before", constraintsBefore);
+    skTrace::Count("constraints", constraintsAfter);
+    return true;
+}
+
+bool skArithOptimizer::Value(Wire w, LinearComb &lc) const
+{
+    if (w >= defined.size() || !defined[w])
+        return false;
+    lc = values[w];
+    return true;
+}
+
+void skArithOptimizer::Define(Wire w, const LinearComb &lc)
+{
+    if (w >= values.size())
+    {
+        values.resize(w + 1);
+        defined.resize(w + 1, false);
+    }
+    defined[w] = true;
+    if (lc.size() > kMaxTerms)
+        values[w] = Atom(Materialize(lc));
+    else
+        values[w] = lc;
+}
+
+void skArithOptimizer::Use(Wire w)
+{
+    //the value is not needed any more
+    if (w < uses.size() && uses[w] > 0 && --uses[w] == 0)
+        LinearComb().swap(values[w]);
+}
+
+skArithOptimizer::LinearComb skArithOptimizer::Atom(Wire w)
+{
+    return LinearComb(1, std::make_pair(w, FieldT::one()));
+}
+
+skArithOptimizer::LinearComb skArithOptimizer::Sum(const LinearComb &a, const LinearComb &b, const FieldT &scale)
+{
+    if (scale.is_zero())
+        return a;
+    LinearComb result;
+    result.reserve(a.size() + b.size());
+    size_t i = 0, j = 0;
+    while (i < a.size() || j < b.size())
+    {
+        if (j == b.size() || (i < a.size() && a[i].first < b[j].first))
+            result.push_back(a[i++]);
+        else if (i == a.size() || b[j].first < a[i].first)
+        {
+            result.push_back(std::make_pair(b[j].first, scale * b[j].second));
+            ++j;
+        }
+        else
+        {
+            FieldT c = a[i].second + scale * b[j].second;
+            if (!c.is_zero())
+                result.push_back(std::make_pair(a[i].first, c));
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+bool skArithOptimizer::IsConst(const LinearComb &lc, FieldT &c) const
+{
+    if (lc.empty())
+    {
+        c = FieldT::zero();
+        return true;
+    }
+    if (lc.size() == 1 && lc[0].first == oneWire)
+    {
+        c = lc[0].second;
+        return true;
+    }
+    return false;
+}
+
+skArithOptimizer::LinearComb skArithOptimizer::Const(const FieldT &c) const
+{
+    if (c.is_zero())
+        return LinearComb();
+    return LinearComb(1, std::make_pair(Wire(oneWire), c));
+}
+
+skArithOptimizer::Wire skArithOptimizer::Fresh()
+{
+    variable.push_back(false);
+    return nextWire++;
+}
+
+//Key of a linear combination or of a gate: wire ids and Montgomery limbs
+static void AppendKey(std::string &key, skArithOptimizer::Wire w)
+{
+    key.append(reinterpret_cast<const char *>(&w), sizeof(w));
+}
+
+static void AppendKey(std::string &key, const FieldT &c)
+{
+    char buf[skFieldCodec<FieldT>::kBinarySize];
+    skFieldCodec<FieldT>::ToBinary(c, buf);
+    key.append(buf, sizeof(buf));
+}
+
+skArithOptimizer::Wire skArithOptimizer::Materialize(const LinearComb &lc)
+{
+    if (lc.size() == 1 && lc[0].second == FieldT::one())
+        return lc[0].first;
+    std::string key;
+    for (auto &term : lc)
+    {
+        AppendKey(key, term.first);
+        AppendKey(key, term.second);
+    }
+    auto it = linear.find(key);
+    if (it != linear.end())
+        return it->second;
+
+    Gate g;
+    if (lc.size() <= 1)
+    {
+        g.kind = ConstMul;
+        g.type = KindName(ConstMul);
+        g.constant = lc.empty() ? FieldT::zero() : lc[0].second;
+        g.in.push_back(lc.empty() ? Wire(oneWire) : lc[0].first);
+    }
+    else
+    {
+        g.kind = Add;
+        g.type = KindName(Add);
+        for (auto &term : lc)
+            g.in.push_back(term.second == FieldT::one() ? term.first : Materialize(LinearComb(1, term)));
+    }
+    g.out.resize(1);
+    Wire w = Emit(g, g.kind == Add)[0];
+    linear[key] = w;
+    return w;
+}
+
+std::vector<skArithOptimizer::Wire> skArithOptimizer::Emit(Gate g, bool commutative)
+{
+    if (commutative)
+        std::sort(g.in.begin(), g.in.end());
+    std::string key;
+    if (g.kind != Other)
+    {
+        key = g.type;
+        key += '\0';
+        if (g.kind == ConstMul)
+            AppendKey(key, g.constant);
+        for (Wire w : g.in)
+            AppendKey(key, w);
+        //the output of an assert is one of its operands
+        AppendKey(key, g.kind == Assert ? g.out[0] : Wire(g.out.size()));
+        auto it = written.find(key);
+        if (it != written.end())
+        {
+            if (g.kind != Add && g.kind != ConstMul)
+                merged++;
+            return it->second;
+        }
+    }
+    if (g.kind != Assert)
+    {
+        for (Wire &w : g.out)
+        {
+            w = Fresh();
+            variable[w] = g.kind != Add && g.kind != ConstMul;
+        }
+    }
+    if (g.kind != Other)
+        written[key] = g.out;
+    gates.push_back(g);
+    return gates.back().out;
+}
+
+bool skArithOptimizer::Process(const Gate &g)
+{
+    std::vector<LinearComb> v(g.in.size());
+    for (size_t i = 0; i < g.in.size(); ++i)
+    {
+        if (!Value(g.in[i], v[i]))
+            return false;
+        //a linear combination used several times is written once, instead of being copied into each use
+        if ((g.kind == Add || g.kind == ConstMul || g.kind == Pack) && v[i].size() > 1 && uses[g.in[i]] > 1)
+        {
+            v[i] = Atom(Materialize(v[i]));
+            values[g.in[i]] = v[i];
+        }
+    }
+
+    FieldT a, b;
+    LinearComb result;
+    bool linearResult = true;
+    switch (g.kind)
+    {
+    case Add:
+        for (auto &lc : v)
+            result = Sum(result, lc, FieldT::one());
+        break;
+    case ConstMul:
+        result = Sum(result, v[0], g.constant);
+        break;
+    case Pack:
+    {
+        FieldT two_i = FieldT::one();
+        for (auto &lc : v)
+        {
+            result = Sum(result, lc, two_i);
+            two_i += two_i;
+        }
+        break;
+    }
+    case Mul:
+        if (IsConst(v[0], a))
+            result = Sum(result, v[1], a);
+        else if (IsConst(v[1], b))
+            result = Sum(result, v[0], b);
+        else
+            linearResult = false;
+        break;
+    case Xor:
+    case Or:
+        //the operands are bits; a constant operand is 0 or 1, otherwise the gate is kept as it is
+        if (IsConst(v[1], b) && (b.is_zero() || b == FieldT::one()))
+            std::swap(v[0], v[1]);
+        if (IsConst(v[0], a) && a.is_zero())
+            result = v[1];
+        else if (IsConst(v[0], a) && a == FieldT::one())
+            result = g.kind == Xor ? Sum(Const(a), v[1], -FieldT::one()) : Const(a);
+        else
+            linearResult = false;
+        break;
+    case Split:
+        if (IsConst(v[0], a) && a.as_bigint().num_bits() <= g.out.size())
+        {
+            folded++;
+            for (size_t i = 0; i < g.out.size(); ++i)
+                Define(g.out[i], Const(a.as_bigint().test_bit(i) ? FieldT::one() : FieldT::zero()));
+            for (Wire w : g.in)
+                Use(w);
+            return true;
+        }
+        linearResult = false;
+        break;
+    case Zerop:
+        //the first output is not used by CircuitReader; the gate is only folded if the circuit does not use it either
+        if (IsConst(v[0], a) && (g.out[0] >= uses.size() || uses[g.out[0]] == 0))
+        {
+            folded++;
+            Define(g.out[1], Const(a.is_zero() ? FieldT::zero() : FieldT::one()));
+            Use(g.in[0]);
+            return true;
+        }
+        linearResult = false;
+        break;
+    default:
+        linearResult = false;
+        break;
+    }
+
+    if (linearResult)
+    {
+        if (g.kind != Add && g.kind != ConstMul && g.kind != Pack)
+            folded++;
+        Define(g.out[0], result);
+        for (Wire w : g.in)
+            Use(w);
+        return true;
+    }
+
+    LinearComb c;
+    if (g.kind == Assert)
+    {
+        FieldT cc;
+        if (!Value(g.out[0], c))
+            return false;
+        if (IsConst(v[0], a) && IsConst(v[1], b) && IsConst(c, cc) && a * b == cc)
+        {
+            //holds for any assignment
+            folded++;
+            Use(g.out[0]);
+            for (Wire w : g.in)
+                Use(w);
+            return true;
+        }
+    }
+
+    Gate n;
+    n.kind = g.kind;
+    n.type = g.type;
+    n.constant = g.constant;
+    n.comment = g.comment;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        n.in.push_back(Materialize(v[i]));
+        if (v[i].size() > 1)
+            values[g.in[i]] = Atom(n.in.back());
+    }
+    if (g.kind == Assert)
+    {
+        n.out.push_back(Materialize(c));
+        Emit(n, true);
+        Use(g.out[0]);
+    }
+    else
+    {
+        n.out.resize(g.out.size());
+        std::vector<Wire> out = Emit(n, g.kind == Mul || g.kind == Xor || g.kind == Or);
+        for (size_t i = 0; i < out.size(); ++i)
+            Define(g.out[i], Atom(out[i]));
+    }
+    for (Wire w : g.in)
+        Use(w);
+    return true;
+}
+
+void skArithOptimizer::RemoveDeadGates()
+{
+    std::vector<bool> live(nextWire, false);
+    for (Wire o : outputs)
+        live[o] = true;
+    std::vector<bool> keep(gates.size(), false);
+    for (size_t i = gates.size(); i-- > 0;)
+    {
+        const Gate &g = gates[i];
+        //split and assert constrain their inputs, and the semantics of the other gates are unknown
+        bool k = g.kind == Split || g.kind == Assert || g.kind == Other;
+        for (Wire w : g.out)
+            k = k || live[w];
+        if (!k)
+            continue;
+        keep[i] = true;
+        for (Wire w : g.in)
+            live[w] = true;
+        if (g.kind == Assert)
+            live[g.out[0]] = true;
+    }
+
+    //the wires are renumbered in order, as each new wire must be the next one
+    std::vector<Wire> renum(nextWire);
+    for (Wire w = 0; w < firstWire; ++w)
+        renum[w] = w;
+    Wire next = firstWire;
+    std::vector<Gate> kept;
+    for (size_t i = 0; i < gates.size(); ++i)
+    {
+        if (!keep[i])
+        {
+            removed++;
+            continue;
+        }
+        Gate &g = gates[i];
+        for (Wire &w : g.in)
+            w = renum[w];
+        for (Wire &w : g.out)
+        {
+            if (g.kind != Assert)
+                renum[w] = next++;
+            w = renum[w];
+        }
+        kept.push_back(std::move(g));
+    }
+    for (Wire &o : outputs)
+        o = renum[o];
+    gates.swap(kept);
+    nextWire = next;
+}
+
+static void WriteIds(std::ostream &out, const std::vector<skArithOptimizer::Wire> &ids)
+{
+    out << ids.size() << " <";
+    for (size_t i = 0; i < ids.size(); ++i)
+        out << (i ? " " : "") << ids[i];
+    out << ">";
+}
+
+bool skArithOptimizer::Write(const std::string &arithFile) const
+{
+    std::ofstream out(arithFile);
+    if (!out.good())
+    {
+        printf("Unable to write circuit file %s\n", arithFile.c_str());
+        return false;
+    }
+    out << "total " << nextWire << "\n";
+    for (const Gate &input : header)
+    {
+        out << input.type << " " << input.out[0];
+        if (!input.comment.empty())
+            out << " # " << input.comment;
+        out << "\n";
+    }
+    for (const Gate &g : gates)
+    {
+        if (g.kind == ConstMul)
+        {
+            //the shortest of c and -c
+            std::string hex = skFieldCodec<FieldT>::ToHex(g.constant), neg = skFieldCodec<FieldT>::ToHex(-g.constant);
+            out << (neg.size() < hex.size() ? "const-mul-neg-" + neg : "const-mul-" + hex);
+        }
+        else
+            out << g.type;
+        out << " in ";
+        WriteIds(out, g.in);
+        out << " out ";
+        WriteIds(out, g.out);
+        if (!g.comment.empty())
+            out << " # " << g.comment;
+        out << "\n";
+    }
+    for (Wire o : outputs)
+        out << "output " << o << "\n";
+    return out.good();
+}
+
+void skArithOptimizer::Report(std::ostream &out) const
+{
+    out << std::left << std::setw(20) << "gate" << std::right << std::setw(12) << "before" << std::setw(12) << "after" << "\n";
+    long long before = 0, after = 0;
+    for (int k = 0; k < KindCount; ++k)
+    {
+        before += gatesBefore[k];
+        after += gatesAfter[k];
+        if (gatesBefore[k] == 0 && gatesAfter[k] == 0)
+            continue;
+        out << std::left << std::setw(20) << KindName(Kind(k)) << std::right << std::setw(12) << gatesBefore[k] << std::setw(12) << gatesAfter[k] << "\n";
+    }
+    out << std::left << std::setw(20) << "total" << std::right << std::setw(12) << before << std::setw(12) << after << "\n";
+    out << std::left << std::setw(20) << "constraints (est.)" << std::right << std::setw(12) << constraintsBefore << std::setw(12) << constraintsAfter << "\n";
+    out << "merged: " << merged << ", folded: " << folded << ", removed: " << removed << "\n";
+}
+
+json skArithOptimizer::ReportJson() const
+{
+    json before, after;
+    for (int k = 0; k < KindCount; ++k)
+    {
+        before[KindName(Kind(k))] = gatesBefore[k];
+        after[KindName(Kind(k))] = gatesAfter[k];
+    }
+    json report;
+    report["gates"] = {{"before", before}, {"after", after}};
+    report["constraints"] = {{"before", constraintsBefore}, {"after", constraintsAfter}};
+    report["merged"] = merged;
+    report["folded"] = folded;
+    report["removed"] = removed;
+    report["wires"] = nextWire;
+    return report;
+}
@@ -0,0 +1,103 @@
+#ifndef ARITH_OPTIMIZER_HPP_
+#define ARITH_OPTIMIZER_HPP_
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Util.hpp"
+
+//Gate-level optimizer for arithmetic circuits in Pinocchio/jsnark format (.arith), as read by CircuitReader.
+//It writes an equivalent circuit, with the same input wires (so the .in file is unchanged) and the same outputs in the same order:
+// - add, const-mul and pack gates are kept as linear combinations, which are only written when a non-linear gate or an output needs them;
+//   chains of adds are flattened into one add and the constant multiplications are fused into one const-mul per term
+// - the constants are propagated through the one-wire: a mul, xor, or, split or zerop of constants becomes a constant,
+//   and a mul by a constant becomes a const-mul
+// - the gates with the same type and inputs are written once (common subexpression elimination)
+// - the gates whose outputs are not used are removed, except split and assert gates, which constrain their inputs,
+//   and the gates the optimizer does not know
+//Constants are computed in FieldT, the field of libsnark (bn128): the circuits of the other fields must not be optimized,
+//isekai refuses --optimize-arith for them.
+class skArithOptimizer
+{
+    public:
+    typedef unsigned int Wire;
+    //Sum of coefficient * wire, sorted by wire, without zero coefficient. A constant is a multiple of the one-wire.
+    typedef std::vector<std::pair<Wire, FieldT>> LinearComb;
+
+    enum Kind { Add, Mul, ConstMul, Pack, Split, Zerop, Xor, Or, Assert, Other, KindCount };
+
+    struct Gate
+    {
+        Kind kind;
+        //Name of the gate as written, without the constant for const-mul
+        std::string type;
+        FieldT constant;
+        std::vector<Wire> in;
+        std::vector<Wire> out;
+        std::string comment;
+    };
+
+    //oneWire: the input wire with the value 1; by default the input commented as 'one-input', or else the first input
+    explicit skArithOptimizer(long long oneWire = -1);
+
+    //Read and optimize 'arithFile'; returns false if it cannot be parsed
+    bool Optimize(const std::string &arithFile);
+
+    //Write the optimized circuit
+    bool Write(const std::string &arithFile) const;
+
+    //Gates and estimated constraints (as translated by CircuitReader) before and after, as a table or in json
+    void Report(std::ostream &out) const;
+    json ReportJson() const;
+
+    private:
+    long long oneWire;
+    //first wire after the inputs, and next wire of the optimized circuit
+    Wire firstWire, nextWire;
+
+    //header of the circuit: input and nizkinput lines, in order
+    std::vector<Gate> header;
+    std::vector<Gate> gates;
+    std::vector<Wire> outputs;
+
+    //per wire of the original circuit: its value in the optimized circuit, and its remaining uses
+    std::vector<LinearComb> values;
+    std::vector<bool> defined;
+    std::vector<unsigned int> uses;
+
+    //linear combinations and gates already written, by key
+    std::unordered_map<std::string, Wire> linear;
+    std::unordered_map<std::string, std::vector<Wire>> written;
+    //wires of the optimized circuit which are inputs, or outputs of a non-linear gate (thus usable as circuit outputs)
+    std::vector<bool> variable;
+
+    long long gatesBefore[KindCount], gatesAfter[KindCount];
+    long long constraintsBefore, constraintsAfter;
+    long long merged, folded, removed;
+
+    static bool ParseGate(const std::string &line, Gate &g);
+    static long long Constraints(const Gate &g);
+    static const char *KindName(Kind k);
+
+    bool ReadHeader(const std::string &arithFile);
+    bool Process(const Gate &g);
+    bool Value(Wire w, LinearComb &lc) const;
+    void Define(Wire w, const LinearComb &lc);
+    void Use(Wire w);
+
+    static LinearComb Atom(Wire w);
+    static LinearComb Sum(const LinearComb &a, const LinearComb &b, const FieldT &scale);
+    bool IsConst(const LinearComb &lc, FieldT &c) const;
+    LinearComb Const(const FieldT &c) const;
+
+    //Wire of the optimized circuit holding lc, writing the const-mul and add gates it needs
+    Wire Materialize(const LinearComb &lc);
+    //Write a gate unless the same one was written before; returns its outputs
+    std::vector<Wire> Emit(Gate g, bool commutative);
+    Wire Fresh();
+
+    void RemoveDeadGates();
+};
+
+#endif
@@ -27,6 +27,7 @@ CircuitReader::CircuitReader(const char* arithFilepath, const char* inputsFilepa
 
 void CircuitReader::parseAndEval(const char* arithFilepath, const char* inputsFilepath) {
 
+	skTrace::Span span("parse");
 	libff::enter_block("Parsing and Evaluating the circuit");
 
 	ifstream arithfs(arithFilepath, ifstream::in);
@@ -81,7 +82,6 @@ void CircuitReader::parseAndEval(const char* arithFilepath, const char* inputsFi
 
 	FieldT oneElement = FieldT::one();
 	FieldT zeroElement = FieldT::zero();
-	FieldT negOneElement = FieldT(-1);
 
 	long long evalTime;
 	long long begin, end;
@@ -144,11 +144,11 @@ void CircuitReader::parseAndEval(const char* arithFilepath, const char* inputsFi
 			} else if (strstr(type, "const-mul-neg-")) {
 				opcode = MULCONST_OPCODE;
 				char* constStr = type + sizeof("const-mul-neg-") - 1;
-				constant = skUtils::HexStringToField(constStr) * negOneElement;
+				constant = skFieldCodec<FieldT>::InternHex(constStr, true);
 			} else if (strstr(type, "const-mul-")) {
 				opcode = MULCONST_OPCODE;
 				char* constStr = type + sizeof("const-mul-") - 1;
-				constant = skUtils::HexStringToField(constStr);
+				constant = skFieldCodec<FieldT>::InternHex(constStr);
 			} else {
 				printf("Error: unrecognized line: %s\n", line.c_str());
 				assert(0);
@@ -209,11 +209,16 @@ void CircuitReader::parseAndEval(const char* arithFilepath, const char* inputsFi
 
 	end = clock();
 	// printf("\t Evaluation Done in %lf seconds \n", (double) (evalTime) * 1e-9);
+	skTrace::Count("wires", numWires);
+	skTrace::Count("inputs", numInputs);
+	skTrace::Count("nizk_inputs", numNizkInputs);
+	skTrace::Count("outputs", numOutputs);
 	 libff::leave_block("Parsing and Evaluating the circuit");
 }
 
 void CircuitReader::constructCircuit(const char* arithFilepath) {
 
+	skTrace::Span span("r1cs");
 	cout << "Translating Constraints ... " << endl;
 	#ifndef NO_PROCPS
 	struct proc_t usage1, usage2;			  						  
@@ -313,6 +318,8 @@ void CircuitReader::constructCircuit(const char* arithFilepath) {
 	}
 
 	ifs2.close();
+	skTrace::Count("lines", lineCount);
+	skTrace::Count("constraints", pb->numConstraints());
 
 	printf("\tConstraint translation done\n");
 	#ifndef NO_PROCPS			  
@@ -324,6 +331,8 @@ void CircuitReader::constructCircuit(const char* arithFilepath) {
 
 void CircuitReader::mapValuesToProtoboard() {
 
+	skTrace::Span span("witness");
+
 	int zeropGateIndex = 0;
 	for (WireMap::iterator iter = variableMap.begin();
 			iter != variableMap.end(); ++iter) {
@@ -339,10 +348,7 @@ void CircuitReader::mapValuesToProtoboard() {
 			}
 		}
 	}
-	if (!pb->isSatisfied(PrintOptions::DBG_PRINT_IF_NOT_SATISFIED)) {
-		printf("Note: Protoboard Not Satisfied .. \n");
-		// assert(false);
-	}
+	//the provers check the assignment in parallel, with the failing constraints (see skR1CSCheck)
 	printf("Assignment of values done .. \n");
 
 }
@@ -676,7 +682,7 @@ void CircuitReader::handleMulConst(char* type, char* inputStr, char* outputStr)
 	LinearCombinationPtr l;
 	find(inWireId, l, true);
 	wireLinearCombinations[outputWireId] = l;
-	*(wireLinearCombinations[outputWireId]) *= skUtils::HexStringToField(constStr);
+	*(wireLinearCombinations[outputWireId]) *= skFieldCodec<FieldT>::InternHex(constStr);
 }
 
 void CircuitReader::handleMulNegConst(char* type, char* inputStr, char* outputStr) {
@@ -697,8 +703,6 @@ void CircuitReader::handleMulNegConst(char* type, char* inputStr, char* outputSt
 	find(inWireId, l, true);
 
 	wireLinearCombinations[outputWireId] = l;
-	*(wireLinearCombinations[outputWireId]) *= skUtils::HexStringToField(
-			constStr);
-	*(wireLinearCombinations[outputWireId]) *= FieldT(-1); //TODO: make shared FieldT constants
+	*(wireLinearCombinations[outputWireId]) *= skFieldCodec<FieldT>::InternHex(constStr, true);
 
 }
@@ -5,6 +5,8 @@
  */
 
 #include "Util.hpp"
+#include "FieldCodec.hpp"
+#include "Trace.hpp"
 #include <libsnark/gadgetlib2/integration.hpp>
 #include <libsnark/gadgetlib2/adapters.hpp>
 #include <libff/common/profiling.hpp>
@@ -0,0 +1,356 @@
+#ifndef FIELD_CODEC_HPP_
+#define FIELD_CODEC_HPP_
+
+#include <gmp.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+//Conversions between the elements of a libff prime field (Fp_model, used by libsnark and libiop)
+//and their hexadecimal, decimal or binary forms.
+//Text is parsed straight into the limbs of a bigint and converted once into Montgomery form,
+//instead of going through mpz_t and a decimal string for each value.
+//The class is header-only because it is used with the field of libsnark and the fields of libiop,
+//which may be the same type depending on CURVE.
+template<class F>
+class skFieldCodec
+{
+    public:
+    typedef decltype(F().as_bigint()) BigIntT;
+    static const mp_size_t kLimbs = F::num_limbs;
+    //Size of the binary form
+    static const size_t kBinarySize = sizeof(BigIntT);
+
+    //Parse 'len' hexadecimal digits; returns false if a character is not a digit
+    static bool FromHex(const char *str, size_t len, F &f);
+    static F FromHex(const char *str);
+
+    //Parse 'len' decimal digits, optionally preceded by '-'; returns false if a character is not a digit
+    static bool FromDecimal(const char *str, size_t len, F &f);
+    static F FromDecimal(const std::string &str);
+    //Same as FromDecimal, but the value must be in canonical form: no sign, no leading zero and below the characteristic.
+    //Used for untrusted values, which would otherwise have several valid encodings
+    static bool FromCanonicalDecimal(const char *str, size_t len, F &f);
+
+    //Decimal (resp. hexadecimal) form of f, without leading zeros
+    static std::string ToDecimal(const F &f);
+    static std::string ToHex(const F &f);
+
+    //Montgomery limbs of f (kBinarySize bytes in the byte order of the platform), nothing is converted.
+    //It is only meant to be read back by FromBinary, with the same field
+    static void ToBinary(const F &f, char *out);
+    static void FromBinary(const char *in, F &f);
+
+    //Batch conversions, the elements are appended to 'out'; they run on all cores when built with MULTICORE
+    static bool FromDecimal(const std::vector<std::string> &in, std::vector<F> &out);
+    static bool FromCanonicalDecimal(const std::vector<std::string> &in, std::vector<F> &out);
+    static void ToDecimal(const std::vector<F> &in, std::vector<std::string> &out);
+
+    //Field element of an hexadecimal constant, negated if 'negate'.
+    //Each distinct constant is only converted once: circuits repeat the same const-mul coefficients many times.
+    //The returned reference stays valid until ClearInterned. Not thread-safe.
+    static const F &InternHex(const char *str, bool negate = false);
+    static void ClearInterned();
+
+    private:
+    static std::unordered_map<std::string, F> &Interned();
+    //limbs is a number of 'size' limbs, it is reduced modulo the characteristic into f
+    static void Reduce(mp_limb_t *limbs, mp_size_t size, F &f);
+    //Parse 'len' decimal digits into kLimbs+1 limbs; 'overflow' is set if the number does not fit
+    static bool DecimalLimbs(const char *str, size_t len, mp_limb_t *limbs, bool &overflow);
+    //Slow path for numbers which do not fit in kLimbs+1 limbs
+    static bool FromMpz(const char *str, size_t len, int base, F &f);
+};
+
+static_assert(GMP_NUMB_BITS == 64, "skFieldCodec expects 64 bits limbs");
+
+
+template<class F>
+void skFieldCodec<F>::Reduce(mp_limb_t *limbs, mp_size_t size, F &f)
+{
+    while (size > 0 && limbs[size - 1] == 0)
+        --size;
+    BigIntT b;
+    if (size > kLimbs || (size == kLimbs && mpn_cmp(limbs, F::mod.data, kLimbs) >= 0))
+    {
+        //size is at most kLimbs+1
+        mp_limb_t q[2];
+        mpn_tdiv_qr(q, b.data, 0, limbs, size, F::mod.data, kLimbs);
+    }
+    else
+    {
+        memset(b.data, 0, sizeof(b.data));
+        memcpy(b.data, limbs, size * sizeof(mp_limb_t));
+    }
+    f = F(b);
+}
+
+template<class F>
+bool skFieldCodec<F>::FromMpz(const char *str, size_t len, int base, F &f)
+{
+    std::string s(str, len);
+    mpz_t integ, p;
+    if (mpz_init_set_str(integ, s.c_str(), base) != 0)
+    {
+        mpz_clear(integ);
+        return false;
+    }
+    mpz_init(p);
+    F::mod.to_mpz(p);
+    mpz_mod(integ, integ, p);
+    f = F(BigIntT(integ));
+    mpz_clear(p);
+    mpz_clear(integ);
+    return true;
+}
+
+template<class F>
+bool skFieldCodec<F>::FromHex(const char *str, size_t len, F &f)
+{
+    if (len == 0)
+        return false;
+    mp_limb_t limbs[kLimbs + 1] = {0};
+    size_t bits = 0;
+    for (size_t i = len; i-- > 0; bits += 4)
+    {
+        char c = str[i];
+        mp_limb_t d;
+        if (c >= '0' && c <= '9')
+            d = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            d = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            d = c - 'A' + 10;
+        else
+            return false;
+        if (d == 0)
+            continue;
+        if (bits / GMP_NUMB_BITS > size_t(kLimbs))
+            return FromMpz(str, len, 16, f);
+        limbs[bits / GMP_NUMB_BITS] |= d << (bits % GMP_NUMB_BITS);
+    }
+    Reduce(limbs, kLimbs + 1, f);
+    return true;
+}
+
+template<class F>
+F skFieldCodec<F>::FromHex(const char *str)
+{
+    F f;
+    if (!FromHex(str, strlen(str), f))
+    {
+        printf("invalid hexadecimal value %s\n", str);
+        return F::zero();
+    }
+    return f;
+}
+
+template<class F>
+bool skFieldCodec<F>::DecimalLimbs(const char *str, size_t len, mp_limb_t *limbs, bool &overflow)
+{
+    overflow = false;
+    memset(limbs, 0, (kLimbs + 1) * sizeof(mp_limb_t));
+    //19 digits fit in one limb
+    for (size_t i = 0; i < len;)
+    {
+        size_t end = std::min(len, i + 19);
+        mp_limb_t chunk = 0, scale = 1;
+        for (; i < end; ++i)
+        {
+            unsigned d = (unsigned char)str[i] - '0';
+            if (d > 9)
+                return false;
+            chunk = chunk * 10 + d;
+            scale *= 10;
+        }
+        mp_limb_t carry = mpn_mul_1(limbs, limbs, kLimbs + 1, scale);
+        carry += mpn_add_1(limbs, limbs, kLimbs + 1, chunk);
+        if (carry != 0)
+        {
+            //the remaining digits still have to be valid
+            for (; i < len; ++i)
+                if ((unsigned char)str[i] - '0' > 9u)
+                    return false;
+            overflow = true;
+            return true;
+        }
+    }
+    return true;
+}
+
+template<class F>
+bool skFieldCodec<F>::FromDecimal(const char *str, size_t len, F &f)
+{
+    bool negative = len > 0 && str[0] == '-';
+    if (negative)
+    {
+        ++str;
+        --len;
+    }
+    if (len == 0)
+        return false;
+    mp_limb_t limbs[kLimbs + 1];
+    bool overflow;
+    if (!DecimalLimbs(str, len, limbs, overflow))
+        return false;
+    if (overflow)
+    {
+        if (!FromMpz(str, len, 10, f))
+            return false;
+    }
+    else
+        Reduce(limbs, kLimbs + 1, f);
+    if (negative)
+        f = -f;
+    return true;
+}
+
+template<class F>
+bool skFieldCodec<F>::FromCanonicalDecimal(const char *str, size_t len, F &f)
+{
+    if (len == 0 || (len > 1 && str[0] == '0'))
+        return false;
+    mp_limb_t limbs[kLimbs + 1];
+    bool overflow;
+    if (!DecimalLimbs(str, len, limbs, overflow) || overflow || limbs[kLimbs] != 0 || mpn_cmp(limbs, F::mod.data, kLimbs) >= 0)
+        return false;
+    Reduce(limbs, kLimbs, f);
+    return true;
+}
+
+template<class F>
+F skFieldCodec<F>::FromDecimal(const std::string &str)
+{
+    F f;
+    if (!FromDecimal(str.data(), str.size(), f))
+    {
+        printf("invalid decimal value %s\n", str.c_str());
+        return F::zero();
+    }
+    return f;
+}
+
+template<class F>
+std::string skFieldCodec<F>::ToDecimal(const F &f)
+{
+    BigIntT b = f.as_bigint();
+    mp_size_t size = kLimbs;
+    while (size > 0 && b.data[size - 1] == 0)
+        --size;
+    if (size == 0)
+        return "0";
+    //a limb has less than 20 digits; mpn_get_str overwrites b and may write leading zeros
+    unsigned char buf[kLimbs * 20 + 1];
+    size_t len = mpn_get_str(buf, 10, b.data, size);
+    size_t start = 0;
+    while (start + 1 < len && buf[start] == 0)
+        ++start;
+    std::string result(len - start, '0');
+    for (size_t i = start; i < len; ++i)
+        result[i - start] += buf[i];
+    return result;
+}
+
+template<class F>
+std::string skFieldCodec<F>::ToHex(const F &f)
+{
+    static const char hex[] = "0123456789abcdef";
+    BigIntT b = f.as_bigint();
+    std::string result;
+    for (mp_size_t i = kLimbs; i-- > 0;)
+    {
+        for (int shift = GMP_NUMB_BITS - 4; shift >= 0; shift -= 4)
+        {
+            unsigned d = (b.data[i] >> shift) & 15;
+            if (d != 0 || !result.empty())
+                result += hex[d];
+        }
+    }
+    if (result.empty())
+        return "0";
+    return result;
+}
+
+template<class F>
+void skFieldCodec<F>::ToBinary(const F &f, char *out)
+{
+    memcpy(out, f.mont_repr.data, kBinarySize);
+}
+
+template<class F>
+void skFieldCodec<F>::FromBinary(const char *in, F &f)
+{
+    memcpy(f.mont_repr.data, in, kBinarySize);
+}
+
+template<class F>
+bool skFieldCodec<F>::FromDecimal(const std::vector<std::string> &in, std::vector<F> &out)
+{
+    const size_t first = out.size();
+    out.resize(first + in.size());
+    bool ok = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&&:ok)
+#endif
+    for (size_t i = 0; i < in.size(); ++i)
+        ok = FromDecimal(in[i].data(), in[i].size(), out[first + i]) && ok;
+    return ok;
+}
+
+template<class F>
+bool skFieldCodec<F>::FromCanonicalDecimal(const std::vector<std::string> &in, std::vector<F> &out)
+{
+    const size_t first = out.size();
+    out.resize(first + in.size());
+    bool ok = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&&:ok)
+#endif
+    for (size_t i = 0; i < in.size(); ++i)
+        ok = FromCanonicalDecimal(in[i].data(), in[i].size(), out[first + i]) && ok;
+    return ok;
+}
+
+template<class F>
+void skFieldCodec<F>::ToDecimal(const std::vector<F> &in, std::vector<std::string> &out)
+{
+    const size_t first = out.size();
+    out.resize(first + in.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < in.size(); ++i)
+        out[first + i] = ToDecimal(in[i]);
+}
+
+template<class F>
+std::unordered_map<std::string, F> &skFieldCodec<F>::Interned()
+{
+    static std::unordered_map<std::string, F> interned;
+    return interned;
+}
+
+template<class F>
+const F &skFieldCodec<F>::InternHex(const char *str, bool negate)
+{
+    std::unordered_map<std::string, F> &interned = Interned();
+    std::string key = negate ? std::string("-") + str : std::string(str);
+    auto it = interned.find(key);
+    if (it != interned.end())
+        return it->second;
+    F f = FromHex(str);
+    if (negate)
+        f = -f;
+    return interned.emplace(key, f).first->second;
+}
+
+template<class F>
+void skFieldCodec<F>::ClearInterned()
+{
+    Interned().clear();
+}
+
+#endif
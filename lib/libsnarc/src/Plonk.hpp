@@ -0,0 +1,999 @@
+#ifndef PLONK_HPP_
+#define PLONK_HPP_
+
+#include "PlonkCircuit.hpp"
+#include "FieldCodec.hpp"
+#include "Trace.hpp"
+#include "json.hpp"
+
+#include <libff/algebra/curves/public_params.hpp>
+#include <libff/algebra/scalar_multiplication/multiexp.hpp>
+#include <sodium.h>
+
+#include <stdio.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+//PLONK proof system (Gabizon, Williamson, Ciobotaru, eprint 2019/953) over the rows of skPlonkCircuit, with:
+// - the custom gates of skPlonkCircuit (split, zerop) added to the gate constraint
+// - a log-derivative lookup argument (Haböck, eprint 2022/1530) for the dload, range and byte tables: the running sum phi
+//   steps by 1/(delta + w) on a lookup row and by -m/(delta + w) on a table row (m lookups), where
+//   w = tag + eta*a + eta^2*b + eta^3*c; it is a cycle over the domain iff every lookup is in the table of its tag
+// - KZG commitments over a universal structured reference string (powers of tau), shared by all circuits
+//   up to its size: the setup of a circuit only commits to its selectors and permutation.
+//Instead of the linearization of the paper, the proof opens every polynomial at zeta (and c, z, phi at
+//zeta*omega); it is a few field elements larger but the verifier is simpler.
+//The templates take a libff curve (public_params) with a pairing; skPlonkCurve reads and writes its points.
+
+//Encoding of the points of a curve, in skPlonk.cpp
+template<class ppT>
+struct skPlonkCurve
+{
+    static nlohmann::json ToJson(const libff::G1<ppT> &p);
+    static bool FromJson(const nlohmann::json &j, libff::G1<ppT> &p);
+    static nlohmann::json ToJson(const libff::G2<ppT> &p);
+    static bool FromJson(const nlohmann::json &j, libff::G2<ppT> &p);
+    //Raw affine coordinates, for the reference string
+    static void Write(std::ostream &out, const libff::G1<ppT> &p);
+    static bool Read(std::istream &in, libff::G1<ppT> &p);
+};
+
+//Number of coefficients of the committed polynomials beyond the size of the domain: the quotient has degree 3n + 5
+static const size_t kPlonkExtraPowers = 6;
+//Blinding of the committed polynomials: random multiples of the vanishing polynomial of the domain
+static const size_t kPlonkWireBlinding = 2;
+static const size_t kPlonkAccumulatorBlinding = 3;
+//Cosets of the domain on which the quotient is computed: its numerator has degree 4n + 5
+static const size_t kPlonkQuotientCosets = 8;
+
+//Multiplicative subgroup H of size n (a power of two) of F, and the polynomial transforms over its cosets
+template<class F>
+class skPlonkDomain
+{
+    public:
+    size_t size;
+    F omega, omegaInv, sizeInv;
+
+    explicit skPlonkDomain(size_t n);
+    //Coefficients (at most n) -> values on H, in place
+    void FFT(std::vector<F> &a) const;
+    //Values on H -> coefficients, in place
+    void IFFT(std::vector<F> &a) const;
+    //Values of the polynomial with coefficients 'coeffs' (any number) on the coset shift*H
+    std::vector<F> CosetValues(const std::vector<F> &coeffs, const F &shift) const;
+    //Coefficients of the polynomial whose values on the coset shift*H are a, in place
+    void CosetIFFT(std::vector<F> &a, const F &shift) const;
+
+    private:
+    void Transform(std::vector<F> &a, const F &root) const;
+};
+
+//Structured reference string: [tau^i]_1 for i < rows + kPlonkExtraPowers, [1]_2 and [tau]_2.
+//It does not depend on the circuit, so one string serves every circuit of up to 'rows' rows
+template<class ppT>
+struct skPlonkSrs
+{
+    std::vector<libff::G1<ppT>> g1;
+    libff::G2<ppT> g2, tauG2;
+
+    size_t MaxRows() const { return g1.size() < kPlonkExtraPowers ? 0 : g1.size() - kPlonkExtraPowers; }
+    //Generate a string for circuits of up to 'rows' rows from a local random tau, which is then dropped but not
+    //provably: this is not a ceremony, and is only meant for tests (see skPlonk::SetInsecureDevSrs)
+    void Generate(size_t rows);
+    bool Save(const std::string &fname) const;
+    bool Load(const std::string &fname);
+    //Commitment to the polynomial with coefficients 'coeffs'
+    libff::G1<ppT> Commit(const std::vector<libff::Fr<ppT>> &coeffs) const;
+};
+
+//Fixed polynomials of a circuit: the selectors and the permutation of the copy constraints, in coefficient form
+template<class F>
+struct skPlonkIndex
+{
+    typedef skPlonkCircuit<F> Circuit;
+    size_t n;
+    size_t numPublic;
+    //the coset shifts of the b and c columns in the permutation
+    F k1, k2;
+    std::vector<std::vector<F>> selectors;
+    std::vector<std::vector<F>> sigmas;
+    //values of the permutation on H, for the prover
+    std::vector<std::vector<F>> sigmaValues;
+
+    //n is the smallest power of two holding the rows (at least 8)
+    void Build(const Circuit &circuit);
+};
+
+//The verifier key: commitments to the fixed polynomials of the circuit, and [1]_2, [tau]_2 of the reference string
+template<class ppT>
+struct skPlonkVerifierKey
+{
+    size_t n;
+    size_t numPublic;
+    std::vector<libff::G1<ppT>> selectors;
+    std::vector<libff::G1<ppT>> sigmas;
+    libff::G2<ppT> g2, tauG2;
+    //digest of the circuit file, so that a proof is not made with the key of another circuit
+    std::string digest;
+    //rows of the circuit and by kind of gate, for the reports
+    nlohmann::json stats;
+
+    nlohmann::json ToJson() const;
+    bool FromJson(const nlohmann::json &j);
+};
+
+//A proof, with the public values of its circuit
+template<class ppT>
+struct skPlonkProof
+{
+    //commitments: a, b, c, m (lookup multiplicities), z (permutation), phi (lookup sum), the three parts of the quotient
+    enum Commitment { CA, CB, CC, CM, CZ, CPhi, CTLo, CTMid, CTHi, kCommitments };
+    std::vector<libff::G1<ppT>> commitments;
+    //values at zeta of the commitments then of the selectors and permutations of the key,
+    //and at zeta*omega of c, z and phi
+    std::vector<libff::Fr<ppT>> evals, shiftedEvals;
+    //opening proofs at zeta and zeta*omega
+    libff::G1<ppT> wZeta, wZetaOmega;
+    std::vector<libff::Fr<ppT>> publicValues;
+
+    nlohmann::json ToJson() const;
+    bool FromJson(const nlohmann::json &j);
+};
+
+//Prove the circuit, whose values have been computed; returns false if they do not satisfy it
+template<class ppT>
+bool PlonkProve(const skPlonkSrs<ppT> &srs, const skPlonkVerifierKey<ppT> &vk, const skPlonkIndex<libff::Fr<ppT>> &index,
+                const skPlonkCircuit<libff::Fr<ppT>> &circuit, skPlonkProof<ppT> &proof);
+template<class ppT>
+bool PlonkVerify(const skPlonkVerifierKey<ppT> &vk, const skPlonkProof<ppT> &proof);
+
+
+//Fiat-Shamir transcript (blake2b)
+template<class ppT>
+class skPlonkTranscript
+{
+    public:
+    typedef libff::Fr<ppT> F;
+
+    skPlonkTranscript()
+    {
+        crypto_generichash_init(&state, NULL, 0, crypto_generichash_BYTES_MAX);
+        Absorb("isekai-plonk");
+    }
+
+    void Absorb(const std::string &s)
+    {
+        unsigned long long size = s.size();
+        crypto_generichash_update(&state, reinterpret_cast<const unsigned char *>(&size), sizeof size);
+        crypto_generichash_update(&state, reinterpret_cast<const unsigned char *>(s.data()), s.size());
+    }
+    void Absorb(const F &f) { Absorb(skFieldCodec<F>::ToHex(f)); }
+    void Absorb(const libff::G1<ppT> &p) { Absorb(skPlonkCurve<ppT>::ToJson(p).dump()); }
+
+    //A challenge depending on everything absorbed so far; it is absorbed as well
+    F Challenge(const std::string &label)
+    {
+        Absorb(label);
+        crypto_generichash_state copy = state;
+        unsigned char hash[crypto_generichash_BYTES_MAX];
+        crypto_generichash_final(&copy, hash, sizeof hash);
+        //248 bits, below the characteristic of the fields of the curves (~254 bits)
+        static const char hex[] = "0123456789abcdef";
+        std::string digits;
+        for (size_t i = 0; i < 31; ++i)
+        {
+            digits += hex[hash[i] >> 4];
+            digits += hex[hash[i] & 15];
+        }
+        F f = skFieldCodec<F>::FromHex(digits.c_str());
+        Absorb(f);
+        return f;
+    }
+
+    private:
+    crypto_generichash_state state;
+};
+
+
+template<class F>
+skPlonkDomain<F>::skPlonkDomain(size_t n) : size(n)
+{
+    size_t logn = 0;
+    while ((size_t(1) << logn) < n)
+        ++logn;
+    omega = F::root_of_unity;
+    for (size_t i = logn; i < F::s; ++i)
+        omega = omega.squared();
+    omegaInv = omega.inverse();
+    sizeInv = F(static_cast<long>(n)).inverse();
+}
+
+template<class F>
+void skPlonkDomain<F>::Transform(std::vector<F> &a, const F &root) const
+{
+    const size_t n = size;
+    a.resize(n, F::zero());
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(a[i], a[j]);
+    }
+    std::vector<F> twiddles;
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const size_t half = len / 2;
+        F step = root ^ static_cast<unsigned long>(n / len);
+        twiddles.resize(half);
+        twiddles[0] = F::one();
+        for (size_t j = 1; j < half; ++j)
+            twiddles[j] = twiddles[j - 1] * step;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t i = 0; i < n; i += len)
+        {
+            for (size_t j = 0; j < half; ++j)
+            {
+                F u = a[i + j];
+                F v = a[i + j + half] * twiddles[j];
+                a[i + j] = u + v;
+                a[i + j + half] = u - v;
+            }
+        }
+    }
+}
+
+template<class F>
+void skPlonkDomain<F>::FFT(std::vector<F> &a) const
+{
+    Transform(a, omega);
+}
+
+template<class F>
+void skPlonkDomain<F>::IFFT(std::vector<F> &a) const
+{
+    Transform(a, omegaInv);
+    for (F &x : a)
+        x *= sizeInv;
+}
+
+template<class F>
+std::vector<F> skPlonkDomain<F>::CosetValues(const std::vector<F> &coeffs, const F &shift) const
+{
+    //x^n is the constant shift^n on the coset, which folds the coefficients beyond n
+    std::vector<F> a(size, F::zero());
+    const F shiftN = shift ^ static_cast<unsigned long>(size);
+    F power = F::one();
+    for (size_t i = 0; i < coeffs.size(); i += size)
+    {
+        for (size_t j = i; j < coeffs.size() && j < i + size; ++j)
+            a[j - i] += power * coeffs[j];
+        power *= shiftN;
+    }
+    F s = F::one();
+    for (size_t i = 0; i < size; ++i)
+    {
+        a[i] *= s;
+        s *= shift;
+    }
+    FFT(a);
+    return a;
+}
+
+template<class F>
+void skPlonkDomain<F>::CosetIFFT(std::vector<F> &a, const F &shift) const
+{
+    IFFT(a);
+    const F inv = shift.inverse();
+    F s = F::one();
+    for (size_t i = 0; i < size; ++i)
+    {
+        a[i] *= s;
+        s *= inv;
+    }
+}
+
+//Value of a polynomial at x
+template<class F>
+F PlonkEvaluate(const std::vector<F> &coeffs, const F &x)
+{
+    F result = F::zero();
+    for (size_t i = coeffs.size(); i-- > 0;)
+        result = result * x + coeffs[i];
+    return result;
+}
+
+//p := (p - p(z)) / (X - z)
+template<class F>
+void PlonkDivideLinear(std::vector<F> &p, const F &z)
+{
+    F carry = F::zero();
+    for (size_t i = p.size(); i-- > 0;)
+    {
+        F c = p[i] + carry * z;
+        p[i] = carry;
+        carry = c;
+    }
+}
+
+//Adds a random multiple of X^n - 1 of degree < n + k
+template<class F>
+void PlonkBlind(std::vector<F> &coeffs, size_t n, size_t k)
+{
+    coeffs.resize(std::max(coeffs.size(), n + k), F::zero());
+    for (size_t i = 0; i < k; ++i)
+    {
+        F b = F::random_element();
+        coeffs[i] -= b;
+        coeffs[n + i] += b;
+    }
+}
+
+//Inverts the (non-zero) elements of v in place, with one inversion
+template<class F>
+void PlonkBatchInvert(std::vector<F> &v)
+{
+    std::vector<F> prefix(v.size());
+    F acc = F::one();
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        prefix[i] = acc;
+        acc *= v[i];
+    }
+    acc = acc.inverse();
+    for (size_t i = v.size(); i-- > 0;)
+    {
+        F inv = acc * prefix[i];
+        acc *= v[i];
+        v[i] = inv;
+    }
+}
+
+
+template<class ppT>
+void skPlonkSrs<ppT>::Generate(size_t rows)
+{
+    typedef libff::Fr<ppT> F;
+    skTrace::Span span("srs");
+    const F tau = F::random_element();
+    std::vector<F> powers(rows + kPlonkExtraPowers);
+    F power = F::one();
+    for (F &p : powers)
+    {
+        p = power;
+        power *= tau;
+    }
+    const size_t window = libff::get_exp_window_size<libff::G1<ppT>>(powers.size());
+    libff::window_table<libff::G1<ppT>> table = libff::get_window_table(F::size_in_bits(), window, libff::G1<ppT>::one());
+    g1 = libff::batch_exp(F::size_in_bits(), window, table, powers);
+    libff::batch_to_special(g1);
+    g2 = libff::G2<ppT>::one();
+    tauG2 = tau * g2;
+    skTrace::Count("powers", g1.size());
+}
+
+static const char kPlonkSrsMagic[] = "isekai-plonk-srs";
+
+template<class ppT>
+bool skPlonkSrs<ppT>::Save(const std::string &fname) const
+{
+    std::ofstream out(fname, std::ios::binary);
+    out.write(kPlonkSrsMagic, sizeof kPlonkSrsMagic);
+    unsigned long long count = g1.size();
+    out.write(reinterpret_cast<const char *>(&count), sizeof count);
+    std::string g2s = skPlonkCurve<ppT>::ToJson(g2).dump() + "\n" + skPlonkCurve<ppT>::ToJson(tauG2).dump() + "\n";
+    out << g2s;
+    for (const libff::G1<ppT> &p : g1)
+        skPlonkCurve<ppT>::Write(out, p);
+    return out.good();
+}
+
+template<class ppT>
+bool skPlonkSrs<ppT>::Load(const std::string &fname)
+{
+    std::ifstream in(fname, std::ios::binary);
+    char magic[sizeof kPlonkSrsMagic];
+    unsigned long long count;
+    if (!in.read(magic, sizeof magic) || std::string(magic) != kPlonkSrsMagic
+        || !in.read(reinterpret_cast<char *>(&count), sizeof count))
+        return false;
+    std::string line;
+    if (!std::getline(in, line) || !skPlonkCurve<ppT>::FromJson(nlohmann::json::parse(line, nullptr, false), g2)
+        || !std::getline(in, line) || !skPlonkCurve<ppT>::FromJson(nlohmann::json::parse(line, nullptr, false), tauG2))
+        return false;
+    g1.resize(count);
+    for (libff::G1<ppT> &p : g1)
+        if (!skPlonkCurve<ppT>::Read(in, p))
+            return false;
+    return true;
+}
+
+template<class ppT>
+libff::G1<ppT> skPlonkSrs<ppT>::Commit(const std::vector<libff::Fr<ppT>> &coeffs) const
+{
+    typedef libff::Fr<ppT> F;
+    size_t chunks = 1;
+#ifdef MULTICORE
+    chunks = omp_get_max_threads();
+#endif
+    if (coeffs.empty())
+        return libff::G1<ppT>::zero();
+    return libff::multi_exp<libff::G1<ppT>, F, libff::multi_exp_method_BDLO12>(
+        g1.begin(), g1.begin() + coeffs.size(), coeffs.begin(), coeffs.end(), chunks);
+}
+
+
+template<class F>
+void skPlonkIndex<F>::Build(const Circuit &circuit)
+{
+    const auto &rows = circuit.Rows();
+    n = 8;
+    while (n < rows.size())
+        n <<= 1;
+    numPublic = circuit.NumPublic();
+    skPlonkDomain<F> domain(n);
+    k1 = F::multiplicative_generator;
+    k2 = k1.squared();
+
+    selectors.assign(Circuit::kSelectors, std::vector<F>(n, F::zero()));
+    for (size_t i = 0; i < rows.size(); ++i)
+        for (int q = 0; q < Circuit::kSelectors; ++q)
+            selectors[q][i] = rows[i].q[q];
+    for (auto &s : selectors)
+        domain.IFFT(s);
+
+    //sigma maps each cell to the next cell holding the same variable; cell (i, col) is K[col] * omega^i
+    std::vector<F> powers(n);
+    powers[0] = F::one();
+    for (size_t i = 1; i < n; ++i)
+        powers[i] = powers[i - 1] * domain.omega;
+    const F K[Circuit::kColumns] = { F::one(), k1, k2 };
+    sigmaValues.assign(Circuit::kColumns, std::vector<F>(n));
+    for (int col = 0; col < Circuit::kColumns; ++col)
+        for (size_t i = 0; i < n; ++i)
+            sigmaValues[col][i] = K[col] * powers[i];
+    std::vector<long long> last(circuit.NumVars(), -1), first(circuit.NumVars(), -1);
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        for (int col = 0; col < Circuit::kColumns; ++col)
+        {
+            typename Circuit::Var v = rows[i].cell[col];
+            if (v == Circuit::kNone)
+                continue;
+            long long cell = col * (long long)n + i;
+            if (last[v] >= 0)
+                sigmaValues[last[v] / n][last[v] % n] = K[col] * powers[i];
+            else
+                first[v] = cell;
+            last[v] = cell;
+        }
+    }
+    for (size_t v = 0; v < first.size(); ++v)
+        if (first[v] >= 0)
+            sigmaValues[last[v] / n][last[v] % n] = K[first[v] / n] * powers[first[v] % n];
+    sigmas = sigmaValues;
+    for (auto &s : sigmas)
+        domain.IFFT(s);
+}
+
+
+template<class ppT>
+nlohmann::json skPlonkVerifierKey<ppT>::ToJson() const
+{
+    nlohmann::json j;
+    j["type"] = "plonk";
+    j["n"] = n;
+    j["public"] = numPublic;
+    j["digest"] = digest;
+    j["stats"] = stats;
+    for (const auto &c : selectors)
+        j["selectors"].push_back(skPlonkCurve<ppT>::ToJson(c));
+    for (const auto &c : sigmas)
+        j["sigmas"].push_back(skPlonkCurve<ppT>::ToJson(c));
+    j["g2"] = skPlonkCurve<ppT>::ToJson(g2);
+    j["tau_g2"] = skPlonkCurve<ppT>::ToJson(tauG2);
+    return j;
+}
+
+template<class ppT>
+bool skPlonkVerifierKey<ppT>::FromJson(const nlohmann::json &j)
+{
+    typedef skPlonkCircuit<libff::Fr<ppT>> Circuit;
+    if (!j.is_object() || j.value("type", "") != "plonk" || !j["selectors"].is_array() || !j["sigmas"].is_array()
+        || j["selectors"].size() != Circuit::kSelectors || j["sigmas"].size() != Circuit::kColumns)
+        return false;
+    n = j["n"];
+    numPublic = j["public"];
+    digest = j.value("digest", "");
+    stats = j.value("stats", nlohmann::json::object());
+    selectors.resize(Circuit::kSelectors);
+    sigmas.resize(Circuit::kColumns);
+    for (size_t i = 0; i < selectors.size(); ++i)
+        if (!skPlonkCurve<ppT>::FromJson(j["selectors"][i], selectors[i]))
+            return false;
+    for (size_t i = 0; i < sigmas.size(); ++i)
+        if (!skPlonkCurve<ppT>::FromJson(j["sigmas"][i], sigmas[i]))
+            return false;
+    return skPlonkCurve<ppT>::FromJson(j["g2"], g2) && skPlonkCurve<ppT>::FromJson(j["tau_g2"], tauG2);
+}
+
+template<class ppT>
+nlohmann::json skPlonkProof<ppT>::ToJson() const
+{
+    typedef libff::Fr<ppT> F;
+    nlohmann::json j;
+    j["type"] = "plonk";
+    for (const auto &c : commitments)
+        j["commitments"].push_back(skPlonkCurve<ppT>::ToJson(c));
+    for (const F &e : evals)
+        j["evals"].push_back(skFieldCodec<F>::ToDecimal(e));
+    for (const F &e : shiftedEvals)
+        j["shifted_evals"].push_back(skFieldCodec<F>::ToDecimal(e));
+    j["w_zeta"] = skPlonkCurve<ppT>::ToJson(wZeta);
+    j["w_zeta_omega"] = skPlonkCurve<ppT>::ToJson(wZetaOmega);
+    j["public"] = nlohmann::json::array();
+    for (const F &e : publicValues)
+        j["public"].push_back(skFieldCodec<F>::ToDecimal(e));
+    return j;
+}
+
+template<class ppT>
+bool skPlonkProof<ppT>::FromJson(const nlohmann::json &j)
+{
+    typedef libff::Fr<ppT> F;
+    if (!j.is_object() || j.value("type", "") != "plonk" || !j["commitments"].is_array() || !j["evals"].is_array()
+        || !j["shifted_evals"].is_array() || !j["public"].is_array())
+        return false;
+    commitments.resize(j["commitments"].size());
+    for (size_t i = 0; i < commitments.size(); ++i)
+        if (!skPlonkCurve<ppT>::FromJson(j["commitments"][i], commitments[i]))
+            return false;
+    std::vector<std::string> strs;
+    evals.clear();
+    shiftedEvals.clear();
+    publicValues.clear();
+    strs = j["evals"].get<std::vector<std::string>>();
+    if (!skFieldCodec<F>::FromDecimal(strs, evals))
+        return false;
+    strs = j["shifted_evals"].get<std::vector<std::string>>();
+    if (!skFieldCodec<F>::FromDecimal(strs, shiftedEvals))
+        return false;
+    strs = j["public"].get<std::vector<std::string>>();
+    if (!skFieldCodec<F>::FromDecimal(strs, publicValues))
+        return false;
+    return skPlonkCurve<ppT>::FromJson(j["w_zeta"], wZeta) && skPlonkCurve<ppT>::FromJson(j["w_zeta_omega"], wZetaOmega);
+}
+
+
+//The challenges, drawn in the same order by the prover and the verifier
+template<class F>
+struct skPlonkChallenges
+{
+    F beta, gamma, eta, delta, alpha, zeta, v, u;
+};
+
+template<class ppT>
+void PlonkStartTranscript(skPlonkTranscript<ppT> &transcript, const skPlonkVerifierKey<ppT> &vk, const std::vector<libff::Fr<ppT>> &publicValues)
+{
+    transcript.Absorb(vk.ToJson().dump());
+    for (const auto &x : publicValues)
+        transcript.Absorb(x);
+}
+
+//Sum of the constraints at one point, with the powers of alpha:
+//gate, split (3), zerop (2), permutation, start of the permutation, lookup
+template<class F>
+struct skPlonkPoint
+{
+    F a, b, c, m, z, phi;
+    F cNext, zNext, phiNext;
+    F q[skPlonkCircuit<F>::kSelectors];
+    F sigma[skPlonkCircuit<F>::kColumns];
+    F x, pi, l1;
+
+    F Constraints(const skPlonkChallenges<F> &ch, const F &k1, const F &k2) const
+    {
+        typedef skPlonkCircuit<F> Circuit;
+        const F one = F::one(), two = F(2), four = F(4);
+        F terms[9];
+        terms[0] = q[Circuit::QL] * a + q[Circuit::QR] * b + q[Circuit::QO] * c + q[Circuit::QM] * a * b + q[Circuit::QC] + pi;
+        terms[1] = q[Circuit::QSplit] * a * (a - one);
+        terms[2] = q[Circuit::QSplit] * b * (b - one);
+        terms[3] = q[Circuit::QSplit] * (cNext - four * c - two * a - b);
+        terms[4] = q[Circuit::QZerop] * (a * b - c);
+        terms[5] = q[Circuit::QZerop] * a * (one - c);
+        const F bx = ch.beta * x;
+        terms[6] = z * (a + bx + ch.gamma) * (b + k1 * bx + ch.gamma) * (c + k2 * bx + ch.gamma)
+                 - zNext * (a + ch.beta * sigma[0] + ch.gamma) * (b + ch.beta * sigma[1] + ch.gamma) * (c + ch.beta * sigma[2] + ch.gamma);
+        terms[7] = l1 * (z - one);
+        terms[8] = (phiNext - phi) * (ch.delta + q[Circuit::QTag] + ch.eta * (a + ch.eta * (b + ch.eta * c)))
+                 - (q[Circuit::QLookup] - q[Circuit::QTable] * m);
+        F sum = F::zero();
+        for (int i = 8; i >= 0; --i)
+            sum = sum * ch.alpha + terms[i];
+        return sum;
+    }
+};
+
+template<class ppT>
+bool PlonkProve(const skPlonkSrs<ppT> &srs, const skPlonkVerifierKey<ppT> &vk, const skPlonkIndex<libff::Fr<ppT>> &index,
+                const skPlonkCircuit<libff::Fr<ppT>> &circuit, skPlonkProof<ppT> &proof)
+{
+    typedef libff::Fr<ppT> F;
+    typedef skPlonkCircuit<F> Circuit;
+    const size_t n = index.n;
+    if (srs.MaxRows() < n)
+    {
+        printf("the reference string is too small for %lu rows\n", (unsigned long)n);
+        return false;
+    }
+    long long bad = circuit.FirstUnsatisfied();
+    if (bad >= 0)
+    {
+        printf("NOT SATISFIED: row %lld\n", bad);
+        return false;
+    }
+    skPlonkDomain<F> domain(n);
+    const auto &rows = circuit.Rows();
+    skPlonkTranscript<ppT> transcript;
+    skPlonkChallenges<F> ch;
+    proof.publicValues = circuit.PublicValues();
+    PlonkStartTranscript(transcript, vk, proof.publicValues);
+    proof.commitments.assign(skPlonkProof<ppT>::kCommitments, libff::G1<ppT>::zero());
+
+    //round 1: the columns and the lookup multiplicities
+    std::vector<std::vector<F>> values(Circuit::kColumns, std::vector<F>(n, F::zero()));
+    std::vector<F> mValues(n, F::zero());
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        for (int col = 0; col < Circuit::kColumns; ++col)
+            values[col][i] = circuit.Value(i, col);
+        mValues[i] = circuit.Multiplicities()[i];
+    }
+    std::vector<std::vector<F>> polys(skPlonkProof<ppT>::kCommitments);
+    {
+        skTrace::Span span("plonk.wires");
+        for (int col = 0; col < Circuit::kColumns; ++col)
+            polys[col] = values[col];
+        polys[skPlonkProof<ppT>::CM] = mValues;
+        for (int p = skPlonkProof<ppT>::CA; p <= skPlonkProof<ppT>::CM; ++p)
+        {
+            domain.IFFT(polys[p]);
+            PlonkBlind(polys[p], n, kPlonkWireBlinding);
+            proof.commitments[p] = srs.Commit(polys[p]);
+            transcript.Absorb(proof.commitments[p]);
+        }
+    }
+    ch.beta = transcript.Challenge("beta");
+    ch.gamma = transcript.Challenge("gamma");
+    ch.eta = transcript.Challenge("eta");
+    ch.delta = transcript.Challenge("delta");
+
+    //round 2: the permutation accumulator z and the lookup running sum phi
+    {
+        skTrace::Span span("plonk.accumulators");
+        std::vector<F> num(n), den(n), lookupDen(n);
+        const F K[Circuit::kColumns] = { F::one(), index.k1, index.k2 };
+        F x = F::one();
+        for (size_t i = 0; i < n; ++i)
+        {
+            num[i] = F::one();
+            den[i] = F::one();
+            for (int col = 0; col < Circuit::kColumns; ++col)
+            {
+                num[i] *= values[col][i] + ch.beta * K[col] * x + ch.gamma;
+                den[i] *= values[col][i] + ch.beta * index.sigmaValues[col][i] + ch.gamma;
+            }
+            x *= domain.omega;
+        }
+        PlonkBatchInvert(den);
+        std::vector<F> tags = index.selectors[Circuit::QTag], lookups = index.selectors[Circuit::QLookup], tables = index.selectors[Circuit::QTable];
+        domain.FFT(tags);
+        domain.FFT(lookups);
+        domain.FFT(tables);
+        for (size_t i = 0; i < n; ++i)
+            lookupDen[i] = ch.delta + tags[i] + ch.eta * (values[Circuit::A][i] + ch.eta * (values[Circuit::B][i] + ch.eta * values[Circuit::C][i]));
+        PlonkBatchInvert(lookupDen);
+        std::vector<F> &z = polys[skPlonkProof<ppT>::CZ];
+        std::vector<F> &phi = polys[skPlonkProof<ppT>::CPhi];
+        z.assign(n, F::zero());
+        phi.assign(n, F::zero());
+        F zAcc = F::one(), phiAcc = F::zero();
+        for (size_t i = 0; i < n; ++i)
+        {
+            z[i] = zAcc;
+            phi[i] = phiAcc;
+            zAcc *= num[i] * den[i];
+            phiAcc += (lookups[i] - tables[i] * mValues[i]) * lookupDen[i];
+        }
+        if (!(zAcc == F::one()))
+        {
+            printf("the copy constraints do not hold\n");
+            return false;
+        }
+        if (!phiAcc.is_zero())
+        {
+            printf("a lookup is not in its table\n");
+            return false;
+        }
+        for (int p = skPlonkProof<ppT>::CZ; p <= skPlonkProof<ppT>::CPhi; ++p)
+        {
+            domain.IFFT(polys[p]);
+            PlonkBlind(polys[p], n, kPlonkAccumulatorBlinding);
+            proof.commitments[p] = srs.Commit(polys[p]);
+            transcript.Absorb(proof.commitments[p]);
+        }
+    }
+    ch.alpha = transcript.Challenge("alpha");
+
+    //round 3: the quotient t = constraints / (X^n - 1), on kPlonkQuotientCosets cosets of H, each of size n
+    {
+        skTrace::Span span("plonk.quotient");
+        const size_t big = kPlonkQuotientCosets * n;
+        skPlonkDomain<F> bigDomain(big);
+        const F g = F::multiplicative_generator;
+        std::vector<F> piCoeffs(n, F::zero());
+        for (size_t i = 0; i < proof.publicValues.size(); ++i)
+            piCoeffs[i] = -proof.publicValues[i];
+        domain.IFFT(piCoeffs);
+        std::vector<F> t(big);
+        for (size_t j = 0; j < kPlonkQuotientCosets; ++j)
+        {
+            //coset g * omega_big^j * H; its point i is g * omega_big^(j + 8i), the index in the big coset
+            const F shift = g * (bigDomain.omega ^ static_cast<unsigned long>(j));
+            std::vector<std::vector<F>> p(skPlonkProof<ppT>::CPhi + 1);
+            for (int k = skPlonkProof<ppT>::CA; k <= skPlonkProof<ppT>::CPhi; ++k)
+                p[k] = domain.CosetValues(polys[k], shift);
+            std::vector<std::vector<F>> q(Circuit::kSelectors), s(Circuit::kColumns);
+            for (int k = 0; k < Circuit::kSelectors; ++k)
+                q[k] = domain.CosetValues(index.selectors[k], shift);
+            for (int k = 0; k < Circuit::kColumns; ++k)
+                s[k] = domain.CosetValues(index.sigmas[k], shift);
+            std::vector<F> pi = domain.CosetValues(piCoeffs, shift);
+            //x^n - 1 is constant on the coset; L1(x) = (x^n - 1) / (n (x - 1))
+            const F zh = (shift ^ static_cast<unsigned long>(n)) - F::one();
+            const F zhInv = zh.inverse();
+            std::vector<F> l1(n);
+            F x = shift;
+            for (size_t i = 0; i < n; ++i)
+            {
+                l1[i] = F(static_cast<long>(n)) * (x - F::one());
+                x *= domain.omega;
+            }
+            PlonkBatchInvert(l1);
+            x = shift;
+            for (size_t i = 0; i < n; ++i)
+            {
+                const size_t next = (i + 1) % n;
+                skPlonkPoint<F> pt;
+                pt.a = p[skPlonkProof<ppT>::CA][i];
+                pt.b = p[skPlonkProof<ppT>::CB][i];
+                pt.c = p[skPlonkProof<ppT>::CC][i];
+                pt.m = p[skPlonkProof<ppT>::CM][i];
+                pt.z = p[skPlonkProof<ppT>::CZ][i];
+                pt.phi = p[skPlonkProof<ppT>::CPhi][i];
+                pt.cNext = p[skPlonkProof<ppT>::CC][next];
+                pt.zNext = p[skPlonkProof<ppT>::CZ][next];
+                pt.phiNext = p[skPlonkProof<ppT>::CPhi][next];
+                for (int k = 0; k < Circuit::kSelectors; ++k)
+                    pt.q[k] = q[k][i];
+                for (int k = 0; k < Circuit::kColumns; ++k)
+                    pt.sigma[k] = s[k][i];
+                pt.x = x;
+                pt.pi = pi[i];
+                pt.l1 = zh * l1[i];
+                t[j + kPlonkQuotientCosets * i] = pt.Constraints(ch, index.k1, index.k2) * zhInv;
+                x *= domain.omega;
+            }
+        }
+        bigDomain.CosetIFFT(t, g);
+        for (size_t i = 3 * n + kPlonkExtraPowers; i < big; ++i)
+        {
+            if (!t[i].is_zero())
+            {
+                printf("the quotient has a degree over 3n + 5: the constraints do not hold\n");
+                return false;
+            }
+        }
+        //t = t_lo + X^n t_mid + X^2n t_hi, blinded by b1 X^n - b1 in lo/mid and b2 X^n - b2 in mid/hi
+        std::vector<F> &lo = polys[skPlonkProof<ppT>::CTLo], &mid = polys[skPlonkProof<ppT>::CTMid], &hi = polys[skPlonkProof<ppT>::CTHi];
+        lo.assign(t.begin(), t.begin() + n);
+        mid.assign(t.begin() + n, t.begin() + 2 * n);
+        hi.assign(t.begin() + 2 * n, t.begin() + 3 * n + kPlonkExtraPowers);
+        const F b1 = F::random_element(), b2 = F::random_element();
+        lo.push_back(b1);
+        mid[0] -= b1;
+        mid.push_back(b2);
+        hi[0] -= b2;
+        for (int k = skPlonkProof<ppT>::CTLo; k <= skPlonkProof<ppT>::CTHi; ++k)
+        {
+            proof.commitments[k] = srs.Commit(polys[k]);
+            transcript.Absorb(proof.commitments[k]);
+        }
+    }
+    ch.zeta = transcript.Challenge("zeta");
+
+    //round 4: the values at zeta and zeta * omega
+    const F zetaOmega = ch.zeta * domain.omega;
+    std::vector<const std::vector<F> *> opened;
+    for (const auto &p : polys)
+        opened.push_back(&p);
+    for (const auto &p : index.selectors)
+        opened.push_back(&p);
+    for (const auto &p : index.sigmas)
+        opened.push_back(&p);
+    const std::vector<F> *shifted[3] = { &polys[skPlonkProof<ppT>::CC], &polys[skPlonkProof<ppT>::CZ], &polys[skPlonkProof<ppT>::CPhi] };
+    proof.evals.resize(opened.size());
+    for (size_t i = 0; i < opened.size(); ++i)
+    {
+        proof.evals[i] = PlonkEvaluate(*opened[i], ch.zeta);
+        transcript.Absorb(proof.evals[i]);
+    }
+    proof.shiftedEvals.resize(3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        proof.shiftedEvals[i] = PlonkEvaluate(*shifted[i], zetaOmega);
+        transcript.Absorb(proof.shiftedEvals[i]);
+    }
+    ch.v = transcript.Challenge("v");
+
+    //round 5: the batched openings
+    {
+        skTrace::Span span("plonk.open");
+        std::vector<F> w(n + kPlonkExtraPowers, F::zero());
+        F power = F::one();
+        for (size_t i = 0; i < opened.size(); ++i)
+        {
+            for (size_t k = 0; k < opened[i]->size(); ++k)
+                w[k] += power * (*opened[i])[k];
+            power *= ch.v;
+        }
+        PlonkDivideLinear(w, ch.zeta);
+        proof.wZeta = srs.Commit(w);
+        w.assign(n + kPlonkExtraPowers, F::zero());
+        power = F::one();
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t k = 0; k < shifted[i]->size(); ++k)
+                w[k] += power * (*shifted[i])[k];
+            power *= ch.v;
+        }
+        PlonkDivideLinear(w, zetaOmega);
+        proof.wZetaOmega = srs.Commit(w);
+    }
+    skTrace::Count("rows", rows.size());
+    skTrace::Count("domain", n);
+    return true;
+}
+
+template<class ppT>
+bool PlonkVerify(const skPlonkVerifierKey<ppT> &vk, const skPlonkProof<ppT> &proof)
+{
+    typedef libff::Fr<ppT> F;
+    typedef libff::G1<ppT> G1;
+    typedef skPlonkCircuit<F> Circuit;
+    typedef skPlonkProof<ppT> Proof;
+    const size_t numOpened = Proof::kCommitments + Circuit::kSelectors + Circuit::kColumns;
+    if (proof.commitments.size() != Proof::kCommitments || proof.evals.size() != numOpened
+        || proof.shiftedEvals.size() != 3 || proof.publicValues.size() != vk.numPublic || vk.numPublic > vk.n)
+    {
+        printf("the proof does not match the key\n");
+        return false;
+    }
+    const size_t n = vk.n;
+    skPlonkDomain<F> domain(n);
+    skPlonkTranscript<ppT> transcript;
+    skPlonkChallenges<F> ch;
+    PlonkStartTranscript(transcript, vk, proof.publicValues);
+    for (int p = Proof::CA; p <= Proof::CM; ++p)
+        transcript.Absorb(proof.commitments[p]);
+    ch.beta = transcript.Challenge("beta");
+    ch.gamma = transcript.Challenge("gamma");
+    ch.eta = transcript.Challenge("eta");
+    ch.delta = transcript.Challenge("delta");
+    for (int p = Proof::CZ; p <= Proof::CPhi; ++p)
+        transcript.Absorb(proof.commitments[p]);
+    ch.alpha = transcript.Challenge("alpha");
+    for (int p = Proof::CTLo; p <= Proof::CTHi; ++p)
+        transcript.Absorb(proof.commitments[p]);
+    ch.zeta = transcript.Challenge("zeta");
+    for (const F &e : proof.evals)
+        transcript.Absorb(e);
+    for (const F &e : proof.shiftedEvals)
+        transcript.Absorb(e);
+    ch.v = transcript.Challenge("v");
+    transcript.Absorb(proof.wZeta);
+    transcript.Absorb(proof.wZetaOmega);
+    ch.u = transcript.Challenge("u");
+
+    //the constraints at zeta are t(zeta) * (zeta^n - 1)
+    const F zetaN = ch.zeta ^ static_cast<unsigned long>(n);
+    const F zh = zetaN - F::one();
+    if (zh.is_zero())
+        return false;
+    const F nInv = domain.sizeInv;
+    //L_i(zeta) = omega^i (zeta^n - 1) / (n (zeta - omega^i))
+    std::vector<F> den(std::max<size_t>(vk.numPublic, 1));
+    F w = F::one();
+    for (size_t i = 0; i < den.size(); ++i)
+    {
+        den[i] = ch.zeta - w;
+        w *= domain.omega;
+    }
+    PlonkBatchInvert(den);
+    skPlonkPoint<F> pt;
+    pt.pi = F::zero();
+    w = F::one();
+    for (size_t i = 0; i < vk.numPublic; ++i)
+    {
+        pt.pi -= proof.publicValues[i] * w * zh * nInv * den[i];
+        w *= domain.omega;
+    }
+    pt.l1 = zh * nInv * den[0];
+    pt.a = proof.evals[Proof::CA];
+    pt.b = proof.evals[Proof::CB];
+    pt.c = proof.evals[Proof::CC];
+    pt.m = proof.evals[Proof::CM];
+    pt.z = proof.evals[Proof::CZ];
+    pt.phi = proof.evals[Proof::CPhi];
+    pt.cNext = proof.shiftedEvals[0];
+    pt.zNext = proof.shiftedEvals[1];
+    pt.phiNext = proof.shiftedEvals[2];
+    for (int k = 0; k < Circuit::kSelectors; ++k)
+        pt.q[k] = proof.evals[Proof::kCommitments + k];
+    for (int k = 0; k < Circuit::kColumns; ++k)
+        pt.sigma[k] = proof.evals[Proof::kCommitments + Circuit::kSelectors + k];
+    pt.x = ch.zeta;
+    const F k1 = F::multiplicative_generator, k2 = k1.squared();
+    const F t = proof.evals[Proof::CTLo] + zetaN * proof.evals[Proof::CTMid] + zetaN.squared() * proof.evals[Proof::CTHi];
+    if (!(pt.Constraints(ch, k1, k2) == t * zh))
+    {
+        printf("the constraints do not hold at zeta\n");
+        return false;
+    }
+
+    //batched KZG openings: e(W + u W', [tau]) = e(zeta W + u zeta omega W' + F + u F' - (E + u E') [1], [1])
+    std::vector<G1> points;
+    std::vector<F> scalars;
+    points.insert(points.end(), proof.commitments.begin(), proof.commitments.end());
+    points.insert(points.end(), vk.selectors.begin(), vk.selectors.end());
+    points.insert(points.end(), vk.sigmas.begin(), vk.sigmas.end());
+    F power = F::one(), e = F::zero();
+    for (size_t i = 0; i < numOpened; ++i)
+    {
+        scalars.push_back(power);
+        e += power * proof.evals[i];
+        power *= ch.v;
+    }
+    const int shifted[3] = { Proof::CC, Proof::CZ, Proof::CPhi };
+    power = ch.u;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        scalars[shifted[i]] += power;
+        e += power * proof.shiftedEvals[i];
+        power *= ch.v;
+    }
+    points.push_back(proof.wZeta);
+    scalars.push_back(ch.zeta);
+    points.push_back(proof.wZetaOmega);
+    scalars.push_back(ch.u * ch.zeta * domain.omega);
+    points.push_back(G1::one());
+    scalars.push_back(-e);
+    const G1 right = libff::multi_exp<G1, F, libff::multi_exp_method_BDLO12>(points.begin(), points.end(), scalars.begin(), scalars.end(), 1);
+    const G1 left = proof.wZeta + ch.u * proof.wZetaOmega;
+    const bool ok = ppT::reduced_pairing(left, vk.tauG2) == ppT::reduced_pairing(right, vk.g2);
+    if (!ok)
+        printf("the openings do not hold\n");
+    return ok;
+}
+
+#endif
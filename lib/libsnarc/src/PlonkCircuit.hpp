@@ -0,0 +1,1371 @@
+#ifndef PLONK_CIRCUIT_HPP_
+#define PLONK_CIRCUIT_HPP_
+
+#include "FieldCodec.hpp"
+#include "Trace.hpp"
+
+#include <gmp.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//PLONKish arithmetization of an arithmetic circuit in Pinocchio/jsnark format (.arith), for skPlonk.
+//Each row has three cells a, b, c and satisfies the arithmetic gate
+//  qL*a + qR*b + qO*c + qM*a*b + qC (- the public value, on the first rows) = 0
+//and the custom gates that its selectors enable:
+//  split   a and b are bits, and the c cell of the next row is 4*c + 2*a + b. A w-bit split takes
+//          w/2 + 2 rows (instead of the w + 1 constraints of R1CS)
+//  zerop   c = a*b and a*(1 - c) = 0, so that with b the inverse of a, c says whether a is non-zero
+//  lookup  (tag, a, b, c) is a row of the table with the same tag. The table of a dload holds (tag, i, value i, 0),
+//          so a dload of n values takes n + 1 rows instead of 2n + 3 constraints
+//The cells holding the same variable are linked by copy constraints. The add, const-mul and pack gates
+//take no row: their outputs are linear combinations, which fold into the rows that use them.
+//Rows only depend on the circuit; the values come from its inputs (.in file), when they are given.
+//
+//With lookups (SetLookups), a split may instead be laid down in byte limbs, each checked by a lookup in a range
+//table, with the bits of a limb decomposed only when a gate needs them one by one: packing the limbs of a split
+//(truncations) takes no row. The xor and mul (and) gates on the same bit of two byte limbs become lazy too, and
+//a whole byte of them is one lookup in the xor or and table of 2^16 rows, which is only worth it for thousands
+//of bytes. The first pass plans which splits and limbs take which form, from the uses of their bits.
+template<class F>
+class skPlonkCircuit
+{
+    public:
+    typedef unsigned int Var;
+    typedef unsigned int Wire;
+    //Cell without variable: its value is 0 and it is not copied
+    static const Var kNone = ~0u;
+
+    enum Column { A, B, C, kColumns };
+    //Tables used for the splits and bitwise gates: none, range tables only, the xor and and tables where they
+    //save rows, or everywhere they apply (to compare)
+    enum LookupMode { kLookupsNone, kLookupsRange, kLookupsAuto, kLookupsAll };
+    enum Selector { QL, QR, QO, QM, QC, QSplit, QZerop, QLookup, QTable, QTag, kSelectors };
+
+    struct Row
+    {
+        Var cell[kColumns];
+        F q[kSelectors];
+
+        Row()
+        {
+            for (int i = 0; i < kColumns; ++i)
+                cell[i] = kNone;
+            for (int i = 0; i < kSelectors; ++i)
+                q[i] = F::zero();
+        }
+    };
+
+    skPlonkCircuit() : lookupMode(kLookupsAuto) {}
+
+    void SetLookups(LookupMode mode) { lookupMode = mode; }
+
+    //Build the rows of 'arithFile'. The values are computed from 'inputsFile' (lines '<wire> <hexadecimal value>'),
+    //or are all 0 if it is empty: the setup only needs the rows
+    bool Load(const std::string &arithFile, const std::string &inputsFile);
+
+    const std::vector<Row> &Rows() const { return rows; }
+    //The input wires (but the one-input) then the outputs, in the order of the circuit. They are held by the first rows
+    const std::vector<F> &PublicValues() const { return publicValues; }
+    size_t NumPublic() const { return publicValues.size(); }
+    size_t NumVars() const { return values.size(); }
+    F Value(size_t row, int column) const;
+    //Number of lookups of each table row (0 on the other rows)
+    const std::vector<F> &Multiplicities() const { return multiplicities; }
+    //Rows taken by each kind of gate
+    const std::map<std::string, long long> &RowCounts() const { return rowCounts; }
+    //Index of the first row whose gates do not hold, or -1. Copies hold by construction, and the lookups which
+    //miss their table are reported by Load
+    long long FirstUnsatisfied() const;
+
+    private:
+    //Sum of coefficient * variable, plus a constant. Terms are not merged until the combination is normalized
+    struct LC
+    {
+        std::vector<std::pair<Var, F>> terms;
+        F constant;
+        LC() : constant(F::zero()) {}
+    };
+
+    std::vector<Row> rows;
+    std::vector<F> values;
+    std::vector<F> multiplicities;
+    std::vector<F> publicValues;
+    std::map<std::string, long long> rowCounts;
+    //value of each wire, and its remaining uses
+    std::vector<LC> wires;
+    std::vector<unsigned int> uses;
+    //variable of each constant held by a cell, by hexadecimal value
+    std::unordered_map<std::string, Var> constants;
+    unsigned long tables;
+    bool solving;
+    bool failed;
+
+    //Bitwise gates with a table of bytes
+    enum Op { OpXor, OpAnd, kOps };
+    //A byte limb (at most 8 bits) of a split, or the result of a table on two limbs (a, b).
+    //var is kNone until a table result is needed, and bits are empty until a gate needs them
+    struct Limb
+    {
+        Var var;
+        unsigned int width;
+        int op;
+        size_t a, b;
+        std::vector<Var> bits;
+    };
+    struct Table
+    {
+        size_t start;
+        F tag;
+    };
+    //What the first pass decides for each split, in order: whether it is laid down in limbs, and the limbs
+    //whose bits are needed
+    struct SplitPlan
+    {
+        bool limbs;
+        std::vector<bool> needBits;
+    };
+    struct Planner;
+    LookupMode lookupMode;
+    bool opTables[kOps];
+    std::vector<SplitPlan> splitPlans;
+    size_t nextSplit;
+    std::vector<Limb> limbs;
+    //wires which are a bit of a limb; the bit is a variable once materialized
+    struct LazyBit
+    {
+        size_t limb;
+        unsigned int bit;
+        bool materialized;
+    };
+    std::unordered_map<Wire, LazyBit> lazyBits;
+    std::map<std::tuple<int, size_t, size_t>, size_t> opLimbs;
+    std::map<std::string, Table> fixedTables;
+
+    Var NewVar(const F &value);
+    Row &NewRow(const char *kind);
+    F Eval(const LC &lc) const;
+    static LC Atom(Var v, const F &k = F::one());
+    static LC Constant(const F &c);
+    static void Normalize(LC &lc);
+    static void Affine(const LC &lc, Var &x, F &k, F &c);
+    static void Append(LC &acc, const LC &lc, const F &k);
+    static bool ToIndex(const F &f, size_t &idx);
+    void Fail(const char *what, Wire w);
+
+    //Variable with the value of 'lc', computed by one row per term after the first
+    Var Materialize(LC lc);
+    //Variable holding the constant c, shared by the cells which need it
+    Var ConstVar(const F &c);
+    //Value of the wire, whose bit is materialized if it is lazy
+    LC &Get(Wire w);
+    //Value of the wire with at most one term, materialized (once) if needed
+    LC Operand(Wire w);
+    //Variable of the wire, materialized (once) if needed
+    Var Exact(Wire w);
+    //Row for m*u*v + s*u + t*v + r = out, where u, v and out have at most one term
+    void Constrain(const LC &u, const LC &v, const F &m, const F &s, const F &t, const F &r, const LC &out, const char *kind);
+    //m*u*v + s*u + t*v + r as a new variable, or as a linear combination when u or v is constant
+    LC Bilinear(const LC &u, const LC &v, const F &m, const F &s, const F &t, const F &r, const char *kind);
+    //Rows for lc = 0
+    void AssertZero(LC lc);
+    //Split rows for x = sum bits[i] * 2^i
+    void Decompose(Var x, const std::vector<Var> &bits);
+    //lc has 'width' bits
+    void RangeCheck(const LC &lc, unsigned int width);
+    //Table of 'size' rows (tag, a, b, c), laid down on first use from row 'start': the range tables hold (i, 0, 0)
+    //at entry i (op < 0), and the xor and and tables hold (x, y, x op y) at entry x + 256*y
+    const Table &FixedTable(const std::string &name, size_t size, int op);
+    //Lookup row of x in the table of 'width' bits
+    void RangeLookup(Var x, unsigned int width);
+    //Variable of a limb; the result of a table is looked up on first use
+    Var LimbVar(size_t limb);
+    //Bits of a limb, decomposed on first use
+    const std::vector<Var> &LimbBits(size_t limb);
+    //Width of the limb whose bits are in[p], in[p + 1]... in order from bit 0, or 0
+    size_t LimbRun(const std::vector<Wire> &in, size_t p, size_t &limb) const;
+    //Leaves out[0] lazy if it is 'op' on the same bit of two byte limbs with a table
+    bool LazyOp(int op, const std::vector<Wire> &in, const std::vector<Wire> &out);
+
+    bool Gate(const std::string &type, const std::vector<Wire> &in, const std::vector<Wire> &out);
+    static bool ParseLine(const std::string &line, std::string &type, std::vector<Wire> &in, std::vector<Wire> &out);
+};
+
+
+template<class F>
+typename skPlonkCircuit<F>::Var skPlonkCircuit<F>::NewVar(const F &value)
+{
+    values.push_back(value);
+    return values.size() - 1;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::Row &skPlonkCircuit<F>::NewRow(const char *kind)
+{
+    rows.push_back(Row());
+    multiplicities.push_back(F::zero());
+    ++rowCounts[kind];
+    return rows.back();
+}
+
+template<class F>
+F skPlonkCircuit<F>::Value(size_t row, int column) const
+{
+    Var v = rows[row].cell[column];
+    return v == kNone ? F::zero() : values[v];
+}
+
+template<class F>
+F skPlonkCircuit<F>::Eval(const LC &lc) const
+{
+    F sum = lc.constant;
+    for (const auto &t : lc.terms)
+        sum += t.second * values[t.first];
+    return sum;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::LC skPlonkCircuit<F>::Atom(Var v, const F &k)
+{
+    LC lc;
+    lc.terms.push_back(std::make_pair(v, k));
+    return lc;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::LC skPlonkCircuit<F>::Constant(const F &c)
+{
+    LC lc;
+    lc.constant = c;
+    return lc;
+}
+
+template<class F>
+void skPlonkCircuit<F>::Normalize(LC &lc)
+{
+    if (lc.terms.size() < 2)
+    {
+        if (lc.terms.size() == 1 && lc.terms[0].second.is_zero())
+            lc.terms.clear();
+        return;
+    }
+    std::sort(lc.terms.begin(), lc.terms.end(),
+              [](const std::pair<Var, F> &x, const std::pair<Var, F> &y) { return x.first < y.first; });
+    size_t n = 0;
+    for (size_t i = 0; i < lc.terms.size(); ++i)
+    {
+        if (n > 0 && lc.terms[n - 1].first == lc.terms[i].first)
+            lc.terms[n - 1].second += lc.terms[i].second;
+        else
+            lc.terms[n++] = lc.terms[i];
+    }
+    lc.terms.resize(n);
+    lc.terms.erase(std::remove_if(lc.terms.begin(), lc.terms.end(),
+                                  [](const std::pair<Var, F> &t) { return t.second.is_zero(); }),
+                   lc.terms.end());
+}
+
+template<class F>
+void skPlonkCircuit<F>::Affine(const LC &lc, Var &x, F &k, F &c)
+{
+    c = lc.constant;
+    if (lc.terms.empty())
+    {
+        x = kNone;
+        k = F::zero();
+    }
+    else
+    {
+        x = lc.terms[0].first;
+        k = lc.terms[0].second;
+    }
+}
+
+template<class F>
+void skPlonkCircuit<F>::Append(LC &acc, const LC &lc, const F &k)
+{
+    for (const auto &t : lc.terms)
+        acc.terms.push_back(std::make_pair(t.first, k * t.second));
+    acc.constant += k * lc.constant;
+}
+
+template<class F>
+bool skPlonkCircuit<F>::ToIndex(const F &f, size_t &idx)
+{
+    unsigned long v = f.as_ulong();
+    if (!(F(static_cast<long>(v), true) == f))
+        return false;
+    idx = v;
+    return true;
+}
+
+template<class F>
+void skPlonkCircuit<F>::Fail(const char *what, Wire w)
+{
+    //without inputs, the values are meaningless
+    if (!solving || failed)
+        return;
+    printf("%s at wire %u\n", what, w);
+    failed = true;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::Var skPlonkCircuit<F>::Materialize(LC lc)
+{
+    Normalize(lc);
+    if (lc.terms.size() == 1 && lc.terms[0].second == F::one() && lc.constant.is_zero())
+        return lc.terms[0].first;
+    if (lc.terms.empty())
+        return ConstVar(lc.constant);
+    const F minusOne = -F::one();
+    Var acc = NewVar(values[lc.terms[0].first] * lc.terms[0].second + lc.constant);
+    {
+        Row &row = NewRow("linear");
+        row.cell[A] = lc.terms[0].first;
+        row.q[QL] = lc.terms[0].second;
+        row.cell[C] = acc;
+        row.q[QO] = minusOne;
+        row.q[QC] = lc.constant;
+        if (lc.terms.size() > 1)
+        {
+            row.cell[B] = lc.terms[1].first;
+            row.q[QR] = lc.terms[1].second;
+            values[acc] += values[lc.terms[1].first] * lc.terms[1].second;
+        }
+    }
+    for (size_t i = 2; i < lc.terms.size(); ++i)
+    {
+        Var next = NewVar(values[acc] + values[lc.terms[i].first] * lc.terms[i].second);
+        Row &row = NewRow("linear");
+        row.cell[A] = acc;
+        row.q[QL] = F::one();
+        row.cell[B] = lc.terms[i].first;
+        row.q[QR] = lc.terms[i].second;
+        row.cell[C] = next;
+        row.q[QO] = minusOne;
+        acc = next;
+    }
+    return acc;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::Var skPlonkCircuit<F>::ConstVar(const F &c)
+{
+    std::string key = skFieldCodec<F>::ToHex(c);
+    auto it = constants.find(key);
+    if (it != constants.end())
+        return it->second;
+    Var v = NewVar(c);
+    Row &row = NewRow("const");
+    row.cell[A] = v;
+    row.q[QL] = F::one();
+    row.q[QC] = -c;
+    constants[key] = v;
+    return v;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::LC &skPlonkCircuit<F>::Get(Wire w)
+{
+    auto it = lazyBits.find(w);
+    if (it != lazyBits.end() && !it->second.materialized)
+    {
+        //the wire stays lazy for the gates which take whole limbs
+        it->second.materialized = true;
+        wires[w] = Atom(LimbBits(it->second.limb)[it->second.bit]);
+    }
+    return wires[w];
+}
+
+template<class F>
+typename skPlonkCircuit<F>::LC skPlonkCircuit<F>::Operand(Wire w)
+{
+    Get(w);
+    Normalize(wires[w]);
+    if (wires[w].terms.size() > 1)
+        wires[w] = Atom(Materialize(wires[w]));
+    return wires[w];
+}
+
+template<class F>
+typename skPlonkCircuit<F>::Var skPlonkCircuit<F>::Exact(Wire w)
+{
+    Var v = Materialize(Get(w));
+    wires[w] = Atom(v);
+    return v;
+}
+
+template<class F>
+void skPlonkCircuit<F>::Constrain(const LC &u, const LC &v, const F &m, const F &s, const F &t, const F &r, const LC &out, const char *kind)
+{
+    Var x, y, z;
+    F k1, c1, k2, c2, k3, c3;
+    Affine(u, x, k1, c1);
+    Affine(v, y, k2, c2);
+    Affine(out, z, k3, c3);
+    Row &row = NewRow(kind);
+    row.cell[A] = x;
+    row.cell[B] = y;
+    row.cell[C] = z;
+    row.q[QM] = m * k1 * k2;
+    row.q[QL] = (m * c2 + s) * k1;
+    row.q[QR] = (m * c1 + t) * k2;
+    row.q[QO] = -k3;
+    row.q[QC] = m * c1 * c2 + s * c1 + t * c2 + r - c3;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::LC skPlonkCircuit<F>::Bilinear(const LC &u, const LC &v, const F &m, const F &s, const F &t, const F &r, const char *kind)
+{
+    LC result;
+    if (u.terms.empty())
+    {
+        Append(result, v, m * u.constant + t);
+        result.constant += s * u.constant + r;
+        return result;
+    }
+    if (v.terms.empty())
+    {
+        Append(result, u, m * v.constant + s);
+        result.constant += t * v.constant + r;
+        return result;
+    }
+    F eu = Eval(u), ev = Eval(v);
+    result = Atom(NewVar(m * eu * ev + s * eu + t * ev + r));
+    Constrain(u, v, m, s, t, r, result, kind);
+    return result;
+}
+
+template<class F>
+void skPlonkCircuit<F>::AssertZero(LC lc)
+{
+    Normalize(lc);
+    if (lc.terms.size() > 2)
+    {
+        //the head is materialized, the last term and the constant fold into the final row
+        LC head;
+        head.terms.assign(lc.terms.begin(), lc.terms.end() - 1);
+        LC tail;
+        tail.terms.push_back(lc.terms.back());
+        tail.constant = lc.constant;
+        lc = tail;
+        lc.terms.insert(lc.terms.begin(), std::make_pair(Materialize(head), F::one()));
+    }
+    Row &row = NewRow("linear");
+    row.q[QC] = lc.constant;
+    if (lc.terms.size() > 0)
+    {
+        row.cell[A] = lc.terms[0].first;
+        row.q[QL] = lc.terms[0].second;
+    }
+    if (lc.terms.size() > 1)
+    {
+        row.cell[B] = lc.terms[1].first;
+        row.q[QR] = lc.terms[1].second;
+    }
+}
+
+template<class F>
+void skPlonkCircuit<F>::Decompose(Var x, const std::vector<Var> &bits)
+{
+    //two bits per row, the most significant first, accumulated in the c cells from 0 to x
+    const size_t k = (bits.size() + 1) / 2;
+    const Var zero = ConstVar(F::zero());
+    const F two = F(2), four = F(4);
+    Var acc = zero;
+    for (size_t j = 0; j < k; ++j)
+    {
+        size_t lo = 2 * (k - 1 - j);
+        Var hi = lo + 1 < bits.size() ? bits[lo + 1] : zero;
+        Var next = j + 1 < k ? NewVar(four * values[acc] + two * values[hi] + values[bits[lo]]) : x;
+        Row &row = NewRow("split");
+        row.cell[A] = hi;
+        row.cell[B] = bits[lo];
+        row.cell[C] = acc;
+        row.q[QSplit] = F::one();
+        acc = next;
+    }
+    Row &last = NewRow("split");
+    last.cell[C] = x;
+}
+
+template<class F>
+void skPlonkCircuit<F>::RangeCheck(const LC &lc, unsigned int width)
+{
+    Var x = Materialize(lc);
+    const auto big = values[x].as_bigint();
+    std::vector<Var> bits(width);
+    for (unsigned int i = 0; i < width; ++i)
+        bits[i] = NewVar(big.test_bit(i) ? F::one() : F::zero());
+    Decompose(x, bits);
+}
+
+template<class F>
+struct skPlonkCircuit<F>::Planner
+{
+    static const size_t kNoSplit = ~size_t(0);
+    //rows saved by a byte of xor or and looked up instead of computed bit by bit
+    static const size_t kRowsSavedPerByte = 7;
+
+    struct Node
+    {
+        //index of the split, or kNoSplit for the result of a table on the nodes a and b
+        size_t split;
+        unsigned int width;
+        int op;
+        size_t a, b;
+        bool needBits;
+        //a result which will not be looked up: its table is not used or an input is not a limb
+        bool dead;
+    };
+    bool ops;
+    std::vector<Node> nodes;
+    std::unordered_map<Wire, std::pair<size_t, unsigned int>> bitOf;
+    std::map<std::tuple<int, size_t, size_t>, size_t> results;
+    std::vector<std::vector<size_t>> splits;
+    std::vector<unsigned int> widths;
+
+    void Use(Wire w)
+    {
+        auto it = bitOf.find(w);
+        if (it != bitOf.end())
+            nodes[it->second.first].needBits = true;
+    }
+
+    size_t Run(const std::vector<Wire> &in, size_t p) const
+    {
+        auto it = bitOf.find(in[p]);
+        if (it == bitOf.end() || it->second.second != 0)
+            return 0;
+        const size_t node = it->second.first, width = nodes[node].width;
+        if (p + width > in.size())
+            return 0;
+        for (size_t s = 1; s < width; ++s)
+        {
+            auto bit = bitOf.find(in[p + s]);
+            if (bit == bitOf.end() || bit->second != std::make_pair(node, static_cast<unsigned int>(s)))
+                return 0;
+        }
+        return width;
+    }
+
+    void Gate(const std::string &type, const std::vector<Wire> &in, const std::vector<Wire> &out)
+    {
+        const int op = type == "xor" ? OpXor : (type == "mul" ? OpAnd : -1);
+        if (op >= 0 && ops && in[0] != in[1])
+        {
+            auto x = bitOf.find(in[0]), y = bitOf.find(in[1]);
+            if (x != bitOf.end() && y != bitOf.end() && x->second.second == y->second.second
+                && nodes[x->second.first].width == 8 && nodes[y->second.first].width == 8)
+            {
+                const size_t a = std::min(x->second.first, y->second.first), b = std::max(x->second.first, y->second.first);
+                auto key = std::make_tuple(op, a, b);
+                auto it = results.find(key);
+                size_t node = nodes.size();
+                if (it == results.end())
+                {
+                    Node result = { kNoSplit, 8, op, a, b, false, false };
+                    nodes.push_back(result);
+                    results[key] = node;
+                }
+                else
+                    node = it->second;
+                bitOf[out[0]] = std::make_pair(node, x->second.second);
+                return;
+            }
+        }
+        if (type == "pack")
+        {
+            for (size_t p = 0; p < in.size(); ++p)
+            {
+                size_t width = Run(in, p);
+                if (width > 0)
+                    p += width - 1;
+                else
+                    Use(in[p]);
+            }
+            return;
+        }
+        for (Wire w : in)
+            Use(w);
+        if (type == "assert")
+            Use(out[0]);
+        if (type == "split")
+        {
+            splits.push_back(std::vector<size_t>());
+            widths.push_back(out.size());
+            for (size_t j = 0; 8 * j < out.size(); ++j)
+            {
+                Node limb = { splits.size() - 1, static_cast<unsigned int>(std::min<size_t>(8, out.size() - 8 * j)), -1, 0, 0, false, false };
+                splits.back().push_back(nodes.size());
+                for (unsigned int t = 0; t < limb.width; ++t)
+                    bitOf[out[8 * j + t]] = std::make_pair(nodes.size(), t);
+                nodes.push_back(limb);
+            }
+        }
+    }
+
+    //A split takes limbs when they need fewer rows than its bits: a limb costs a lookup, or the rows of its bits,
+    //and the limbs are summed up. Splits in bits and unused tables leave the results on them to bitwise gates,
+    //whose inputs need their bits, so the decisions are repeated until none changes
+    void Finish(LookupMode mode, std::vector<SplitPlan> &plans, bool opTables[kOps])
+    {
+        for (int op = 0; op < kOps; ++op)
+            opTables[op] = ops;
+        plans.assign(splits.size(), SplitPlan());
+        for (size_t s = 0; s < splits.size(); ++s)
+            plans[s].limbs = true;
+        bool decided = mode != kLookupsAuto;
+        bool changed = true;
+        while (changed)
+        {
+            changed = false;
+            for (size_t n = 0; n < nodes.size(); ++n)
+            {
+                Node &node = nodes[n];
+                if (node.split != kNoSplit || node.dead)
+                    continue;
+                if (!opTables[node.op] || Dead(plans, node.a) || Dead(plans, node.b))
+                {
+                    node.dead = true;
+                    nodes[node.a].needBits = nodes[node.b].needBits = true;
+                    changed = true;
+                }
+            }
+            for (size_t s = 0; s < splits.size(); ++s)
+            {
+                size_t bits = (widths[s] + 1) / 2 + 1, limbs = splits[s].size();
+                for (size_t n : splits[s])
+                    limbs += nodes[n].needBits ? (nodes[n].width + 1) / 2 + 1 : 1;
+                if (plans[s].limbs && limbs >= bits)
+                {
+                    plans[s].limbs = false;
+                    changed = true;
+                }
+            }
+            if (!changed && !decided)
+            {
+                decided = true;
+                size_t bytes[kOps] = { 0, 0 };
+                for (const Node &node : nodes)
+                    if (node.split == kNoSplit && !node.dead)
+                        ++bytes[node.op];
+                for (int op = 0; op < kOps; ++op)
+                {
+                    if (opTables[op] && bytes[op] * kRowsSavedPerByte < (1 << 16) + 256)
+                    {
+                        opTables[op] = false;
+                        changed = true;
+                    }
+                }
+            }
+        }
+        if (mode == kLookupsAuto && !opTables[OpXor] && !opTables[OpAnd])
+        {
+            //the range tables (and their constants) must be paid back too. Besides the split rows, a limb whose bits
+            //are only packed saves the rows of its other bits in the sum that materializes the pack (a truncation)
+            size_t saved = 0, tableRows = 0;
+            std::vector<bool> used(9, false);
+            for (size_t s = 0; s < splits.size(); ++s)
+            {
+                if (!plans[s].limbs)
+                    continue;
+                size_t limbs = splits[s].size();
+                for (size_t n : splits[s])
+                {
+                    limbs += nodes[n].needBits ? (nodes[n].width + 1) / 2 + 1 : 1;
+                    if (!nodes[n].needBits)
+                    {
+                        used[nodes[n].width] = true;
+                        saved += nodes[n].width - 1;
+                    }
+                }
+                saved += (widths[s] + 1) / 2 + 1 - limbs;
+            }
+            for (unsigned int w = 1; w <= 8; ++w)
+                if (used[w])
+                    tableRows += (size_t(1) << w) + (size_t(1) << w);
+            if (saved < tableRows)
+                for (size_t s = 0; s < splits.size(); ++s)
+                    plans[s].limbs = false;
+        }
+        for (size_t s = 0; s < splits.size(); ++s)
+            for (size_t n : splits[s])
+                plans[s].needBits.push_back(nodes[n].needBits);
+    }
+
+    bool Dead(const std::vector<SplitPlan> &plans, size_t n) const
+    {
+        return nodes[n].split == kNoSplit ? nodes[n].dead : !plans[nodes[n].split].limbs;
+    }
+};
+
+template<class F>
+const typename skPlonkCircuit<F>::Table &skPlonkCircuit<F>::FixedTable(const std::string &name, size_t size, int op)
+{
+    auto it = fixedTables.find(name);
+    if (it != fixedTables.end())
+        return it->second;
+    //the constants take rows, which must not come between the rows of the table
+    std::vector<Var> consts(std::min<size_t>(size, 256));
+    for (size_t i = 0; i < consts.size(); ++i)
+        consts[i] = ConstVar(F(static_cast<long>(i)));
+    Table table;
+    table.start = rows.size();
+    table.tag = F(static_cast<long>(++tables));
+    for (size_t i = 0; i < size; ++i)
+    {
+        Row &row = NewRow("table");
+        if (op < 0)
+            row.cell[A] = consts[i];
+        else
+        {
+            const size_t x = i & 255, y = i >> 8;
+            row.cell[A] = consts[x];
+            row.cell[B] = consts[y];
+            row.cell[C] = consts[op == OpXor ? x ^ y : x & y];
+        }
+        row.q[QTable] = F::one();
+        row.q[QTag] = table.tag;
+    }
+    return fixedTables[name] = table;
+}
+
+template<class F>
+void skPlonkCircuit<F>::RangeLookup(Var x, unsigned int width)
+{
+    const Table &table = FixedTable("range" + std::to_string(width), size_t(1) << width, -1);
+    size_t v;
+    //a value out of range misses the table; the split of the value does not hold either
+    if (ToIndex(values[x], v) && v < (size_t(1) << width))
+        multiplicities[table.start + v] += F::one();
+    Row &row = NewRow("range");
+    row.cell[A] = x;
+    row.q[QLookup] = F::one();
+    row.q[QTag] = table.tag;
+}
+
+template<class F>
+typename skPlonkCircuit<F>::Var skPlonkCircuit<F>::LimbVar(size_t limb)
+{
+    //results of results (chains of xors) are looked up from the first one
+    std::vector<size_t> stack(1, limb);
+    while (!stack.empty())
+    {
+        const size_t id = stack.back();
+        if (limbs[id].var != kNone)
+        {
+            stack.pop_back();
+            continue;
+        }
+        const size_t a = limbs[id].a, b = limbs[id].b;
+        if (limbs[a].var == kNone)
+        {
+            stack.push_back(a);
+            continue;
+        }
+        if (limbs[b].var == kNone)
+        {
+            stack.push_back(b);
+            continue;
+        }
+        stack.pop_back();
+        const int op = limbs[id].op;
+        const Table &table = FixedTable(op == OpXor ? "xor" : "and", 1 << 16, op);
+        const Var va = limbs[a].var, vb = limbs[b].var;
+        size_t x, y, r = 0;
+        if (ToIndex(values[va], x) && ToIndex(values[vb], y) && x < 256 && y < 256)
+        {
+            r = op == OpXor ? x ^ y : x & y;
+            multiplicities[table.start + x + 256 * y] += F::one();
+        }
+        const Var result = NewVar(F(static_cast<long>(r)));
+        Row &row = NewRow(op == OpXor ? "xor" : "and");
+        row.cell[A] = va;
+        row.cell[B] = vb;
+        row.cell[C] = result;
+        row.q[QLookup] = F::one();
+        row.q[QTag] = table.tag;
+        limbs[id].var = result;
+    }
+    return limbs[limb].var;
+}
+
+template<class F>
+const std::vector<typename skPlonkCircuit<F>::Var> &skPlonkCircuit<F>::LimbBits(size_t limb)
+{
+    if (limbs[limb].bits.empty())
+    {
+        const Var v = LimbVar(limb);
+        const auto big = values[v].as_bigint();
+        std::vector<Var> bits(limbs[limb].width);
+        for (size_t t = 0; t < bits.size(); ++t)
+            bits[t] = NewVar(big.test_bit(t) ? F::one() : F::zero());
+        Decompose(v, bits);
+        limbs[limb].bits = bits;
+    }
+    return limbs[limb].bits;
+}
+
+template<class F>
+size_t skPlonkCircuit<F>::LimbRun(const std::vector<Wire> &in, size_t p, size_t &limb) const
+{
+    auto it = lazyBits.find(in[p]);
+    if (it == lazyBits.end() || it->second.bit != 0)
+        return 0;
+    limb = it->second.limb;
+    const size_t width = limbs[limb].width;
+    if (p + width > in.size())
+        return 0;
+    for (size_t s = 1; s < width; ++s)
+    {
+        auto bit = lazyBits.find(in[p + s]);
+        if (bit == lazyBits.end() || bit->second.limb != limb || bit->second.bit != s)
+            return 0;
+    }
+    return width;
+}
+
+template<class F>
+bool skPlonkCircuit<F>::LazyOp(int op, const std::vector<Wire> &in, const std::vector<Wire> &out)
+{
+    if (!opTables[op] || in[0] == in[1])
+        return false;
+    auto x = lazyBits.find(in[0]), y = lazyBits.find(in[1]);
+    if (x == lazyBits.end() || y == lazyBits.end() || x->second.bit != y->second.bit
+        || limbs[x->second.limb].width != 8 || limbs[y->second.limb].width != 8)
+        return false;
+    const size_t a = std::min(x->second.limb, y->second.limb), b = std::max(x->second.limb, y->second.limb);
+    auto key = std::make_tuple(op, a, b);
+    auto it = opLimbs.find(key);
+    size_t result = limbs.size();
+    if (it == opLimbs.end())
+    {
+        Limb limb;
+        limb.var = kNone;
+        limb.width = 8;
+        limb.op = op;
+        limb.a = a;
+        limb.b = b;
+        limbs.push_back(limb);
+        opLimbs[key] = result;
+    }
+    else
+        result = it->second;
+    LazyBit bit = { result, x->second.bit, false };
+    lazyBits[out[0]] = bit;
+    return true;
+}
+
+template<class F>
+bool skPlonkCircuit<F>::ParseLine(const std::string &line, std::string &type, std::vector<Wire> &in, std::vector<Wire> &out)
+{
+    std::vector<char> typeStr(line.size() + 1), inStr(line.size() + 1), outStr(line.size() + 1);
+    unsigned int numIn, numOut;
+    if (sscanf(line.c_str(), "%s in %u <%[^>]> out %u <%[^>]>", typeStr.data(), &numIn, inStr.data(), &numOut, outStr.data()) != 5)
+        return false;
+    type = typeStr.data();
+    in.clear();
+    out.clear();
+    std::istringstream ins(inStr.data()), outs(outStr.data());
+    Wire w;
+    while (ins >> w)
+        in.push_back(w);
+    while (outs >> w)
+        out.push_back(w);
+    return in.size() == numIn && out.size() == numOut;
+}
+
+template<class F>
+bool skPlonkCircuit<F>::Gate(const std::string &type, const std::vector<Wire> &in, const std::vector<Wire> &out)
+{
+    static const std::string constMulNeg = "const-mul-neg-", constMul = "const-mul-", divide = "div_";
+    const F zero = F::zero(), one = F::one(), minusOne = -F::one();
+    if (type == "add")
+    {
+        //a chain of adds grows the same combination, which is taken over on its last use
+        LC sum;
+        size_t first = in.size();
+        for (Wire w : in)
+            Get(w);
+        for (size_t i = 0; i < in.size(); ++i)
+            if (uses[in[i]] == 1 && std::count(in.begin(), in.end(), in[i]) == 1
+                && (first == in.size() || wires[in[i]].terms.size() > wires[in[first]].terms.size()))
+                first = i;
+        if (first < in.size())
+            sum = std::move(wires[in[first]]);
+        for (size_t i = 0; i < in.size(); ++i)
+            if (i != first)
+                Append(sum, wires[in[i]], one);
+        wires[out[0]] = std::move(sum);
+    }
+    else if (type == "pack")
+    {
+        //whole limbs are added as such, without their bits
+        LC sum;
+        F k = one;
+        for (size_t p = 0; p < in.size(); ++p)
+        {
+            size_t limb;
+            const size_t width = LimbRun(in, p, limb);
+            if (width > 0)
+            {
+                sum.terms.push_back(std::make_pair(LimbVar(limb), k));
+                for (size_t t = 0; t < width; ++t)
+                    k += k;
+                p += width - 1;
+                continue;
+            }
+            Append(sum, Get(in[p]), k);
+            k += k;
+        }
+        wires[out[0]] = sum;
+    }
+    else if (type.compare(0, constMul.size(), constMul) == 0)
+    {
+        const bool negate = type.compare(0, constMulNeg.size(), constMulNeg) == 0;
+        const F &k = skFieldCodec<F>::InternHex(type.c_str() + (negate ? constMulNeg.size() : constMul.size()), negate);
+        LC lc;
+        Append(lc, Get(in[0]), k);
+        wires[out[0]] = lc;
+    }
+    else if ((type == "xor" || type == "mul") && LazyOp(type == "xor" ? OpXor : OpAnd, in, out))
+        return true;
+    else if (type == "mul")
+        wires[out[0]] = Bilinear(Operand(in[0]), Operand(in[1]), one, zero, zero, zero, "arith");
+    else if (type == "xor")
+        wires[out[0]] = Bilinear(Operand(in[0]), Operand(in[1]), -F(2), one, one, zero, "arith");
+    else if (type == "or")
+        wires[out[0]] = Bilinear(Operand(in[0]), Operand(in[1]), minusOne, one, one, zero, "arith");
+    else if (type == "assert")
+        Constrain(Operand(in[0]), Operand(in[1]), one, zero, zero, zero, Operand(out[0]), "arith");
+    else if (type == "div")
+    {
+        //out * b = a
+        LC a = Operand(in[0]), b = Operand(in[1]);
+        F eb = Eval(b);
+        if (eb.is_zero())
+            Fail("Invalid value divide by zero", in[1]);
+        F inv = eb.is_zero() ? zero : eb.inverse();
+        if (b.terms.empty())
+        {
+            LC lc;
+            Append(lc, a, inv);
+            wires[out[0]] = lc;
+        }
+        else
+        {
+            wires[out[0]] = Atom(NewVar(Eval(a) * inv));
+            Constrain(wires[out[0]], b, one, zero, zero, zero, a, "arith");
+        }
+    }
+    else if (type.compare(0, divide.size(), divide) == 0)
+    {
+        //a = q*b + r, with q, r and b - r - 1 of 'width' bits
+        unsigned int width = atoi(type.c_str() + divide.size());
+        LC a = Operand(in[0]), b = Operand(in[1]);
+        mpz_t za, zb, zq, zr;
+        mpz_init(za);
+        mpz_init(zb);
+        mpz_init(zq);
+        mpz_init(zr);
+        Eval(a).as_bigint().to_mpz(za);
+        Eval(b).as_bigint().to_mpz(zb);
+        if (mpz_sgn(zb) == 0)
+        {
+            Fail("Invalid value divide by zero", in[1]);
+            mpz_set(zr, za);
+        }
+        else
+            mpz_fdiv_qr(zq, zr, za, zb);
+        typedef decltype(F().as_bigint()) BigIntT;
+        Var q = NewVar(F(BigIntT(zq))), r = NewVar(F(BigIntT(zr)));
+        mpz_clear(za);
+        mpz_clear(zb);
+        mpz_clear(zq);
+        mpz_clear(zr);
+        LC check = Bilinear(Atom(q), b, one, zero, zero, zero, "arith");
+        Append(check, Atom(r), one);
+        Append(check, a, minusOne);
+        AssertZero(check);
+        RangeCheck(Atom(q), width);
+        RangeCheck(Atom(r), width);
+        LC gap = b;
+        Append(gap, Atom(r), minusOne);
+        gap.constant -= one;
+        RangeCheck(gap, width);
+        wires[out[0]] = Atom(q);
+        wires[out[1]] = Atom(r);
+    }
+    else if (type == "zerop")
+    {
+        LC x = Operand(in[0]);
+        F ex = Eval(x);
+        F inv = ex.is_zero() ? zero : ex.inverse();
+        F nz = ex.is_zero() ? zero : one;
+        if (x.terms.empty())
+        {
+            wires[out[0]] = Constant(inv);
+            wires[out[1]] = Constant(nz);
+            return true;
+        }
+        Var xv = Exact(in[0]);
+        Var iv = NewVar(inv), nv = NewVar(nz);
+        Row &row = NewRow("zerop");
+        row.cell[A] = xv;
+        row.cell[B] = iv;
+        row.cell[C] = nv;
+        row.q[QZerop] = one;
+        wires[out[0]] = Atom(iv);
+        wires[out[1]] = Atom(nv);
+    }
+    else if (type == "split")
+    {
+        const SplitPlan *plan = lookupMode != kLookupsNone ? &splitPlans[nextSplit++] : NULL;
+        LC x = Operand(in[0]);
+        const auto big = Eval(x).as_bigint();
+        if (x.terms.empty())
+        {
+            for (size_t i = 0; i < out.size(); ++i)
+                wires[out[i]] = Constant(big.test_bit(i) ? one : zero);
+            return true;
+        }
+        if (plan && plan->limbs)
+        {
+            //x = sum limb[j] * 256^j, each limb in its range table or decomposed into its bits
+            LC check = x;
+            F scale = one;
+            for (size_t j = 0; 8 * j < out.size(); ++j)
+            {
+                Limb limb;
+                limb.width = std::min<size_t>(8, out.size() - 8 * j);
+                limb.op = -1;
+                limb.a = limb.b = 0;
+                long v = 0;
+                for (unsigned int t = 0; t < limb.width; ++t)
+                    if (big.test_bit(8 * j + t))
+                        v |= 1L << t;
+                limb.var = NewVar(F(v));
+                limbs.push_back(limb);
+                if (plan->needBits[j])
+                    LimbBits(limbs.size() - 1);
+                else
+                    RangeLookup(limb.var, limb.width);
+                for (unsigned int t = 0; t < limb.width; ++t)
+                {
+                    LazyBit bit = { limbs.size() - 1, t, false };
+                    lazyBits[out[8 * j + t]] = bit;
+                }
+                check.terms.push_back(std::make_pair(limb.var, -scale));
+                scale *= F(256);
+            }
+            AssertZero(check);
+            return true;
+        }
+        Var xv = Exact(in[0]);
+        std::vector<Var> bits(out.size());
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            bits[i] = NewVar(big.test_bit(i) ? one : zero);
+            wires[out[i]] = Atom(bits[i]);
+        }
+        Decompose(xv, bits);
+    }
+    else if (type == "dload")
+    {
+        //out = in[1 + in[0]], looked up in the table (tag, i, in[1 + i])
+        const size_t n = in.size() - 1;
+        LC idx = Operand(in[0]);
+        size_t hit = 0;
+        if (!ToIndex(Eval(idx), hit) || hit >= n)
+        {
+            Fail("ERROR - index too big", in[0]);
+            hit = n;
+        }
+        if (idx.terms.empty())
+        {
+            if (hit >= n)
+                return false;
+            wires[out[0]] = Get(in[1 + hit]);
+            return true;
+        }
+        //the cells of the lookup are variables: the c cells are looked up too
+        F tag = F(static_cast<long>(++tables));
+        for (size_t i = 0; i < n; ++i)
+        {
+            Var iv = ConstVar(F(static_cast<long>(i)));
+            Var ev = Exact(in[1 + i]);
+            Row &row = NewRow("table");
+            row.cell[A] = iv;
+            row.cell[B] = ev;
+            row.q[QTable] = one;
+            row.q[QTag] = tag;
+            if (i == hit)
+                multiplicities.back() = one;
+        }
+        Var v = NewVar(hit < n ? Eval(wires[in[1 + hit]]) : zero);
+        Var iv = Exact(in[0]);
+        Row &row = NewRow("lookup");
+        row.cell[A] = iv;
+        row.cell[B] = v;
+        row.q[QLookup] = one;
+        row.q[QTag] = tag;
+        wires[out[0]] = Atom(v);
+    }
+    else if (type == "asplit")
+    {
+        //out[i] = (in[0] == i), with sum(out[i]) = 1 and sum(i * out[i]) = in[0]
+        LC idx = Operand(in[0]);
+        size_t hit = 0;
+        if (!ToIndex(Eval(idx), hit) || hit >= out.size())
+        {
+            Fail("ERROR - index too big", in[0]);
+            hit = out.size();
+        }
+        if (idx.terms.empty())
+        {
+            if (hit >= out.size())
+                return false;
+            for (size_t i = 0; i < out.size(); ++i)
+                wires[out[i]] = Constant(i == hit ? one : zero);
+            return true;
+        }
+        LC total = Constant(minusOne);
+        LC position;
+        Append(position, idx, minusOne);
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            Var d = NewVar(i == hit ? one : zero);
+            Row &row = NewRow("asplit");
+            row.cell[A] = d;
+            row.cell[B] = d;
+            row.q[QM] = one;
+            row.q[QL] = minusOne;
+            total.terms.push_back(std::make_pair(d, one));
+            if (i > 0)
+                position.terms.push_back(std::make_pair(d, F(static_cast<long>(i))));
+            wires[out[i]] = Atom(d);
+        }
+        AssertZero(total);
+        AssertZero(position);
+    }
+    else
+    {
+        printf("Error: unsupported gate %s\n", type.c_str());
+        return false;
+    }
+    return true;
+}
+
+template<class F>
+bool skPlonkCircuit<F>::Load(const std::string &arithFile, const std::string &inputsFile)
+{
+    skTrace::Span span("arithmetize");
+    rows.clear();
+    values.clear();
+    multiplicities.clear();
+    publicValues.clear();
+    rowCounts.clear();
+    constants.clear();
+    tables = 0;
+    solving = !inputsFile.empty();
+    failed = false;
+    splitPlans.clear();
+    nextSplit = 0;
+    limbs.clear();
+    lazyBits.clear();
+    opLimbs.clear();
+    fixedTables.clear();
+
+    std::ifstream arith(arithFile);
+    std::string line;
+    unsigned int total;
+    if (!std::getline(arith, line) || sscanf(line.c_str(), "total %u", &total) != 1)
+    {
+        printf("Unable to read the circuit file %s\n", arithFile.c_str());
+        return false;
+    }
+    wires.assign(total, LC());
+    uses.assign(total, 0);
+
+    std::vector<F> inputs(total, F::zero());
+    if (solving)
+    {
+        std::ifstream in(inputsFile);
+        if (!in.good())
+        {
+            printf("Unable to open input file %s\n", inputsFile.c_str());
+            return false;
+        }
+        while (std::getline(in, line))
+        {
+            Wire w;
+            std::vector<char> value(line.size() + 1);
+            if (line.empty())
+                continue;
+            if (sscanf(line.c_str(), "%u %s", &w, value.data()) != 2 || w >= total)
+            {
+                printf("Error in Input\n");
+                return false;
+            }
+            inputs[w] = skFieldCodec<F>::FromHex(value.data());
+        }
+    }
+
+    //first pass: the inputs, the one-input (as in skArithOptimizer) and the uses of the wires
+    std::vector<Wire> publicInputs, outputs;
+    long long one = -1, firstInput = -1;
+    std::string type;
+    std::vector<Wire> in, out;
+    Planner planner;
+    planner.ops = lookupMode >= kLookupsAuto;
+    while (std::getline(arith, line))
+    {
+        Wire w;
+        if (line.empty() || line[0] == '#')
+            continue;
+        if (sscanf(line.c_str(), "input %u", &w) == 1)
+        {
+            if (one < 0 && line.find("one-input") != std::string::npos)
+                one = w;
+            if (firstInput < 0)
+                firstInput = w;
+            publicInputs.push_back(w);
+        }
+        else if (sscanf(line.c_str(), "nizkinput %u", &w) == 1)
+            wires[w] = Atom(NewVar(inputs[w]));
+        else if (sscanf(line.c_str(), "output %u", &w) == 1)
+        {
+            outputs.push_back(w);
+            ++uses[w];
+            planner.Use(w);
+        }
+        else if (ParseLine(line, type, in, out))
+        {
+            for (Wire i : in)
+                ++uses[i];
+            if (type == "assert")
+                ++uses[out[0]];
+            if (lookupMode != kLookupsNone)
+                planner.Gate(type, in, out);
+        }
+        else
+        {
+            printf("Error: unrecognized line: %s\n", line.c_str());
+            return false;
+        }
+    }
+    if (one < 0)
+        one = firstInput;
+    if (lookupMode != kLookupsNone)
+        planner.Finish(lookupMode, splitPlans, opTables);
+    else
+        opTables[OpXor] = opTables[OpAnd] = false;
+    planner = Planner();
+    std::vector<Var> inputVars;
+    for (Wire w : publicInputs)
+    {
+        if (w == one)
+            wires[w] = Constant(F::one());
+        else
+        {
+            inputVars.push_back(NewVar(inputs[w]));
+            wires[w] = Atom(inputVars.back());
+        }
+    }
+
+    //second pass: the gates
+    arith.clear();
+    arith.seekg(0);
+    std::getline(arith, line);
+    while (std::getline(arith, line))
+    {
+        if (line.empty() || line[0] == '#' || !ParseLine(line, type, in, out))
+            continue;
+        if (!Gate(type, in, out))
+        {
+            printf("Error: cannot arithmetize %s\n", line.c_str());
+            return false;
+        }
+        //the value of a wire is dropped after its last use
+        for (Wire i : in)
+        {
+            if (--uses[i] == 0)
+            {
+                LC().terms.swap(wires[i].terms);
+                lazyBits.erase(i);
+            }
+        }
+    }
+
+    //public rows, in front: a public value y is checked by k*x + c - y = 0
+    std::vector<Row> publicRows;
+    for (Var v : inputVars)
+    {
+        Row row;
+        row.cell[A] = v;
+        row.q[QL] = F::one();
+        publicRows.push_back(row);
+        publicValues.push_back(values[v]);
+    }
+    for (Wire w : outputs)
+    {
+        //an output which is not a variable takes gate rows
+        LC lc = Operand(w);
+        Var x;
+        F k, c;
+        Affine(lc, x, k, c);
+        Row row;
+        row.cell[A] = x;
+        row.q[QL] = k;
+        row.q[QC] = c;
+        publicRows.push_back(row);
+        publicValues.push_back(Eval(lc));
+    }
+    rowCounts["public"] = publicRows.size();
+    rows.insert(rows.begin(), publicRows.begin(), publicRows.end());
+    multiplicities.insert(multiplicities.begin(), publicRows.size(), F::zero());
+    wires.clear();
+    uses.clear();
+    lazyBits.clear();
+
+    skTrace::Count("rows", rows.size());
+    skTrace::Count("variables", values.size());
+    skTrace::Count("public", publicValues.size());
+    return !failed;
+}
+
+template<class F>
+long long skPlonkCircuit<F>::FirstUnsatisfied() const
+{
+    const F one = F::one(), two = F(2), four = F(4);
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        const Row &row = rows[i];
+        F a = Value(i, A), b = Value(i, B), c = Value(i, C);
+        F gate = row.q[QL] * a + row.q[QR] * b + row.q[QO] * c + row.q[QM] * a * b + row.q[QC];
+        if (i < publicValues.size())
+            gate -= publicValues[i];
+        if (!gate.is_zero())
+            return i;
+        if (!row.q[QSplit].is_zero())
+        {
+            F next = i + 1 < rows.size() ? Value(i + 1, C) : F::zero();
+            if (!(a * (a - one)).is_zero() || !(b * (b - one)).is_zero() || !(next - four * c - two * a - b).is_zero())
+                return i;
+        }
+        if (!row.q[QZerop].is_zero() && (!(a * b - c).is_zero() || !(a * (one - c)).is_zero()))
+            return i;
+    }
+    return -1;
+}
+
+#endif
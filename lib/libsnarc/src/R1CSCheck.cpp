@@ -0,0 +1,141 @@
+#include "R1CSCheck.hpp"
+
+#include <fstream>
+#include <sstream>
+
+static bool &CheckEnabled()
+{
+    static bool enabled = true;
+    return enabled;
+}
+
+static size_t &CheckMaxFailures()
+{
+    static size_t k = 10;
+    return k;
+}
+
+static unsigned int &CheckThreads()
+{
+    static unsigned int n = 0;
+    return n;
+}
+
+static std::string &CheckCircuit()
+{
+    static std::string arithFile;
+    return arithFile;
+}
+
+void skR1CSCheck::SetEnabled(bool enabled)
+{
+    CheckEnabled() = enabled;
+}
+
+bool skR1CSCheck::Enabled()
+{
+    return CheckEnabled();
+}
+
+void skR1CSCheck::SetMaxFailures(size_t k)
+{
+    CheckMaxFailures() = k;
+}
+
+size_t skR1CSCheck::MaxFailures()
+{
+    return CheckMaxFailures();
+}
+
+void skR1CSCheck::SetThreads(unsigned int n)
+{
+    CheckThreads() = n;
+}
+
+unsigned int skR1CSCheck::Threads()
+{
+    return CheckThreads();
+}
+
+void skR1CSCheck::SetCircuit(const std::string &arithFile)
+{
+    CheckCircuit() = arithFile;
+}
+
+//Line of the circuit which generated each of the sorted constraints, 0 when it is unknown
+static std::vector<size_t> SourceLines(const std::vector<size_t> &failures, const std::string &costFile)
+{
+    std::vector<size_t> lines(failures.size(), 0);
+    std::ifstream in(costFile);
+    size_t line, count, first = 0, f = 0;
+    while (f < failures.size() && in >> line >> count)
+    {
+        for (; f < failures.size() && failures[f] < first + count; ++f)
+            lines[f] = line;
+        first += count;
+    }
+    return lines;
+}
+
+//The requested lines of a file (1-based), without their comments for the circuit
+static std::vector<std::string> ReadLines(const std::string &file, const std::vector<size_t> &lines, bool stripComments)
+{
+    std::vector<std::string> text(lines.size());
+    std::ifstream in(file);
+    if (!in.good())
+        return text;
+    size_t last = 0;
+    for (size_t l : lines)
+        last = std::max(last, l);
+    std::string s;
+    for (size_t n = 1; n <= last && std::getline(in, s); ++n)
+    {
+        if (stripComments)
+        {
+            const size_t comment = s.find('#');
+            s = s.substr(0, comment);
+            s.erase(s.find_last_not_of(" \t") + 1);
+        }
+        for (size_t i = 0; i < lines.size(); ++i)
+            if (lines[i] == n)
+                text[i] = s;
+    }
+    return text;
+}
+
+void skR1CSCheck::Report(const std::vector<size_t> &failures, const std::string &r1csFile)
+{
+    std::vector<size_t> lines(failures.size(), 0);
+    if (!r1csFile.empty())
+        lines = SourceLines(failures, r1csFile + ".cost");
+    const std::string &arithFile = CheckCircuit();
+    std::vector<std::string> gates(failures.size()), locations(failures.size());
+    if (!arithFile.empty())
+    {
+        gates = ReadLines(arithFile, lines, true);
+        locations = ReadLines(arithFile + ".dbg", lines, false);
+    }
+    for (size_t i = 0; i < failures.size(); ++i)
+    {
+        std::ostringstream where;
+        if (lines[i] > 0)
+        {
+            where << ", circuit line " << lines[i];
+            if (!gates[i].empty())
+                where << ": " << gates[i];
+            //file \t line \t function
+            std::istringstream loc(locations[i]);
+            std::string file, line, function;
+            if (std::getline(loc, file, '\t') && std::getline(loc, line, '\t') && !file.empty())
+            {
+                std::getline(loc, function);
+                where << " at " << file << ":" << line << " (" << function << ")";
+            }
+        }
+        printf("constraint %lu failed%s\n", (unsigned long)failures[i], where.str().c_str());
+    }
+    if (failures.size() >= MaxFailures())
+        printf("(the check stops after %lu failures)\n", (unsigned long)failures.size());
+    if (!failures.empty() && lines[0] == 0 && !arithFile.empty())
+        printf("(run isekai with --profile to locate the failing constraints in the circuit)\n");
+}
@@ -0,0 +1,104 @@
+#ifndef R1CS_CHECK_HPP_
+#define R1CS_CHECK_HPP_
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+//Satisfaction check of a constraint system and its assignment, run by the provers before proving.
+//The constraints are checked in blocks by several threads, which stop once enough failures are found;
+//the first failing constraints are reported with the gate which generated them, when isekai --profile
+//wrote the constraints of each line of the circuit (<r1cs>.cost) and the circuit is known (SetCircuit),
+//and with its source location from <arith>.dbg. isekai removes <r1cs>.cost when it generates constraints without
+//--profile, so that the costs always match the constraints.
+//The check can be disabled in production, where the assignments come from a tested circuit.
+class skR1CSCheck
+{
+    public:
+    static void SetEnabled(bool enabled);
+    static bool Enabled();
+    //Number of failing constraints reported (10 by default)
+    static void SetMaxFailures(size_t k);
+    static size_t MaxFailures();
+    //Threads of the check, 0 for one per core (the default)
+    static void SetThreads(unsigned int n);
+    static unsigned int Threads();
+    //The arithmetic circuit of the next constraint systems, to report the gates of the failures
+    static void SetCircuit(const std::string &arithFile);
+
+    //Indexes of the first k constraints with a*b != c, in increasing order.
+    //row(i, a, b, c) computes the values of the linear combinations of constraint i; it is called concurrently
+    template<class F, class Row>
+    static std::vector<size_t> FirstFailures(size_t n, size_t k, const Row &row);
+
+    //Check the n constraints and print the first failures, located with the files of r1csFile (may be empty).
+    //The provers call it only when the check is enabled
+    template<class F, class Row>
+    static bool Check(size_t n, const Row &row, const std::string &r1csFile);
+
+    //Print the failing constraints, with their gates and source locations when they are known
+    static void Report(const std::vector<size_t> &failures, const std::string &r1csFile);
+
+    private:
+    static const size_t kBlock = 1024;
+};
+
+template<class F, class Row>
+std::vector<size_t> skR1CSCheck::FirstFailures(size_t n, size_t k, const Row &row)
+{
+    //blocks are taken in order, so once k failures are found the blocks left come after all of them
+    const size_t blocks = (n + kBlock - 1) / kBlock;
+    std::vector<std::vector<size_t>> found(blocks);
+    std::atomic<size_t> next(0), count(0);
+    auto work = [&]()
+    {
+        F a, b, c;
+        while (count.load() < k)
+        {
+            const size_t block = next++;
+            if (block >= blocks)
+                break;
+            const size_t end = std::min(n, (block + 1) * kBlock);
+            for (size_t i = block * kBlock; i < end && found[block].size() < k; ++i)
+            {
+                row(i, a, b, c);
+                if (!(a * b == c))
+                    found[block].push_back(i);
+            }
+            count += found[block].size();
+        }
+    };
+    unsigned int nthreads = Threads() > 0 ? Threads() : std::max(1u, std::thread::hardware_concurrency());
+    nthreads = static_cast<unsigned int>(std::min<size_t>(nthreads, blocks));
+    std::vector<std::thread> pool;
+    for (unsigned int t = 1; t < nthreads; ++t)
+        pool.push_back(std::thread(work));
+    work();
+    for (std::thread &t : pool)
+        t.join();
+
+    std::vector<size_t> failures;
+    for (size_t block = 0; block < blocks && failures.size() < k; ++block)
+        for (size_t i = 0; i < found[block].size() && failures.size() < k; ++i)
+            failures.push_back(found[block][i]);
+    return failures;
+}
+
+template<class F, class Row>
+bool skR1CSCheck::Check(size_t n, const Row &row, const std::string &r1csFile)
+{
+    const std::vector<size_t> failures = FirstFailures<F>(n, std::max<size_t>(MaxFailures(), 1), row);
+    if (failures.empty())
+    {
+        printf("R1CS is satisfied.\n");
+        return true;
+    }
+    printf("NOT SATISFIED!!\n");
+    Report(failures, r1csFile);
+    return false;
+}
+
+#endif
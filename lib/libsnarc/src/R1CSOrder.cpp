@@ -0,0 +1,307 @@
+#include "R1CSOrder.hpp"
+#include "Trace.hpp"
+
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+
+using json = nlohmann::json;
+
+static const skR1CSOrder::Var kUnset = ~0u;
+
+skR1CSOrder::skR1CSOrder()
+    : instances(0), spanBefore(0), spanAfter(0)
+{
+}
+
+bool skR1CSOrder::ParseLinearComb(const json &jlc, LinearComb &lc)
+{
+    if (!jlc.is_array())
+        return false;
+    lc.clear();
+    lc.reserve(jlc.size());
+    for (const auto &term : jlc)
+    {
+        if (!term.is_array() || term.size() != 2 || !term[0].is_number_unsigned() || !term[1].is_string())
+            return false;
+        lc.push_back(std::make_pair(term[0].get<Var>(), term[1].get<std::string>()));
+    }
+    return true;
+}
+
+void skR1CSOrder::WriteLinearComb(std::ostream &out, const LinearComb &lc)
+{
+    out << '[';
+    for (size_t i = 0; i < lc.size(); ++i)
+    {
+        if (i > 0)
+            out << ',';
+        out << '[' << lc[i].first << ",\"" << lc[i].second << "\"]";
+    }
+    out << ']';
+}
+
+bool skR1CSOrder::Compute(const std::string &r1csFile)
+{
+    skTrace::Span span("r1cs.order");
+    std::ifstream in(r1csFile);
+    if (!in.good())
+        return false;
+    header.clear();
+    constraints.clear();
+    json jheader;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty())
+            continue;
+        json jc = json::parse(line, nullptr, false);
+        if (jc.is_discarded() || !jc.is_object())
+            return false;
+        if (jc.count("r1cs") > 0)
+        {
+            //the header is padded, so that GateKeeper can update it; it is kept as is
+            header = line;
+            jheader = jc["r1cs"];
+            continue;
+        }
+        Constraint c;
+        if (!ParseLinearComb(jc["A"], c.lc[0]) || !ParseLinearComb(jc["B"], c.lc[1]) || !ParseLinearComb(jc["C"], c.lc[2]))
+            return false;
+        constraints.push_back(std::move(c));
+    }
+    if (header.empty() || !jheader["instance_nb"].is_number_unsigned() || !jheader["witness_nb"].is_number_unsigned())
+        return false;
+    instances = jheader["instance_nb"];
+    const size_t witnesses = jheader["witness_nb"];
+    for (const Constraint &c : constraints)
+        for (const LinearComb &lc : c.lc)
+            for (const auto &term : lc)
+                if (term.first > instances + witnesses)
+                {
+                    printf("variable %u is out of the %lu witnesses of %s\n", term.first, (unsigned long)witnesses, r1csFile.c_str());
+                    return false;
+                }
+    newIndex.assign(witnesses, kUnset);
+    spanBefore = MeanSpan(false);
+    Order();
+    spanAfter = MeanSpan(true);
+    skTrace::Count("constraints", constraints.size());
+    skTrace::Count("witnesses", witnesses);
+    return true;
+}
+
+void skR1CSOrder::Order()
+{
+    const size_t n = constraints.size(), witnesses = newIndex.size();
+    //the witnesses of each constraint, once, and the constraints of each witness (compressed rows)
+    std::vector<size_t> varStart(n + 1, 0), degree(witnesses, 0);
+    std::vector<Var> vars;
+    std::vector<size_t> seen(witnesses, n);
+    for (size_t c = 0; c < n; ++c)
+    {
+        for (const LinearComb &lc : constraints[c].lc)
+        {
+            for (const auto &term : lc)
+            {
+                if (term.first <= instances)
+                    continue;
+                const Var k = term.first - instances - 1;
+                if (seen[k] == c)
+                    continue;
+                seen[k] = c;
+                vars.push_back(k);
+                ++degree[k];
+            }
+        }
+        varStart[c + 1] = vars.size();
+    }
+    std::vector<size_t> consStart(witnesses + 1, 0);
+    for (size_t k = 0; k < witnesses; ++k)
+        consStart[k + 1] = consStart[k] + degree[k];
+    std::vector<size_t> cons(vars.size()), fill(consStart.begin(), consStart.end() - 1);
+    for (size_t c = 0; c < n; ++c)
+        for (size_t i = varStart[c]; i < varStart[c + 1]; ++i)
+            cons[fill[vars[i]]++] = c;
+
+    //breadth-first from the first constraint not yet visited (the circuits are not always connected)
+    Var next = 0;
+    std::vector<bool> visited(n, false);
+    std::vector<size_t> queue;
+    queue.reserve(n);
+    std::vector<Var> fresh;
+    for (size_t start = 0; start < n; ++start)
+    {
+        if (visited[start])
+            continue;
+        visited[start] = true;
+        queue.push_back(start);
+        for (size_t head = queue.size() - 1; head < queue.size(); ++head)
+        {
+            const size_t c = queue[head];
+            fresh.clear();
+            for (size_t i = varStart[c]; i < varStart[c + 1]; ++i)
+                if (newIndex[vars[i]] == kUnset)
+                    fresh.push_back(vars[i]);
+            std::stable_sort(fresh.begin(), fresh.end(), [&degree](Var a, Var b) { return degree[a] < degree[b]; });
+            for (Var k : fresh)
+                newIndex[k] = next++;
+            for (Var k : fresh)
+            {
+                for (size_t j = consStart[k]; j < consStart[k + 1]; ++j)
+                {
+                    if (!visited[cons[j]])
+                    {
+                        visited[cons[j]] = true;
+                        queue.push_back(cons[j]);
+                    }
+                }
+            }
+        }
+    }
+    //witnesses in no constraint, at the end
+    for (size_t k = 0; k < witnesses; ++k)
+        if (newIndex[k] == kUnset)
+            newIndex[k] = next++;
+}
+
+skR1CSOrder::Var skR1CSOrder::Renumber(Var v) const
+{
+    return v <= instances ? v : static_cast<Var>(instances + 1 + newIndex[v - instances - 1]);
+}
+
+double skR1CSOrder::MeanSpan(bool renumbered) const
+{
+    double total = 0;
+    size_t counted = 0;
+    for (const Constraint &c : constraints)
+    {
+        Var lo = kUnset, hi = 0;
+        for (const LinearComb &lc : c.lc)
+        {
+            for (const auto &term : lc)
+            {
+                if (term.first <= instances)
+                    continue;
+                const Var v = renumbered ? Renumber(term.first) : term.first;
+                lo = std::min(lo, v);
+                hi = std::max(hi, v);
+            }
+        }
+        if (lo != kUnset)
+        {
+            total += hi - lo;
+            ++counted;
+        }
+    }
+    return counted > 0 ? total / counted : 0;
+}
+
+bool skR1CSOrder::WriteR1CS(const std::string &r1csFile) const
+{
+    skTrace::Span span("r1cs.write");
+    const std::string tmp = r1csFile + ".tmp";
+    {
+        std::ofstream out(tmp);
+        if (!out.good())
+            return false;
+        out << header << "\n";
+        LinearComb lc;
+        for (const Constraint &c : constraints)
+        {
+            static const char *names[] = { "{\"A\":", ",\"B\":", ",\"C\":" };
+            for (int m = 0; m < 3; ++m)
+            {
+                lc = c.lc[m];
+                for (auto &term : lc)
+                    term.first = Renumber(term.first);
+                std::sort(lc.begin(), lc.end(), [](const std::pair<Var, std::string> &a, const std::pair<Var, std::string> &b) { return a.first < b.first; });
+                out << names[m];
+                WriteLinearComb(out, lc);
+            }
+            out << "}\n";
+        }
+        if (!out.good())
+            return false;
+    }
+    return std::rename(tmp.c_str(), r1csFile.c_str()) == 0;
+}
+
+bool skR1CSOrder::SaveOrder(const std::string &orderFile) const
+{
+    json j;
+    j["instance_nb"] = instances;
+    j["witness_nb"] = newIndex.size();
+    j["new_index"] = newIndex;
+    std::ofstream out(orderFile);
+    out << j.dump() << "\n";
+    return out.good();
+}
+
+bool skR1CSOrder::LoadOrder(const std::string &orderFile)
+{
+    std::ifstream in(orderFile);
+    if (!in.good())
+        return false;
+    json j = json::parse(in, nullptr, false);
+    if (j.is_discarded() || !j["instance_nb"].is_number_unsigned() || !j["new_index"].is_array())
+        return false;
+    instances = j["instance_nb"];
+    newIndex = j["new_index"].get<std::vector<Var>>();
+    //it must be a permutation
+    std::vector<bool> hit(newIndex.size(), false);
+    for (Var k : newIndex)
+    {
+        if (k >= newIndex.size() || hit[k])
+            return false;
+        hit[k] = true;
+    }
+    return true;
+}
+
+bool skR1CSOrder::Apply(const std::string &inputsFile) const
+{
+    skTrace::Span span("witness.order");
+    json jin;
+    std::string rest;
+    {
+        std::ifstream in(inputsFile);
+        if (!in.good())
+            return false;
+        in >> jin;
+        //GateKeeper appends the decoded public values, which do not change
+        rest.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    json &witnesses = jin["witnesses"];
+    if (!witnesses.is_array() || witnesses.size() != newIndex.size())
+    {
+        printf("the assignment %s does not have the %lu witnesses of the circuit\n", inputsFile.c_str(), (unsigned long)newIndex.size());
+        return false;
+    }
+    json renumbered = json::array();
+    renumbered.get_ref<json::array_t &>().resize(newIndex.size());
+    for (size_t k = 0; k < newIndex.size(); ++k)
+        renumbered[newIndex[k]] = std::move(witnesses[k]);
+    witnesses = std::move(renumbered);
+    std::ofstream out(inputsFile);
+    out << jin.dump() << rest;
+    return out.good();
+}
+
+void skR1CSOrder::Report(std::ostream &out) const
+{
+    out << std::fixed << std::setprecision(1);
+    out << "witness span per constraint: " << spanBefore << " before, " << spanAfter << " after ("
+        << constraints.size() << " constraints, " << newIndex.size() << " witnesses)\n";
+}
+
+json skR1CSOrder::ReportJson() const
+{
+    json report;
+    report["constraints"] = constraints.size();
+    report["witnesses"] = newIndex.size();
+    report["span"] = {{"before", spanBefore}, {"after", spanAfter}};
+    return report;
+}
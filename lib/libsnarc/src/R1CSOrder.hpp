@@ -0,0 +1,68 @@
+#ifndef R1CS_ORDER_HPP_
+#define R1CS_ORDER_HPP_
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "json.hpp"
+
+//Renumbering of the witnesses of a j-r1cs file (.j1cs), for the memory locality of the provers.
+//GateKeeper and CircuitReader number the witnesses in gate order, so the variables of a constraint can be far apart,
+//and so are the values the provers read when they evaluate the matrices or prepare their multi-exponentiations.
+//The witnesses are renumbered by a Cuthill-McKee order of the constraint-variable graph: the constraints are visited
+//breadth-first from the first one, and the new witnesses of a constraint are numbered in increasing degree.
+//The one-constant and the public inputs and outputs keep their indexes, so the proofs are verified the same way.
+//The terms of each linear combination are sorted by index. The constraints, their order and the header are unchanged.
+//
+//The permutation is saved next to the constraints (<j1cs>.order), for the assignments of the same circuit
+//computed later in the original order (WitnessSolver).
+class skR1CSOrder
+{
+    public:
+    typedef unsigned int Var;
+    //coefficients are kept as written (decimal)
+    typedef std::vector<std::pair<Var, std::string>> LinearComb;
+
+    skR1CSOrder();
+
+    //Read the constraints of a j1cs file and compute the new order of its witnesses; returns false if it cannot be parsed
+    bool Compute(const std::string &r1csFile);
+
+    //Write the renumbered constraints
+    bool WriteR1CS(const std::string &r1csFile) const;
+
+    //Save or load the permutation
+    bool SaveOrder(const std::string &orderFile) const;
+    bool LoadOrder(const std::string &orderFile);
+
+    //Renumber the witnesses of an assignment (.j1cs.in) of the circuit, in place
+    bool Apply(const std::string &inputsFile) const;
+
+    //Mean distance between the first and last witnesses of a constraint, before and after
+    void Report(std::ostream &out) const;
+    nlohmann::json ReportJson() const;
+
+    private:
+    struct Constraint
+    {
+        LinearComb lc[3];
+    };
+
+    std::string header;
+    std::vector<Constraint> constraints;
+    size_t instances;
+    //newIndex[k]: new position of the witness k (variable instances + 1 + k)
+    std::vector<Var> newIndex;
+    double spanBefore, spanAfter;
+
+    static bool ParseLinearComb(const nlohmann::json &jlc, LinearComb &lc);
+    static void WriteLinearComb(std::ostream &out, const LinearComb &lc);
+
+    //Cuthill-McKee order of the witnesses
+    void Order();
+    Var Renumber(Var v) const;
+    double MeanSpan(bool renumbered) const;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include "Trace.hpp"
+#include "json.hpp"
+#include <chrono>
+#include <fstream>
+#include <sys/resource.h>
+
+std::string skTrace::file;
+skTrace::Span *skTrace::current = NULL;
+
+void skTrace::Enable(const std::string &fname)
+{
+	file = fname;
+	current = NULL;
+}
+
+bool skTrace::Enabled()
+{
+	return !file.empty();
+}
+
+void skTrace::Count(const std::string &key, long long value)
+{
+	if (current != NULL)
+		current->counts[key] = value;
+}
+
+long long skTrace::NowUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+long long skTrace::CpuUs()
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return (long long)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000
+		+ usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+long long skTrace::PeakRssKb()
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+}
+
+skTrace::Span::Span(const std::string &name) : name(name), parent(NULL), depth(0)
+{
+	if (!skTrace::Enabled())
+		return;
+	parent = skTrace::current;
+	depth = parent ? parent->depth + 1 : 0;
+	skTrace::current = this;
+	start_us = skTrace::NowUs();
+	start_cpu_us = skTrace::CpuUs();
+}
+
+skTrace::Span::~Span()
+{
+	if (!skTrace::Enabled())
+		return;
+	nlohmann::json event;
+	event["name"] = name;
+	event["ts"] = start_us;
+	event["dur"] = skTrace::NowUs() - start_us;
+	event["cpu"] = skTrace::CpuUs() - start_cpu_us;
+	event["rss"] = skTrace::PeakRssKb();
+	event["depth"] = depth;
+	if (!counts.empty())
+		event["counts"] = counts;
+	skTrace::current = parent;
+
+	std::ofstream o(skTrace::file, std::ofstream::app);
+	o << event.dump() << std::endl;
+}
@@ -0,0 +1,56 @@
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+
+#include <map>
+#include <string>
+
+//Per-stage tracing, the C++ side of src/common/trace.cr
+//Spans are appended as one json object per line to the file given to skTrace::Enable,
+//and merged by the Crystal driver into its Chrome trace. Nothing is recorded until Enable is called.
+class skTrace
+{
+    public:
+    //Start recording spans into 'fname'
+    static void Enable(const std::string &fname);
+
+    //Returns true if tracing has been enabled
+    static bool Enabled();
+
+    //Attach a counter (gates, constraints, witnesses...) to the innermost open span
+    static void Count(const std::string &key, long long value);
+
+    //Monotonic time in microseconds, same clock as Time.monotonic on the Crystal side
+    static long long NowUs();
+
+    //User+system cpu time of the process in microseconds
+    static long long CpuUs();
+
+    //Peak resident set size of the process in kB
+    static long long PeakRssKb();
+
+    //RAII span: recorded when it goes out of scope
+    class Span
+    {
+        public:
+        explicit Span(const std::string &name);
+        ~Span();
+
+        private:
+        Span(const Span &);
+        Span &operator=(const Span &);
+
+        std::string name;
+        long long start_us;
+        long long start_cpu_us;
+        std::map<std::string, long long> counts;
+        Span *parent;
+        int depth;
+        friend class skTrace;
+    };
+
+    private:
+    static std::string file;
+    static Span *current;
+};
+
+#endif
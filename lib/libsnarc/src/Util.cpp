@@ -1,4 +1,5 @@
 #include "Util.hpp"
+#include "FieldCodec.hpp"
 #include <gmpxx.h>
 #include <fstream>
 
@@ -16,13 +17,7 @@ void skUtils::readIds(char* str, std::vector<unsigned int>& vec)
 
 FieldT skUtils::HexStringToField(char* inputStr)
 {
-	char constStrDecimal[150];
-	mpz_t integ;
-	mpz_init_set_str(integ, inputStr, 16);
-	mpz_get_str(constStrDecimal, 10, integ);
-	mpz_clear(integ);
-	FieldT f = FieldT(constStrDecimal);
-	return f;
+	return skFieldCodec<FieldT>::FromHex(inputStr);
 
 }
 
@@ -31,11 +26,7 @@ FieldT skUtils::HexStringToField(char* inputStr)
 //Helper to convert coefficient to string
 std::string skUtils::FieldToString(FieldT cc)
 {
-	mpz_t t;
-    mpz_init(t);
-   	cc.as_bigint().to_mpz(t);
-	mpz_class big_coeff(t);		//As recommended by GMP library; cf. https://gmplib.org/manual/Converting-Integers.html
-	return big_coeff.get_str();
+	return skFieldCodec<FieldT>::ToDecimal(cc);
 }
 
 
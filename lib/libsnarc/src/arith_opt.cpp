@@ -0,0 +1,53 @@
+//Command line front-end of skArithOptimizer:
+//  arith_opt [--one-wire=N] [--report=FILE] circuit.arith optimized.arith
+//The inputs file (circuit.arith.in) is copied next to the optimized circuit, since the input wires are kept.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <iostream>
+#include "ArithOptimizer.hpp"
+
+static int Usage()
+{
+    fprintf(stderr, "Usage: arith_opt [--one-wire=N] [--report=FILE] circuit.arith optimized.arith\n");
+    fprintf(stderr, "  --one-wire=N   input wire with the value 1 (default: the input commented as one-input, or else the first input)\n");
+    fprintf(stderr, "  --report=FILE  write the gate counts before and after in json to FILE\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    long long oneWire = -1;
+    std::string report;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "--one-wire=", 11) == 0)
+            oneWire = atoll(argv[i] + 11);
+        else if (strncmp(argv[i], "--report=", 9) == 0)
+            report = argv[i] + 9;
+        else if (argv[i][0] == '-')
+            return Usage();
+        else
+            files.push_back(argv[i]);
+    }
+    if (files.size() != 2)
+        return Usage();
+
+    skArithOptimizer optimizer(oneWire);
+    if (!optimizer.Optimize(files[0]) || !optimizer.Write(files[1]))
+        return 1;
+    optimizer.Report(std::cout);
+    if (!report.empty() && !skUtils::WriteJson2File(report, optimizer.ReportJson()))
+        return 1;
+
+    std::ifstream in(files[0] + ".in", std::ios::binary);
+    if (files[0] != files[1] && in.good())
+    {
+        std::ofstream out(files[1] + ".in", std::ios::binary);
+        out << in.rdbuf();
+    }
+    return 0;
+}
@@ -5,7 +5,12 @@
 #include "skAurora.hpp"
 #include "skLigero.hpp"
 #include "skFractal.hpp"
+#include "skPlonk.hpp"
+#include "r1cs_libiop.hpp"
 #include "Util.hpp"
+#include "Trace.hpp"
+#include "ArithOptimizer.hpp"
+#include "R1CSCheck.hpp"
 
 using namespace std; 
 
@@ -63,11 +68,39 @@ bool generateR1cs(char* arithFile, char* inputsFile, char * r1csFile)
 	return r1cs.Arith2Jsonl(afname, ifname, jfname);
 }
 
+//Optimize an arithmetic circuit, see ArithOptimizer.hpp
+bool optimizeArith(char* arithFile, char* outFile, char* reportFile)
+{
+	skArithOptimizer optimizer;
+	if (!optimizer.Optimize(arithFile) || !optimizer.Write(outFile))
+		return false;
+	optimizer.Report(std::cout);
+	if (reportFile != NULL && reportFile[0] != '\0')
+		return skUtils::WriteJson2File(reportFile, optimizer.ReportJson());
+	return true;
+}
+
+//Settings of the satisfaction check of the provers, see R1CSCheck.hpp
+void r1csCheck(int enabled, int maxFailures)
+{
+	skR1CSCheck::SetEnabled(enabled != 0);
+	skR1CSCheck::SetMaxFailures(maxFailures > 0 ? maxFailures : 1);
+}
+
+//Check the assignment of an R1CS, see R1CSCheck.hpp
+bool checkR1cs(char* r1csFile, char* arithFile)
+{
+	skR1CSCheck::SetCircuit(arithFile != NULL ? arithFile : "");
+	return CheckR1CS(r1csFile);
+}
+
 // Generate the trusted setup
 //r1csFile: j-r1cs input file 
 //setupFile: name of the out file that will contain the trusted setup in json
 //TEMP ts:output verifiable computing setup, to return the data in the out argument, but we need to properly allocate the strings; should be allocated byt the called first
 //For debuggin purpose, if r1csFile ends with .arith, it will consider the file as a circuit and convert it first to r1cs
+//For fractal, the setup is the verifier index of the constraint system
+//For plonk, r1csFile is the arithmetic circuit and the setup is its key, computed from the reference string (see plonkSrs)
 void vcSetup(char* r1csFile, char * setupFile /*, char** ts*/, int scheme)
 {
 	std::string afname(r1csFile);
@@ -75,6 +108,19 @@ void vcSetup(char* r1csFile, char * setupFile /*, char** ts*/, int scheme)
 	std::string trustedSetup;
 	Snarks r1cs;
 	Snarks::zkp_scheme zcheme = Snarks::zkp_scheme(scheme);
+	if (zcheme == Snarks::zkp_scheme::fractal)
+	{
+		//the setup of fractal is the (transparent) index of the constraint system
+		skFractal fractal;
+		fractal.Index(afname, setupfName);
+		return;
+	}
+	if (zcheme == Snarks::zkp_scheme::plonk)
+	{
+		skPlonk plonk;
+		plonk.Index(afname, setupfName);
+		return;
+	}
 	r1cs.VCSetup(afname, trustedSetup, zcheme);
 	//*ts = (char *)trustedSetup.c_str();
 	std::ofstream o(setupfName);
@@ -86,8 +132,10 @@ void vcSetup(char* r1csFile, char * setupFile /*, char** ts*/, int scheme)
 //setup: file name of the trusted setup in json format
 //inputs: file name of the inputs in json format. We need the full assignments OR filename of the r1cs in j1cs format, assignements must also be present as .in file
 //proofFile: file name of the out file that will contain the proof in json format. Optional, no file created if not defined
-// returns: the proof in json format
-char * Prove(char * setup, char * inputs, char * proofFile, int scheme)
+//  libiop proofs (aurora, ligero, fractal) are written in binary form, unless proofFile ends with .json
+//  for libiop proofs, inputs can also be an arithmetic circuit (.arith, with its .arith.in file), converted in memory
+// returns: true if the proof is generated
+bool Prove(char * setup, char * inputs, char * proofFile, int scheme)
 {
 	std::string ts(setup);
 	std::string ins(inputs);
@@ -100,27 +148,29 @@ char * Prove(char * setup, char * inputs, char * proofFile, int scheme)
 	if (scheme == Snarks::zkp_scheme::aurora)
 	{
 		skAurora aurora;	//TODO try factory pattern
-		nlohmann::json jkey = aurora.Proof(ins, ts);
-		skUtils::WriteJson2File(pfile, jkey);
-		return "";	//TODO
+		return aurora.Proof(ins, ts, pfile);
 	}
 	else if (scheme == Snarks::zkp_scheme::ligero)
 	{
 		skLigero ligero;
-		nlohmann::json jkey = ligero.Proof(ins, ts);
-		skUtils::WriteJson2File(pfile, jkey);
-		return "";
+		return ligero.Proof(ins, ts, pfile);
 	}
 	else if (scheme == Snarks::zkp_scheme::fractal)
 	{
 		skFractal fractal;
-		nlohmann::json jkey = fractal.Proof(ins, ts);
-		skUtils::WriteJson2File(pfile, jkey);
-		return ""; //TODO 
+		return fractal.Proof(ins, ts, pfile);
+	}
+	else if (scheme == Snarks::zkp_scheme::plonk)
+	{
+		skPlonk plonk;
+		return plonk.Proof(ins, ts, pfile);
 	}
 	Snarks r1cs;
 
 	nlohmann::json jkey = r1cs.Proof(ins, ts, zcheme);
+	//no proof when the check fails
+	if (jkey.is_null())
+		return false;
 	
 	if (pfile.length() > 0)
 	{
@@ -130,13 +180,38 @@ char * Prove(char * setup, char * inputs, char * proofFile, int scheme)
     	o.close();
 	}
 
-	return NULL;//TEMP (char*)jkey.dump().c_str();
+	return true;
+}
+
+//Set the structured reference string of plonk (plonk.srs by default)
+void plonkSrs(char * srsFile)
+{
+	skPlonk::SetSrsFile(std::string(srsFile));
+}
+
+//Let the plonk setup generate a missing reference string (see skPlonk::SetInsecureDevSrs)
+void plonkInsecureDevSrs(int allow)
+{
+	skPlonk::SetInsecureDevSrs(allow != 0);
+}
+
+//Set the lookups of plonk circuits (see skPlonkCircuit::LookupMode)
+void plonkLookups(int mode)
+{
+	skPlonk::SetLookups(mode);
+}
+
+//Enable per-stage tracing (see Trace.hpp)
+//traceFile: spans are appended to this file, one json object per line
+void traceEnable(char * traceFile)
+{
+	skTrace::Enable(std::string(traceFile));
 }
 
 //Verify a proof:
 //setup: file name of the trusted setup in json format
 //inputs: file name of the inputs in json format.
-//proof: file name of the proof in json format.
+//proof: file name of the proof in json format (or binary for libiop proofs).
 bool Verify(char * setup, char * inputs, char * proof)
 {
 
@@ -144,24 +219,30 @@ bool Verify(char * setup, char * inputs, char * proof)
 	std::string p(proof);
 	std::string ins(inputs);
 
-	json jProof = skUtils::LoadJsonFromFile(p);
-	if (jProof["type"] == "ligero")
+	std::string type = LibiopProofType(p);
+	if (type == "ligero")
 	{
 		skLigero ligero;
-		return ligero.Verify(ins, jProof);
+		return ligero.Verify(ins, p);
 	}
-	else if (jProof["type"] == "aurora")
+	else if (type == "aurora")
 	{
 		skAurora aurora;
-		return aurora.Verify(ins, jProof);	
+		return aurora.Verify(ins, p);	
+	}
+	else 	if (type == "fractal")
+	{
+		skFractal fractal;
+		return fractal.Verify(std::string(setup), p);
 	}
-	else 	if (jProof["type"] == "fractal")
+	else if (type == "plonk")
 	{
-	//	skFractal fractal;
-	//	return fractal.Verify(ins, jProof);
+		skPlonk plonk;
+		return plonk.Verify(std::string(setup), p);
 	}
 	else
 	{
+		json jProof = skUtils::LoadJsonFromFile(p);
 		Snarks r1cs;
 		std::string ts(setup);
 
@@ -25,24 +25,62 @@ bool MyFunction(char **toto);
 // if r1csFile is not specified, it create a file by replacing the .arith extension with .r1cs
 bool generateR1cs(char* arithFile, char* inputsFile, char * r1csFile);
 
+//Optimize an arithmetic circuit (common subexpressions, constants, add chains and const-mul, see ArithOptimizer.hpp)
+// arithFile: file path of the arithmetic circuit in Pinnochio format (.arith)
+// outFile: file path of the optimized circuit; it has the same input wires, so the inputs file is still valid
+// reportFile: the gate counts before and after are written to this file in json (optional)
+// returns: true if the circuit could be optimized
+bool optimizeArith(char* arithFile, char* outFile, char* reportFile);
+
+//Settings of the satisfaction check run by the provers before proving (see R1CSCheck.hpp)
+//enabled: 0 to skip the check, in production
+//maxFailures: number of failing constraints reported
+void r1csCheck(int enabled, int maxFailures);
+
+//Check the assignment (r1csFile.in) of an R1CS and print its first failing constraints
+//arithFile: the circuit of the R1CS, to print the gates and source locations of the failures; may be empty
+// returns: true if the R1CS is satisfied
+bool checkR1cs(char* r1csFile, char* arithFile);
+
 // Generate the trusted setup
 //r1csFile: j-r1cs input file 
 //setupFile: name of the out file that will contain the trusted setup in json
 //TEMP ts:output verifiable computing setup, to return the data in the out argument, but we need to properly allocate the strings; should be allocated byt the called first
+//For fractal, the setup is the verifier index of the constraint system
+//For plonk, r1csFile is the arithmetic circuit and the setup is its key, computed from the reference string (see plonkSrs)
 void vcSetup(char* r1csFile, char * setupFile /*, char** ts*/, int scheme);
 
 //Generate a proof
 //setup: file name of the trusted setup in json format
 //inputs: file name of the inputs in json format. We need the full assignments.
 //proofFile: file name of the out file that will contain the proof in json format. Optional, no file created if not defined
+//  libiop proofs (aurora, ligero, fractal) are written in binary form, unless proofFile ends with .json
+//  for libiop proofs, inputs can also be an arithmetic circuit (.arith, with its .arith.in file), converted in memory
+//  for plonk proofs, inputs is the arithmetic circuit (with its .arith.in file) and the proof is in json
 //scheme: 1 for libsnark, 2 for bulletproof, 3 for aurora
-// returns: the proof in json format
-char * Prove(char * setup, char * inputs, char * proofFile, int scheme);
+// returns: true if the proof is generated; false if the assignment does not satisfy the constraints (see r1csCheck) or on error
+bool Prove(char * setup, char * inputs, char * proofFile, int scheme);
+
+//Set the structured reference string of plonk, shared by all circuits (plonk.srs by default)
+//srsFile: it must come from a setup ceremony; the setup fails when it is missing or when a circuit does not fit
+void plonkSrs(char * srsFile);
+
+//Let the plonk setup generate (or regenerate larger) the reference string from a local random tau, instead of failing
+//allow: 0 (default) or 1; a generated string makes the proofs forgeable by whoever generated it, for tests only
+void plonkInsecureDevSrs(int allow);
+
+//Set the lookups of plonk circuits: 0 none, 1 range tables only, 2 auto (default), 3 all tables
+//mode: the key of a circuit records it, and its proofs use the same
+void plonkLookups(int mode);
+
+//Enable per-stage tracing (see Trace.hpp)
+//traceFile: spans are appended to this file, one json object per line
+void traceEnable(char * traceFile);
 
 //Verify a proof:
 //setup: file name of the trusted setup in json format
 //inputs: file name of the inputs in json format.
-//proof: file name of the proof in json format.
+//proof: file name of the proof in json format (or binary for libiop proofs).
 bool Verify(char * setup, char * inputsFile, char * proof);
 
 
@@ -1,6 +1,8 @@
 
 #include "libsnark_wrapper.hpp"
 #include "r1cs_utils.hpp"
+#include "R1CSCheck.hpp"
+#include "Trace.hpp"
 #include <libsnark/gadgetlib2/integration.hpp>
 #include <libsnark/gadgetlib2/adapters.hpp>
 #include <libsnark/zk_proof_systems/ppzksnark/r1cs_ppzksnark/examples/run_r1cs_ppzksnark.hpp>
@@ -89,6 +91,7 @@ bool Snarks::Arith2Jsonl(const std::string &arithFile, const std::string &inputs
 
 bool TS(const std::string &jr1cs, std::string &ts, Snarks::zkp_scheme scheme)
 {
+	skTrace::Span span("setup");
 	R1CSUtils r1cs;
 	r1cs_constraint_system<FieldT> cs;
 	if (skUtils::endsWith(jr1cs, ".arith"))
@@ -99,6 +102,7 @@ bool TS(const std::string &jr1cs, std::string &ts, Snarks::zkp_scheme scheme)
 	}
 	else
 		r1cs.FromJsonl(jr1cs, cs);
+	skTrace::Count("constraints", cs.num_constraints());
 		
 	if (scheme == Snarks::zkp_scheme::groth16)
 	{
@@ -124,7 +128,7 @@ bool Snarks::VCSetup(const std::string &jr1cs , std::string &ts, zkp_scheme sche
 
 
 template<typename ppT>
-json Proover_pp(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliary_input<FieldT>& aux_i, const json &j_ts)
+json Proover_pp(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliary_input<FieldT>& aux_i, const json &j_ts, const std::string &r1csFile)
 {
 	//load the proving key
 	r1cs_ppzksnark_proving_key<ppT> pk;
@@ -133,11 +137,12 @@ json Proover_pp(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliar
 	ss << skUtils::base64_decode(pk64);
 	ss >> pk;
 
-	if (pk.constraint_system.is_satisfied(primary_i, aux_i))
-		printf("R1CS is satisfied.\n");
-	else
+	//the proof of an assignment which does not satisfy the constraints would not verify
+	if (skR1CSCheck::Enabled())
 	{
-		printf("NOT SATISFIED!!\n");
+		R1CSUtils r1cs;
+		if (!r1cs.CheckSatisfied(pk.constraint_system, primary_i, aux_i, r1csFile))
+			return json();
 	}
 	
 	//generate the proof
@@ -153,7 +158,7 @@ json Proover_pp(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliar
 
 
 template<typename ppT>
-json Proover_gg(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliary_input<FieldT>& aux_i, const json &j_ts)
+json Proover_gg(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliary_input<FieldT>& aux_i, const json &j_ts, const std::string &r1csFile)
 {
 	//load the proving key
 	r1cs_gg_ppzksnark_proving_key<ppT> pk;
@@ -162,11 +167,12 @@ json Proover_gg(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliar
 	ss << skUtils::base64_decode(pk64);
 	ss >> pk;
 
-	if (pk.constraint_system.is_satisfied(primary_i, aux_i))
-		printf("R1CS is satisfied.\n");
-	else
+	//the proof of an assignment which does not satisfy the constraints would not verify
+	if (skR1CSCheck::Enabled())
 	{
-		printf("NOT SATISFIED!!\n");
+		R1CSUtils r1cs;
+		if (!r1cs.CheckSatisfied(pk.constraint_system, primary_i, aux_i, r1csFile))
+			return json();
 	}
 	
 	//generate the proof
@@ -187,6 +193,7 @@ json Proover_gg(const	r1cs_primary_input<FieldT>& primary_i,	const r1cs_auxiliar
 //trustedSetup: json string of the base64 encoded trusted setup
 json Snarks::Proof(const std::string &inputsFile, const std::string &trustedSetup, zkp_scheme scheme)
 {
+	skTrace::Span span("prove");
 	//init
 	R1CSUtils r1cs;
 	r1cs.InitR1CS();
@@ -201,20 +208,22 @@ json Snarks::Proof(const std::string &inputsFile, const std::string &trustedSetu
 
 	//load trusted setup from file
 	json jSetup = skUtils::LoadJsonFromFile(trustedSetup);
+	//the constraints of the inputs file, to locate the failures of the check
+	std::string r1csFile = skUtils::endsWith(inputsFile, ".in") ? inputsFile.substr(0, inputsFile.size() - 3) : "";
 
 	switch (scheme)
 	{
 	case groth16:
-		return Proover_gg<libff::default_ec_pp>(primary_input, auxiliary_input, jSetup);
+		return Proover_gg<libff::default_ec_pp>(primary_input, auxiliary_input, jSetup, r1csFile);
 		break;
 	case bctv14a:
-		return Proover_pp<libff::default_ec_pp>(primary_input, auxiliary_input, jSetup);
+		return Proover_pp<libff::default_ec_pp>(primary_input, auxiliary_input, jSetup, r1csFile);
 		break;
 	default:
 		printf("ERROR - Non supported scheme!!\n");
 		break;
 	}
-	return jSetup.empty();
+	return json();
 	
 }
 
@@ -297,6 +306,7 @@ bool Verifier_gg(const r1cs_primary_input<FieldT>  &primary_input, json & jsetup
 
 bool Snarks::Verify(const std::string& tsetup, std::string inputs, json jProof)
 {
+	skTrace::Span span("verify");
 	R1CSUtils r1cs;
 	//init
 	r1cs.InitR1CS();
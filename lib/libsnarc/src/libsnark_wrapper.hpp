@@ -22,7 +22,8 @@ public:
         dalek  ,
         aurora,
         ligero,
-        fractal
+        fractal,
+        plonk
     };
 
 
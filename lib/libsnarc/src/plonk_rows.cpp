@@ -0,0 +1,81 @@
+//Command line front-end of skPlonkCircuit, to count and check the rows of a circuit without proving it:
+//  plonk_rows [--lookups=MODE] circuit.arith
+//The values come from circuit.arith.in. One line is printed for each lookup mode (all of them by default):
+//the mode, the rows, the variables and the rows of each kind of gate. The exit status is 1 if the inputs
+//do not satisfy the rows of a mode, either a gate or a lookup missing its table.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "PlonkCircuit.hpp"
+
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+
+typedef libff::Fr<libff::alt_bn128_pp> PlonkField;
+typedef skPlonkCircuit<PlonkField> Circuit;
+
+static const char *kModes[] = {"none", "range", "auto", "all"};
+
+static int Usage()
+{
+    fprintf(stderr, "Usage: plonk_rows [--lookups=MODE] circuit.arith\n");
+    fprintf(stderr, "  --lookups=MODE  none, range, auto or all (default: each of them)\n");
+    return 2;
+}
+
+//Loads the circuit with the lookups 'mode' and prints its rows; returns false if it is not satisfied
+static bool CheckMode(const std::string &arithFile, int mode)
+{
+    Circuit circuit;
+    circuit.SetLookups(static_cast<Circuit::LookupMode>(mode));
+    if (!circuit.Load(arithFile, arithFile + ".in"))
+    {
+        printf("%s: the circuit %s cannot be loaded, or a lookup misses its table\n", kModes[mode], arithFile.c_str());
+        return false;
+    }
+    printf("%s rows=%lu variables=%lu", kModes[mode], (unsigned long)circuit.Rows().size(), (unsigned long)circuit.NumVars());
+    for (const auto &kv : circuit.RowCounts())
+        printf(" %s=%lld", kv.first.c_str(), kv.second);
+    printf("\n");
+    const long long row = circuit.FirstUnsatisfied();
+    if (row >= 0)
+    {
+        printf("%s: row %lld of %s is not satisfied\n", kModes[mode], row, arithFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<int> modes;
+    std::string arithFile;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "--lookups=", 10) == 0)
+        {
+            int mode = 0;
+            while (mode <= Circuit::kLookupsAll && strcmp(argv[i] + 10, kModes[mode]) != 0)
+                ++mode;
+            if (mode > Circuit::kLookupsAll)
+                return Usage();
+            modes.push_back(mode);
+        }
+        else if (argv[i][0] == '-' || !arithFile.empty())
+            return Usage();
+        else
+            arithFile = argv[i];
+    }
+    if (arithFile.empty())
+        return Usage();
+    if (modes.empty())
+        for (int mode = Circuit::kLookupsNone; mode <= Circuit::kLookupsAll; ++mode)
+            modes.push_back(mode);
+
+    libff::alt_bn128_pp::init_public_params();
+    bool ok = true;
+    for (int mode : modes)
+        ok = CheckMode(arithFile, mode) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,41 @@
+//Command line front-end of skR1CSCheck:
+//  r1cs_check [--first=K] [--threads=N] [--circuit=FILE] circuit.j1cs
+//The assignment (circuit.j1cs.in) is checked against the constraints, and the first K failing constraints are printed,
+//with the line of the circuit which generated them when isekai --profile wrote circuit.j1cs.cost.
+//The constraints can also be an arithmetic circuit (.arith), converted with its inputs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "R1CSCheck.hpp"
+#include "r1cs_libiop.hpp"
+
+static int Usage()
+{
+    fprintf(stderr, "Usage: r1cs_check [--first=K] [--threads=N] [--circuit=FILE] circuit.j1cs\n");
+    fprintf(stderr, "  --first=K       number of failing constraints reported (default 10)\n");
+    fprintf(stderr, "  --threads=N     threads of the check (default: one per core)\n");
+    fprintf(stderr, "  --circuit=FILE  arithmetic circuit of the constraints, to print the gates and their source locations (FILE.dbg)\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    std::string file;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "--first=", 8) == 0)
+            skR1CSCheck::SetMaxFailures(atol(argv[i] + 8));
+        else if (strncmp(argv[i], "--threads=", 10) == 0)
+            skR1CSCheck::SetThreads(atoi(argv[i] + 10));
+        else if (strncmp(argv[i], "--circuit=", 10) == 0)
+            skR1CSCheck::SetCircuit(argv[i] + 10);
+        else if (argv[i][0] == '-' || !file.empty())
+            return Usage();
+        else
+            file = argv[i];
+    }
+    if (file.empty())
+        return Usage();
+    return CheckR1CS(file) ? 0 : 1;
+}
@@ -7,12 +7,16 @@
 #include <libsnark/zk_proof_systems/ppzksnark/r1cs_gg_ppzksnark/r1cs_gg_ppzksnark.hpp>
 
 #include "Util.hpp"
+#include "Trace.hpp"
+#include "FieldCodec.hpp"
+#include "R1CSCheck.hpp"
 
 #include <iostream>
 #include <sstream>
 #include <fstream>
 
 #include <gmpxx.h>
+#include <sodium.h>
 #include <libff/algebra/curves/edwards/edwards_pp.hpp>
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 
@@ -25,11 +29,7 @@ using namespace libiop;
 template <class F>
 std::string FieldToString(F cc)
 {
-	mpz_t t;
-    mpz_init(t);
-   	cc.as_bigint().to_mpz(t);
-	mpz_class big_coeff(t);		//As recommended by GMP library; cf. https://gmplib.org/manual/Converting-Integers.html
-	return big_coeff.get_str();
+	return skFieldCodec<F>::ToDecimal(cc);
 //gf64
 //	char buffer [50];
 //	sprintf(buffer,"%016", cc.value());
@@ -54,6 +54,18 @@ bool WriteJson2File(const std::string &fname, const json & jsonContent)
 
 
 
+template <>
+std::string R1CSLibiop<libff::alt_bn128_Fr>::FieldName()
+{
+	return "alt_bn128";
+}
+
+template <>
+std::string R1CSLibiop<libff::edwards_Fr>::FieldName()
+{
+	return "edwards";
+}
+
 //Initialize the parameters
 template <class F>
 void R1CSLibiop<F>::InitR1CS()
@@ -91,7 +103,7 @@ linear_combination<F> R1CSLibiop<F>::parseLinearCombJson(json &jlc)
 	{
 		variable<F> var(term[0]);
 		std::string str_coeff = term[1];
-		F cc(str_coeff.c_str());
+		F cc = skFieldCodec<F>::FromDecimal(str_coeff);
 		
 		lc.add_term(var, cc);//TODO handle negative idx; something like this: if var<0; idx = primary.len - var
 		
@@ -110,7 +122,7 @@ linear_combination<F> R1CSLibiop<F>::parseLinearCombJson(json &jlc, int input_nb
 			idx = idx + input_padding-input_nb;
 		variable<F> var(idx);
 		std::string str_coeff = term[1];
-		F cc(str_coeff.c_str());
+		F cc = skFieldCodec<F>::FromDecimal(str_coeff);
 		
 		lc.add_term(var, cc);//TODO handle negative idx; something like this: if var<0; idx = primary.len - var
 		
@@ -124,19 +136,9 @@ linear_combination<F> R1CSLibiop<F>::parseLinearCombJson(json &jlc, int input_nb
 template <class F>
 json R1CSLibiop<F>::Inputs2Json(const r1cs_primary_input<F> &primary_input,const r1cs_auxiliary_input<F> &auxiliary_input)
 {
-	json j_inputs, j_wit;
-
-
-	for (F const & iter:primary_input)
-	{
-		//TODO; there should be no coef null!!	
-		j_inputs.push_back(FieldToString(iter));
-	}
-	for (F const & iter:auxiliary_input)
-	{
-		//TODO; there should be no coef null!!???
-		j_wit.push_back(FieldToString(iter));
-	}
+	std::vector<std::string> j_inputs, j_wit;
+	skFieldCodec<F>::ToDecimal(primary_input, j_inputs);
+	skFieldCodec<F>::ToDecimal(auxiliary_input, j_wit);
 	json jValue;
 	jValue["inputs"] = j_inputs;
 	jValue["witnesses"] = j_wit;
@@ -188,6 +190,7 @@ bool R1CSLibiop<F>::ToJsonl(r1cs_constraint_system<F>  &in_cs, const std::string
 template <class F>
 bool R1CSLibiop<F>::FromJsonl(const std::string jsonFile, r1cs_constraint_system<F> &out_cs, bool pad_inputs)
 {
+	skTrace::Span span("r1cs.load");
 	//read from file
 	std::ifstream r1cs_file(jsonFile);
 	if (!r1cs_file.good())
@@ -212,6 +215,9 @@ bool R1CSLibiop<F>::FromJsonl(const std::string jsonFile, r1cs_constraint_system
 			if (pad_inputs)
 	  			input_padding = libiop::round_to_next_power_of_2(input_padding+1)-1;
 			printf("input nb:%d, padding:%d\n",input_nb,input_padding);
+			//room for the padding constraints, so that Pad does not reallocate
+			if (header.count("constraint_nb") > 0)
+				out_cs.constraints_.reserve(libiop::round_to_next_power_of_2(header["constraint_nb"].get<size_t>()));
 		}
 		else
 		{
@@ -225,6 +231,8 @@ bool R1CSLibiop<F>::FromJsonl(const std::string jsonFile, r1cs_constraint_system
   	}
 	out_cs.primary_input_size_ = input_padding;// header["instance_nb"];
 	out_cs.auxiliary_input_size_ = header["witness_nb"];
+	skTrace::Count("constraints", out_cs.num_constraints());
+	skTrace::Count("witnesses", out_cs.auxiliary_input_size_);
 
 	return true;
 }
@@ -232,20 +240,13 @@ bool R1CSLibiop<F>::FromJsonl(const std::string jsonFile, r1cs_constraint_system
 template <class F>
 void R1CSLibiop<F>::Pad(r1cs_constraint_system<F> &out_cs)
 {
-
-	size_t cur_cs_nb = out_cs.num_constraints();
-	size_t cs_nb = libiop::round_to_next_power_of_2(cur_cs_nb);
-		
-	while (cur_cs_nb < cs_nb)
-	{
-		linear_combination<F> dummy;
-		variable<F> var(0);
-		F cc(0);
-		dummy.add_term(var, cc);
-		r1cs_constraint<F> constraint(dummy, dummy, dummy);
-		out_cs.add_constraint(constraint);
-		++cur_cs_nb;
-	}
+	size_t cs_nb = libiop::round_to_next_power_of_2(out_cs.num_constraints());
+	if (cs_nb == out_cs.num_constraints())
+		return;
+	//the dummy constraint 0*0=0 is built once and copied in a single resize
+	linear_combination<F> dummy;
+	dummy.add_term(variable<F>(0), F(0));
+	out_cs.constraints_.resize(cs_nb, r1cs_constraint<F>(dummy, dummy, dummy));
 }
 
 template <class F>
@@ -277,31 +278,168 @@ void R1CSLibiop<F>::PadInputs(r1cs_primary_input<F> &primary_inputs, r1cs_auxili
 
 
 
+//Convert an element between two libff prime fields of the same characteristic
+template <class F, class SF>
+F ConvertField(const SF &x)
+{
+	if (x == SF::one())
+		return F::one();
+	mpz_t t;
+	mpz_init(t);
+	x.as_bigint().to_mpz(t);
+	libff::bigint<F::num_limbs> b(t);
+	mpz_clear(t);
+	return F(b);
+}
+
+template <class F, class SF>
+bool SameCharacteristic()
+{
+	mpz_t p, q;
+	mpz_init(p);
+	mpz_init(q);
+	SF::mod.to_mpz(p);
+	F::mod.to_mpz(q);
+	bool res = (mpz_cmp(p, q) == 0);
+	mpz_clear(p);
+	mpz_clear(q);
+	return res;
+}
+
+template <class F, class SF>
+linear_combination<F> ConvertLinearComb(const libsnark::linear_combination<SF> &in_lc, size_t input_nb, size_t input_padding)
+{
+	linear_combination<F> lc;
+	lc.terms.reserve(in_lc.terms.size());
+	for (libsnark::linear_term<SF> const &lt : in_lc.terms)
+	{
+		size_t idx = lt.index;
+		if (idx > input_nb)
+			idx = idx + input_padding - input_nb;
+		lc.add_term(variable<F>(idx), ConvertField<F>(lt.coeff));
+	}
+	return lc;
+}
+
+template <class F>
+template <class SF>
+bool R1CSLibiop<F>::FromLibsnark(const libsnark::r1cs_constraint_system<SF> &in_cs, r1cs_constraint_system<F> &out_cs, bool pad_inputs)
+{
+	skTrace::Span span("r1cs.convert");
+	if (!SameCharacteristic<F, SF>())
+	{
+		printf("the constraint system is not defined over the field of the proof system\n");
+		return false;
+	}
+	size_t input_nb = in_cs.primary_input_size;
+	size_t input_padding = input_nb;
+	if (pad_inputs)
+		input_padding = libiop::round_to_next_power_of_2(input_padding+1)-1;
+
+	out_cs.constraints_.clear();
+	//room for the padding constraints, so that Pad does not reallocate
+	out_cs.constraints_.reserve(libiop::round_to_next_power_of_2(in_cs.num_constraints()));
+	for (libsnark::r1cs_constraint<SF> const &c : in_cs.constraints)
+	{
+		out_cs.constraints_.emplace_back(ConvertLinearComb<F>(c.a, input_nb, input_padding),
+										 ConvertLinearComb<F>(c.b, input_nb, input_padding),
+										 ConvertLinearComb<F>(c.c, input_nb, input_padding));
+	}
+	out_cs.primary_input_size_ = input_padding;
+	out_cs.auxiliary_input_size_ = in_cs.auxiliary_input_size;
+	skTrace::Count("constraints", out_cs.num_constraints());
+	skTrace::Count("witnesses", out_cs.auxiliary_input_size_);
+	return true;
+}
+
+template <class F>
+template <class SF>
+void R1CSLibiop<F>::InputsFromLibsnark(const libsnark::r1cs_primary_input<SF> &in_primary, const libsnark::r1cs_auxiliary_input<SF> &in_auxiliary, r1cs_primary_input<F> &primary_input, r1cs_auxiliary_input<F> &auxiliary_input)
+{
+	primary_input.reserve(libiop::round_to_next_power_of_2(in_primary.size()+1)-1);
+	for (SF const &x : in_primary)
+		primary_input.push_back(ConvertField<F>(x));
+	auxiliary_input.reserve(in_auxiliary.size());
+	for (SF const &x : in_auxiliary)
+		auxiliary_input.push_back(ConvertField<F>(x));
+}
+
+template <class F>
+bool R1CSLibiop<F>::LoadCircuit(const std::string &r1cs_filename, r1cs_constraint_system<F> &cs, r1cs_primary_input<F> &primary_input, r1cs_auxiliary_input<F> &auxiliary_input)
+{
+	std::string inputsFile = r1cs_filename + ".in";
+	if (skUtils::endsWith(r1cs_filename, ".arith"))
+	{
+		printf("converting the circuit...\n");
+		if (!LibiopFromArith<F>(r1cs_filename, inputsFile, cs, primary_input, auxiliary_input))
+			return false;
+	}
+	else
+	{
+		printf("loading constraints....\n");
+		if (!FromJsonl(r1cs_filename, cs, true))
+		{
+			printf("error with r1cs file %s\n", r1cs_filename.c_str());
+			return false;
+		}
+		if (LoadInputs(inputsFile, primary_input, auxiliary_input))
+			printf("inputs are loaded\n");
+		else
+			printf("error with inputs file\n");
+	}
+	printf("padding...\n");
+	Pad(cs);
+	PadInputs(primary_input, auxiliary_input, cs.num_constraints());
+	return true;
+}
+
+template <class F>
+static F Evaluate(const linear_combination<F> &lc, const std::vector<F> &full)
+{
+	F acc = F::zero();
+	for (linear_term<F> const &lt : lc)
+		acc += (lt.index_ == 0 ? F::one() : full[lt.index_ - 1]) * lt.coeff_;
+	return acc;
+}
+
+template <class F>
+bool R1CSLibiop<F>::CheckSatisfied(const r1cs_constraint_system<F> &cs, const r1cs_primary_input<F> &primary_input, const r1cs_auxiliary_input<F> &auxiliary_input, const std::string &r1cs_filename)
+{
+	skTrace::Span span("check");
+	std::vector<F> full(primary_input);
+	full.insert(full.end(), auxiliary_input.begin(), auxiliary_input.end());
+	if (full.size() < cs.primary_input_size_ + cs.auxiliary_input_size_)
+	{
+		printf("the assignment has %lu values for %lu variables\n", (unsigned long)full.size(), (unsigned long)(cs.primary_input_size_ + cs.auxiliary_input_size_));
+		return false;
+	}
+	//the padding constraints come after those of the file, which keep their indexes
+	return skR1CSCheck::Check<F>(cs.num_constraints(), [&cs, &full](size_t i, F &a, F &b, F &c)
+	{
+		a = Evaluate(cs.constraints_[i].a_, full);
+		b = Evaluate(cs.constraints_[i].b_, full);
+		c = Evaluate(cs.constraints_[i].c_, full);
+	}, r1cs_filename);
+}
+
 //Load the inputs from a json file .j1cs.in
 template <class F>
 bool R1CSLibiop<F>::LoadInputs(const std::string jsonFile, r1cs_primary_input<F> &primary_input, r1cs_auxiliary_input<F> &auxiliary_input)
 {
+	skTrace::Span span("witness.load");
 	//load the inputs
 	std::ifstream jfile(jsonFile);
 	if (!jfile.good())
 		return false;
 	json j_in;
 	jfile >> j_in;
-	json j_inputs = j_in["inputs"];
-	for (json::iterator it = j_inputs.begin(); it != j_inputs.end(); ++it) 
+	//TODO handle one constant at idx 0
+	if (!skFieldCodec<F>::FromDecimal(j_in["inputs"].get<std::vector<std::string>>(), primary_input)
+		|| !skFieldCodec<F>::FromDecimal(j_in["witnesses"].get<std::vector<std::string>>(), auxiliary_input))
 	{
-		std::string str_coeff = (*it);
-		F cc(str_coeff.c_str());	
-		primary_input.push_back(cc); 
-		//TODO handle one constant at idx 0
+		printf("invalid value in inputs file %s\n", jsonFile.c_str());
+		return false;
 	}
-	json j_wit = j_in["witnesses"];
-	for (json::iterator it = j_wit.begin(); it != j_wit.end(); ++it) 
-	{
-		std::string str_coeff = (*it);
-		F cc(str_coeff.c_str());
-		auxiliary_input.push_back(cc);
-  	}
 	return true;
 }
 
@@ -394,15 +532,14 @@ void  DeserializeFieldVector( std::vector<T> & vec, const json & jin)
   for (auto const& term : jin)
   {
     std::string js = term;
-    T cc(js.c_str());
-    vec.push_back(cc);
+    vec.push_back(skFieldCodec<T>::FromDecimal(js));
   }
  
 }
 
 
 template <class F>
-void R1CSLibiop<F>::SerializeProof(const bcs_transformation_transcript<F> proof, json &js)
+void R1CSLibiop<F>::SerializeProof(const bcs_transformation_transcript<F> &proof, json &js)
 {
 
     json p_msg;
@@ -518,5 +655,575 @@ void R1CSLibiop<F>::DeserializeProof(bcs_transformation_transcript<F> &proof, co
 	proof.total_depth_without_pruning = js["total_depth_without_pruning"];
 }
 
+
+//Binary proof files start with this magic and a version byte, followed by the proof type
+static const char kProofMagic[] = "skiop";
+static const size_t kProofMagicLen = 5;
+//Version 2: the limbs of the field elements are little-endian (they were in the byte order of the host)
+static const unsigned char kProofVersion = 2;
+
+static void WriteVarint(std::ostream &out, uint64_t v)
+{
+	while (v >= 0x80)
+	{
+		out.put(char((v & 0x7f) | 0x80));
+		v >>= 7;
+	}
+	out.put(char(v));
+}
+
+static bool ReadVarint(std::istream &in, uint64_t &v)
+{
+	v = 0;
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		int c = in.get();
+		if (c == EOF)
+			return false;
+		v |= uint64_t(c & 0x7f) << shift;
+		if ((c & 0x80) == 0)
+			return true;
+	}
+	return false;
+}
+
+//Bytes left in the stream. The counts read from a proof are bounded by it, since each item takes at least one byte:
+//a truncated or forged file is rejected instead of making the verifier allocate whatever it says
+static uint64_t BytesLeft(std::istream &in)
+{
+	const std::streampos pos = in.tellg();
+	if (pos == std::streampos(-1))
+		return 0;
+	in.seekg(0, std::ios::end);
+	const std::streampos end = in.tellg();
+	in.seekg(pos);
+	return end > pos ? uint64_t(end - pos) : 0;
+}
+
+static void WriteBytes(std::ostream &out, const std::string &str)
+{
+	WriteVarint(out, str.size());
+	out.write(str.data(), str.size());
+}
+
+static bool ReadBytes(std::istream &in, std::string &str)
+{
+	uint64_t len;
+	if (!ReadVarint(in, len) || len > BytesLeft(in))
+		return false;
+	str.resize(len);
+	return len == 0 || bool(in.read(&str[0], len));
+}
+
+static void WriteHashes(std::ostream &out, const std::vector<std::string> &vec)
+{
+	WriteVarint(out, vec.size());
+	for (const std::string &h : vec)
+		WriteBytes(out, h);
+}
+
+static bool ReadHashes(std::istream &in, std::vector<std::string> &vec)
+{
+	uint64_t n;
+	if (!ReadVarint(in, n) || n > BytesLeft(in))
+		return false;
+	vec.resize(n);
+	for (std::string &h : vec)
+		if (!ReadBytes(in, h))
+			return false;
+	return true;
+}
+
+static void WritePositions(std::ostream &out, const std::vector<std::vector<size_t>> &vec)
+{
+	WriteVarint(out, vec.size());
+	for (const std::vector<size_t> &pos : vec)
+	{
+		WriteVarint(out, pos.size());
+		for (size_t p : pos)
+			WriteVarint(out, p);
+	}
+}
+
+static bool ReadPositions(std::istream &in, std::vector<std::vector<size_t>> &vec)
+{
+	uint64_t n, m, p;
+	if (!ReadVarint(in, n) || n > BytesLeft(in))
+		return false;
+	vec.resize(n);
+	for (std::vector<size_t> &pos : vec)
+	{
+		if (!ReadVarint(in, m) || m > BytesLeft(in))
+			return false;
+		pos.resize(m);
+		for (size_t &q : pos)
+		{
+			if (!ReadVarint(in, p))
+				return false;
+			q = p;
+		}
+	}
+	return true;
+}
+
+//Limbs are written least significant byte first, whatever the byte order of the platform,
+//so that proofs and indexes can be verified on another host
+static void WriteLimbs(std::ostream &out, const mp_limb_t *limbs, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		for (unsigned shift = 0; shift < 64; shift += 8)
+			out.put(char((limbs[i] >> shift) & 0xff));
+}
+
+static bool ReadLimbs(std::istream &in, mp_limb_t *limbs, size_t n)
+{
+	unsigned char buf[8];
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (!in.read(reinterpret_cast<char *>(buf), sizeof(buf)))
+			return false;
+		limbs[i] = 0;
+		for (unsigned k = 0; k < sizeof(buf); ++k)
+			limbs[i] |= mp_limb_t(buf[k]) << (8 * k);
+	}
+	return true;
+}
+
+//Field elements are written as the limbs of their canonical (non-Montgomery) representation
+template <class F>
+void WriteFieldVector(std::ostream &out, const std::vector<F> &vec)
+{
+	WriteVarint(out, vec.size());
+	for (const F &x : vec)
+	{
+		const auto b = x.as_bigint();
+		WriteLimbs(out, b.data, sizeof(b.data) / sizeof(b.data[0]));
+	}
+}
+
+//Only the canonical representations (below the modulus) are accepted, so that a proof has a single encoding
+template <class F>
+bool ReadFieldVector(std::istream &in, std::vector<F> &vec)
+{
+	decltype(F().as_bigint()) b;
+	const mp_size_t limbs = sizeof(b.data) / sizeof(b.data[0]);
+	uint64_t n;
+	if (!ReadVarint(in, n) || n > BytesLeft(in) / (limbs * 8))
+		return false;
+	vec.reserve(n);
+	for (uint64_t i = 0; i < n; ++i)
+	{
+		if (!ReadLimbs(in, b.data, limbs) || mpn_cmp(b.data, F::mod.data, limbs) >= 0)
+			return false;
+		vec.push_back(F(b));
+	}
+	return true;
+}
+
+template <class F>
+void R1CSLibiop<F>::WriteProof(const bcs_transformation_transcript<F> &proof, const std::string &type, std::ostream &out)
+{
+	out.write(kProofMagic, kProofMagicLen);
+	out.put(char(kProofVersion));
+	WriteBytes(out, type);
+
+	WriteVarint(out, proof.prover_messages_.size());
+	for (const std::vector<F> &msg : proof.prover_messages_)
+		WriteFieldVector<F>(out, msg);
+	WriteHashes(out, proof.MT_roots_);
+	WritePositions(out, proof.query_positions_);
+	WriteVarint(out, proof.query_responses_.size());
+	for (const std::vector<std::vector<F>> &resp : proof.query_responses_)
+	{
+		WriteVarint(out, resp.size());
+		for (const std::vector<F> &vec : resp)
+			WriteFieldVector<F>(out, vec);
+	}
+	WritePositions(out, proof.MT_leaf_positions_);
+	WriteVarint(out, proof.MT_set_membership_proofs_.size());
+	for (const merkle_tree_set_membership_proof &mts : proof.MT_set_membership_proofs_)
+	{
+		WriteHashes(out, mts.auxiliary_hashes);
+		WriteHashes(out, mts.randomness_hashes);
+	}
+	WriteVarint(out, proof.total_depth_without_pruning);
+}
+
+template <class F>
+bool R1CSLibiop<F>::ReadProof(bcs_transformation_transcript<F> &proof, std::istream &in)
+{
+	char magic[kProofMagicLen];
+	if (!in.read(magic, kProofMagicLen) || std::string(magic, kProofMagicLen) != kProofMagic)
+		return false;
+	if (in.get() != kProofVersion)
+	{
+		printf("unsupported proof version\n");
+		return false;
+	}
+	std::string type;
+	uint64_t n, m, depth;
+	if (!ReadBytes(in, type))
+		return false;
+
+	if (!ReadVarint(in, n) || n > BytesLeft(in))
+		return false;
+	proof.prover_messages_.resize(n);
+	for (std::vector<F> &msg : proof.prover_messages_)
+		if (!ReadFieldVector<F>(in, msg))
+			return false;
+	if (!ReadHashes(in, proof.MT_roots_) || !ReadPositions(in, proof.query_positions_))
+		return false;
+	if (!ReadVarint(in, n) || n > BytesLeft(in))
+		return false;
+	proof.query_responses_.resize(n);
+	for (std::vector<std::vector<F>> &resp : proof.query_responses_)
+	{
+		if (!ReadVarint(in, m) || m > BytesLeft(in))
+			return false;
+		resp.resize(m);
+		for (std::vector<F> &vec : resp)
+			if (!ReadFieldVector<F>(in, vec))
+				return false;
+	}
+	if (!ReadPositions(in, proof.MT_leaf_positions_) || !ReadVarint(in, n) || n > BytesLeft(in) / 2)
+		return false;
+	proof.MT_set_membership_proofs_.resize(n);
+	for (merkle_tree_set_membership_proof &mts : proof.MT_set_membership_proofs_)
+		if (!ReadHashes(in, mts.auxiliary_hashes) || !ReadHashes(in, mts.randomness_hashes))
+			return false;
+	if (!ReadVarint(in, depth))
+		return false;
+	proof.total_depth_without_pruning = depth;
+	return true;
+}
+
+template <class F>
+size_t R1CSLibiop<F>::SaveProof(const bcs_transformation_transcript<F> &proof, const std::string &type, const std::string &fname)
+{
+	skTrace::Span span("proof.save");
+	if (skUtils::endsWith(fname, ".json"))
+	{
+		json js;
+		SerializeProof(proof, js);
+		js["type"] = type;
+		if (!skUtils::WriteJson2File(fname, js))
+			return 0;
+	}
+	else
+	{
+		std::ofstream o(fname, std::ios::binary);
+		if (!o.good())
+			return 0;
+		WriteProof(proof, type, o);
+		o.close();
+	}
+	std::ifstream in(fname, std::ios::binary | std::ios::ate);
+	size_t size = in.tellg();
+	skTrace::Count("proof_file_bytes", size);
+	return size;
+}
+
+template <class F>
+bool R1CSLibiop<F>::LoadProof(bcs_transformation_transcript<F> &proof, const std::string &fname)
+{
+	skTrace::Span span("proof.load");
+	std::ifstream in(fname, std::ios::binary);
+	if (!in.good())
+		return false;
+	char magic[kProofMagicLen];
+	bool binary = in.read(magic, kProofMagicLen) && std::string(magic, kProofMagicLen) == kProofMagic;
+	if (!binary)
+	{
+		DeserializeProof(proof, skUtils::LoadJsonFromFile(fname));
+		return true;
+	}
+	in.seekg(0);
+	if (!ReadProof(proof, in))
+	{
+		printf("invalid proof file %s\n", fname.c_str());
+		return false;
+	}
+	return true;
+}
+
+//Verifier index files start with this magic, a version byte and the name of the field.
+//Version 3: little-endian limbs, as for the proofs
+static const char kIndexMagic[] = "skidx";
+static const unsigned char kIndexVersion = 3;
+
+template <class F>
+bool R1CSLibiop<F>::SaveVerifierIndex(const std::vector<std::string> &roots, const std::vector<std::vector<F>> &messages, const r1cs_constraint_system<F> &cs, const std::string &fname)
+{
+	std::ofstream out(fname, std::ios::binary);
+	if (!out.good())
+		return false;
+	out.write(kIndexMagic, kProofMagicLen);
+	out.put(char(kIndexVersion));
+	WriteBytes(out, FieldName());
+
+	size_t nnz[3] = {0, 0, 0};
+	for (const r1cs_constraint<F> &c : cs.constraints_)
+	{
+		nnz[0] += c.a_.terms.size();
+		nnz[1] += c.b_.terms.size();
+		nnz[2] += c.c_.terms.size();
+	}
+	WriteVarint(out, cs.primary_input_size_);
+	WriteVarint(out, cs.auxiliary_input_size_);
+	WriteVarint(out, cs.num_constraints());
+	for (size_t n : nnz)
+		WriteVarint(out, n);
+
+	WriteHashes(out, roots);
+	WriteVarint(out, messages.size());
+	for (const std::vector<F> &msg : messages)
+		WriteFieldVector<F>(out, msg);
+	out.close();
+	return true;
+}
+
+template <class F>
+bool R1CSLibiop<F>::LoadVerifierIndex(std::vector<std::string> &roots, std::vector<std::vector<F>> &messages, r1cs_constraint_system<F> &shape, const std::string &fname)
+{
+	skTrace::Span span("index.load");
+	std::ifstream in(fname, std::ios::binary);
+	char magic[kProofMagicLen];
+	std::string field;
+	if (!in.read(magic, kProofMagicLen) || std::string(magic, kProofMagicLen) != kIndexMagic || in.get() != kIndexVersion
+		|| !ReadBytes(in, field) || field != FieldName())
+		return false;
+
+	//The index is succinct, its size does not grow with the circuit, so the counts cannot be bounded by the bytes of the file.
+	//They are bounded by the largest evaluation domain of the field instead (2^s elements, s being its 2-adicity):
+	//libiop cannot index a larger circuit, so a forged index cannot make the verifier allocate more than a genuine one
+	const uint64_t max_domain = uint64_t(1) << std::min<size_t>(F::s, 62);
+	uint64_t primary_nb, aux_nb, cs_nb, nnz[3], n;
+	if (!ReadVarint(in, primary_nb) || !ReadVarint(in, aux_nb) || !ReadVarint(in, cs_nb) || cs_nb == 0
+		|| cs_nb > max_domain || primary_nb >= max_domain || aux_nb >= max_domain - primary_nb)
+		return false;
+	for (uint64_t &k : nnz)
+		if (!ReadVarint(in, k) || k > max_domain || (k + cs_nb - 1) / cs_nb > primary_nb + aux_nb + 1)
+			return false;
+
+	//Spread the non-zero coefficients of each matrix over the constraints, in distinct columns
+	std::vector<linear_combination<F>> lc[3];
+	for (int m = 0; m < 3; ++m)
+	{
+		lc[m].resize(cs_nb);
+		for (uint64_t j = 0; j < nnz[m]; ++j)
+			lc[m][j % cs_nb].add_term(variable<F>(j / cs_nb), F::one());
+	}
+	shape.constraints_.clear();
+	for (uint64_t i = 0; i < cs_nb; ++i)
+		shape.add_constraint(r1cs_constraint<F>(lc[0][i], lc[1][i], lc[2][i]));
+	shape.primary_input_size_ = primary_nb;
+	shape.auxiliary_input_size_ = aux_nb;
+
+	if (!ReadHashes(in, roots) || !ReadVarint(in, n) || n > BytesLeft(in))
+		return false;
+	messages.resize(n);
+	for (std::vector<F> &msg : messages)
+		if (!ReadFieldVector<F>(in, msg))
+			return false;
+	return true;
+}
+
+template <class F>
+bool R1CSLibiop<F>::SaveVerifierInputs(const std::string &fname, const std::string &type, const std::string &r1cs_filename, const r1cs_constraint_system<F> &cs, const json &params, const r1cs_primary_input<F> &primary_input)
+{
+	json jvin;
+	jvin["type"] = type;
+	jvin["field"] = FieldName();
+	jvin["digest"] = R1CSDigest(r1cs_filename);
+	jvin["constraint_nb"] = cs.num_constraints();
+	jvin["instance_nb"] = cs.primary_input_size_;
+	jvin["witness_nb"] = cs.auxiliary_input_size_;
+	jvin["params"] = params;
+	std::vector<std::string> j_inputs;
+	skFieldCodec<F>::ToDecimal(primary_input, j_inputs);
+	jvin["inputs"] = j_inputs;
+	return WriteJson2File(fname, jvin);
+}
+
+template <class F>
+bool R1CSLibiop<F>::LoadVerifierInputs(const std::string &fname, json &jvin, r1cs_primary_input<F> &primary_input)
+{
+	skTrace::Span span("verifier_inputs.load");
+	jvin = skUtils::LoadJsonFromFile(fname);
+	if (!jvin.is_object() || jvin.count("inputs") == 0)
+	{
+		printf("error with verifier inputs file %s\n", fname.c_str());
+		return false;
+	}
+	//the public inputs are untrusted: each one must be written in its single canonical form
+	if (!skFieldCodec<F>::FromCanonicalDecimal(jvin["inputs"].get<std::vector<std::string>>(), primary_input))
+	{
+		printf("invalid or non-canonical value in verifier inputs file %s\n", fname.c_str());
+		return false;
+	}
+	jvin.erase("inputs");
+	//the verifier works over the field of its constraint system, the one named by the prover must be the same
+	const std::string field = jvin.count("field") > 0 && jvin["field"].is_string() ? jvin["field"].get<std::string>() : "alt_bn128";
+	if (field != FieldName())
+	{
+		printf("the field %s of the verifier inputs %s is not the one of the constraint system (%s)\n", field.c_str(), fname.c_str(), FieldName().c_str());
+		return false;
+	}
+	return true;
+}
+
+template <class F>
+bool R1CSLibiop<F>::LoadVerifierConstraints(const std::string &r1cs_filename, const json &jvin, r1cs_constraint_system<F> &cs)
+{
+	if (R1CSDigest(r1cs_filename) != jvin["digest"])
+	{
+		printf("the constraint system %s does not match the proof\n", r1cs_filename.c_str());
+		return false;
+	}
+	if (skUtils::endsWith(r1cs_filename, ".arith"))
+	{
+		//a circuit is converted as for the prover (LoadCircuit). The conversion evaluates the circuit, but the verifier
+		//does not have the inputs: the wires are evaluated on zero values, which do not change the constraints
+		r1cs_primary_input<F> primary_input;
+		r1cs_auxiliary_input<F> auxiliary_input;
+		if (!LibiopFromArith<F>(r1cs_filename, "/dev/null", cs, primary_input, auxiliary_input))
+			return false;
+	}
+	else if (!FromJsonl(r1cs_filename, cs, true))
+		return false;
+	Pad(cs);
+	if (cs.num_constraints() != jvin["constraint_nb"] || cs.primary_input_size_ != jvin["instance_nb"])
+	{
+		printf("the size of the constraint system %s does not match the proof\n", r1cs_filename.c_str());
+		return false;
+	}
+	return true;
+}
+
+template <class F>
+std::string FieldCharacteristic()
+{
+	mpz_t t;
+	mpz_init(t);
+	F::mod.to_mpz(t);
+	mpz_class p(t);
+	mpz_clear(t);
+	return p.get_str();
+}
+
+std::string R1CSField(const std::string &r1cs_filename)
+{
+	//circuits are converted with libsnark, whose field is bn128
+	if (skUtils::endsWith(r1cs_filename, ".arith"))
+		return "alt_bn128";
+	std::ifstream r1cs_file(r1cs_filename);
+	std::string line;
+	if (!std::getline(r1cs_file, line))
+		return "";
+	json jc = json::parse(line, nullptr, false);
+	if (!jc.is_object() || jc.count("r1cs") == 0 || !jc["r1cs"]["field_characteristic"].is_string())
+		return "alt_bn128";		//the header written by ToJsonl has no characteristic
+	std::string characteristic = jc["r1cs"]["field_characteristic"];
+	if (characteristic == FieldCharacteristic<libff::alt_bn128_Fr>())
+		return "alt_bn128";
+	if (characteristic == FieldCharacteristic<libff::edwards_Fr>())
+		return "edwards";
+	return "";
+}
+
+std::string VerifierIndexField(const std::string &indexFile)
+{
+	std::ifstream in(indexFile, std::ios::binary);
+	char magic[kProofMagicLen];
+	std::string field;
+	if (!in.read(magic, kProofMagicLen) || std::string(magic, kProofMagicLen) != kIndexMagic || in.get() != kIndexVersion
+		|| !ReadBytes(in, field))
+		return "";
+	return field;
+}
+
+bool InitLibiopField(const std::string &field)
+{
+	if (field == "alt_bn128")
+		libff::alt_bn128_pp::init_public_params();
+	else if (field == "edwards")
+		libff::edwards_pp::init_public_params();
+	else
+	{
+		printf("the field of the constraint system is not supported\n");
+		return false;
+	}
+	return true;
+}
+
+template <class F>
+static bool CheckR1CSOver(const std::string &r1cs_filename)
+{
+	R1CSLibiop<F> r1cs;
+	r1cs_constraint_system<F> cs;
+	r1cs_primary_input<F> primary_input;
+	r1cs_auxiliary_input<F> auxiliary_input;
+	if (!r1cs.LoadCircuit(r1cs_filename, cs, primary_input, auxiliary_input))
+		return false;
+	return r1cs.CheckSatisfied(cs, primary_input, auxiliary_input, r1cs_filename);
+}
+
+bool CheckR1CS(const std::string &r1cs_filename)
+{
+	std::string field = R1CSField(r1cs_filename);
+	if (!InitLibiopField(field))
+		return false;
+	if (field == "edwards")
+		return CheckR1CSOver<libff::edwards_Fr>(r1cs_filename);
+	return CheckR1CSOver<libff::alt_bn128_Fr>(r1cs_filename);
+}
+
+std::string R1CSDigest(const std::string &fname)
+{
+	std::ifstream in(fname, std::ios::binary);
+	if (!in.good())
+		return "";
+	crypto_generichash_state state;
+	unsigned char hash[crypto_generichash_BYTES];
+	crypto_generichash_init(&state, NULL, 0, sizeof hash);
+	std::vector<char> buf(1 << 16);
+	while (in.read(buf.data(), buf.size()) || in.gcount() > 0)
+		crypto_generichash_update(&state, reinterpret_cast<const unsigned char *>(buf.data()), in.gcount());
+	crypto_generichash_final(&state, hash, sizeof hash);
+
+	static const char hex[] = "0123456789abcdef";
+	std::string digest;
+	for (unsigned char c : hash)
+	{
+		digest += hex[c >> 4];
+		digest += hex[c & 15];
+	}
+	return digest;
+}
+
+std::string LibiopProofType(const std::string &fname)
+{
+	std::ifstream in(fname, std::ios::binary);
+	char magic[kProofMagicLen];
+	if (in.read(magic, kProofMagicLen) && std::string(magic, kProofMagicLen) == kProofMagic)
+	{
+		std::string type;
+		if (in.get() == kProofVersion && ReadBytes(in, type))
+			return type;
+		return "";
+	}
+	json js = skUtils::LoadJsonFromFile(fname);
+	if (js.is_object() && js.count("type") > 0 && js["type"].is_string())
+		return js["type"];
+	return "";
+}
+
 template class  R1CSLibiop<libff::edwards_Fr>;
-template class  R1CSLibiop<libff::alt_bn128_Fr>;
\ No newline at end of file
+template class  R1CSLibiop<libff::alt_bn128_Fr>;
+
+//conversions from the field of libsnark (CircuitReader.hpp)
+typedef libff::Fr<libff::default_ec_pp> LibsnarkFieldT;
+template bool R1CSLibiop<libff::edwards_Fr>::FromLibsnark<LibsnarkFieldT>(const libsnark::r1cs_constraint_system<LibsnarkFieldT> &, r1cs_constraint_system<libff::edwards_Fr> &, bool);
+template bool R1CSLibiop<libff::alt_bn128_Fr>::FromLibsnark<LibsnarkFieldT>(const libsnark::r1cs_constraint_system<LibsnarkFieldT> &, r1cs_constraint_system<libff::alt_bn128_Fr> &, bool);
+template void R1CSLibiop<libff::edwards_Fr>::InputsFromLibsnark<LibsnarkFieldT>(const libsnark::r1cs_primary_input<LibsnarkFieldT> &, const libsnark::r1cs_auxiliary_input<LibsnarkFieldT> &, r1cs_primary_input<libff::edwards_Fr> &, r1cs_auxiliary_input<libff::edwards_Fr> &);
+template void R1CSLibiop<libff::alt_bn128_Fr>::InputsFromLibsnark<LibsnarkFieldT>(const libsnark::r1cs_primary_input<LibsnarkFieldT> &, const libsnark::r1cs_auxiliary_input<LibsnarkFieldT> &, r1cs_primary_input<libff::alt_bn128_Fr> &, r1cs_auxiliary_input<libff::alt_bn128_Fr> &);
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <string>
 #include <libsnark/common/default_types/r1cs_gg_ppzksnark_pp.hpp>
+#include <libsnark/relations/constraint_satisfaction_problems/r1cs/r1cs.hpp>
 //#include <libsnark/gadgetlib2/variable.hpp>
 //#include <libsnark/gadgetlib2/protoboard.hpp>
 #include "json.hpp"
@@ -39,10 +40,75 @@ public:
     void Pad(libiop::r1cs_constraint_system<F> &out_cs);
     void PadInputs(libiop::r1cs_primary_input<F> &primary_inputs, libiop::r1cs_auxiliary_input<F> &auxiliary_input, int target);
 
+    //Convert a libsnark constraint system in memory, with the same input padding as FromJsonl.
+    //The field of the libsnark constraint system must have the same characteristic as F
+    template <class SF>
+    bool FromLibsnark(const libsnark::r1cs_constraint_system<SF> &in_cs, libiop::r1cs_constraint_system<F> &out_cs, bool pad_inputs = false);
+    template <class SF>
+    void InputsFromLibsnark(const libsnark::r1cs_primary_input<SF> &in_primary, const libsnark::r1cs_auxiliary_input<SF> &in_auxiliary, libiop::r1cs_primary_input<F> &primary_input, libiop::r1cs_auxiliary_input<F> &auxiliary_input);
 
-    void SerializeProof(const libiop::bcs_transformation_transcript<F> proof, nlohmann::json &js);
+    //Load the padded constraint system and assignment of the prover: from a j1cs file and its .in file,
+    //or from an arithmetic circuit (.arith) and its .in file, which is converted in memory without writing a j1cs file
+    bool LoadCircuit(const std::string &r1cs_filename, libiop::r1cs_constraint_system<F> &cs, libiop::r1cs_primary_input<F> &primary_input, libiop::r1cs_auxiliary_input<F> &auxiliary_input);
+    //Parallel satisfaction check of the assignment (see skR1CSCheck); r1cs_filename locates the failing constraints
+    bool CheckSatisfied(const libiop::r1cs_constraint_system<F> &cs, const libiop::r1cs_primary_input<F> &primary_input, const libiop::r1cs_auxiliary_input<F> &auxiliary_input, const std::string &r1cs_filename);
+
+
+    //Json encoding of a proof, for debugging
+    void SerializeProof(const libiop::bcs_transformation_transcript<F> &proof, nlohmann::json &js);
     void DeserializeProof( libiop::bcs_transformation_transcript<F> &proof, const nlohmann::json &js);
+
+    //Binary encoding of a proof: raw field limbs, raw hashes and varint positions
+    void WriteProof(const libiop::bcs_transformation_transcript<F> &proof, const std::string &type, std::ostream &out);
+    bool ReadProof(libiop::bcs_transformation_transcript<F> &proof, std::istream &in);
+
+    //Save the proof in binary form, or in json form if 'fname' ends with .json. Returns the size of the file
+    size_t SaveProof(const libiop::bcs_transformation_transcript<F> &proof, const std::string &type, const std::string &fname);
+    //Load a proof saved with SaveProof, in either form
+    bool LoadProof(libiop::bcs_transformation_transcript<F> &proof, const std::string &fname);
+
+    //Save a verifier index (Merkle roots and indexed messages) with the shape of the constraint system:
+    //the sizes and the number of non-zero coefficients of each matrix, which is what the parameters depend on
+    bool SaveVerifierIndex(const std::vector<std::string> &roots, const std::vector<std::vector<F>> &messages, const libiop::r1cs_constraint_system<F> &cs, const std::string &fname);
+    //Load a verifier index saved by SaveVerifierIndex; 'shape' receives a constraint system with the same shape as the original one.
+    //Its counts are rejected beyond the largest evaluation domain of the field, which bounds what 'shape' allocates
+    bool LoadVerifierIndex(std::vector<std::string> &roots, std::vector<std::vector<F>> &messages, libiop::r1cs_constraint_system<F> &shape, const std::string &fname);
+
+    //Save the verifier inputs of a proof: type, digest and sizes of the constraint system, proof parameters and public inputs.
+    //The verifier uses them instead of the inputs file, which contains the witnesses
+    bool SaveVerifierInputs(const std::string &fname, const std::string &type, const std::string &r1cs_filename, const libiop::r1cs_constraint_system<F> &cs, const nlohmann::json &params, const libiop::r1cs_primary_input<F> &primary_input);
+    //Load verifier inputs saved by SaveVerifierInputs; jvin receives everything but the public inputs.
+    //They are rejected if they name another field than F
+    bool LoadVerifierInputs(const std::string &fname, nlohmann::json &jvin, libiop::r1cs_primary_input<F> &primary_input);
+    //Load the constraint system of the verifier inputs, checking that it matches their digest and sizes.
+    //A .arith circuit is converted as in LoadCircuit, without its inputs
+    bool LoadVerifierConstraints(const std::string &r1cs_filename, const nlohmann::json &jvin, libiop::r1cs_constraint_system<F> &cs);
+
+    //Name of the field F, as returned by R1CSField
+    static std::string FieldName();
     
 };
 
+//Build the constraint system and the assignment of an arithmetic circuit (.arith) with libsnark, and convert them (see R1CSLibiop::FromLibsnark)
+//Inputs are padded, but not the constraint system
+template <class F>
+bool LibiopFromArith(const std::string &arithFile, const std::string &inputsFile, libiop::r1cs_constraint_system<F> &cs, libiop::r1cs_primary_input<F> &primary_input, libiop::r1cs_auxiliary_input<F> &auxiliary_input);
+
+//Returns the field of a constraint system, from the characteristic in the header of a j1cs file: alt_bn128 (the default) or edwards.
+//Returns an empty string if the field is not supported by the libiop provers
+std::string R1CSField(const std::string &r1cs_filename);
+//Returns the field of a verifier index (see SaveVerifierIndex), or an empty string if it is not an index file
+std::string VerifierIndexField(const std::string &indexFile);
+//Initialize the public parameters of a field returned by R1CSField; returns false if the field is not supported
+bool InitLibiopField(const std::string &field);
+
+//Check the assignment (.in) of a j1cs file or of an arithmetic circuit over its field, and report its first failing constraints (see skR1CSCheck)
+bool CheckR1CS(const std::string &r1cs_filename);
+
+//Returns the digest (blake2b, in hexadecimal) of a constraint system file
+std::string R1CSDigest(const std::string &fname);
+
+//Returns the type of a libiop proof file (aurora, ligero, fractal), binary or json, or the 'type' of a json proof
+std::string LibiopProofType(const std::string &fname);
+
 #endif
\ No newline at end of file
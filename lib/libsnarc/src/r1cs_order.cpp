@@ -0,0 +1,55 @@
+//Command line front-end of skR1CSOrder:
+//  r1cs_order [--report=FILE] circuit.j1cs
+//The constraints are renumbered in place, with their assignment (circuit.j1cs.in) when there is one,
+//and the permutation is saved to circuit.j1cs.order. With --apply, only the assignment is renumbered,
+//with the permutation saved before.
+
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <iostream>
+#include "R1CSOrder.hpp"
+
+static int Usage()
+{
+    fprintf(stderr, "Usage: r1cs_order [--report=FILE] [--apply] circuit.j1cs\n");
+    fprintf(stderr, "  --report=FILE  write the witness spans before and after in json to FILE\n");
+    fprintf(stderr, "  --apply        renumber a new assignment (circuit.j1cs.in) with the saved permutation\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    std::string report, file;
+    bool apply = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "--report=", 9) == 0)
+            report = argv[i] + 9;
+        else if (strcmp(argv[i], "--apply") == 0)
+            apply = true;
+        else if (argv[i][0] == '-' || !file.empty())
+            return Usage();
+        else
+            file = argv[i];
+    }
+    if (file.empty())
+        return Usage();
+
+    skR1CSOrder order;
+    if (apply)
+        return order.LoadOrder(file + ".order") && order.Apply(file + ".in") ? 0 : 1;
+    if (!order.Compute(file) || !order.WriteR1CS(file) || !order.SaveOrder(file + ".order"))
+        return 1;
+    if (std::ifstream(file + ".in").good() && !order.Apply(file + ".in"))
+        return 1;
+    order.Report(std::cout);
+    if (!report.empty())
+    {
+        std::ofstream out(report);
+        out << order.ReportJson().dump(4) << "\n";
+        if (!out.good())
+            return 1;
+    }
+    return 0;
+}
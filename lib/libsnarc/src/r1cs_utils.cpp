@@ -1,10 +1,16 @@
 
+#include "r1cs_libiop.hpp"
 #include "r1cs_utils.hpp"
+#include "R1CSCheck.hpp"
+#include "Trace.hpp"
+#include "FieldCodec.hpp"
 
 #include <libsnark/gadgetlib2/integration.hpp>
 #include <libsnark/gadgetlib2/adapters.hpp>
 #include <libsnark/zk_proof_systems/ppzksnark/r1cs_ppzksnark/examples/run_r1cs_ppzksnark.hpp>
 #include <libsnark/zk_proof_systems/ppzksnark/r1cs_gg_ppzksnark/r1cs_gg_ppzksnark.hpp>
+#include <libff/algebra/curves/edwards/edwards_pp.hpp>
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 
 
 using json = nlohmann::json;
@@ -44,7 +50,7 @@ linear_combination<FieldT> R1CSUtils::parseLinearCombJson(json &jlc)
 	{
 		variable<FieldT> var(term[0]);
 		std::string str_coeff = term[1];
-		FieldT cc(str_coeff.c_str());
+		FieldT cc = skFieldCodec<FieldT>::FromDecimal(str_coeff);
 		
 		lc.add_term(var, cc);//TODO handle negative idx; something like this: if var<0; idx = primary.len - var
 		
@@ -55,19 +61,9 @@ linear_combination<FieldT> R1CSUtils::parseLinearCombJson(json &jlc)
 //Convert R1CS assignment into a '.j1cs.in' json input file
 json R1CSUtils::Inputs2Json(const r1cs_primary_input<FieldT> &primary_input,const r1cs_auxiliary_input<FieldT> &auxiliary_input)
 {
-	json j_inputs, j_wit;
-
-
-	for (FieldT const & iter:primary_input)
-	{
-		//TODO; there should be no coef null!!	
-		j_inputs.push_back(skUtils::FieldToString(iter));
-	}
-	for (FieldT const & iter:auxiliary_input)
-	{
-		//TODO; there should be no coef null!!???
-		j_wit.push_back(skUtils::FieldToString(iter));
-	}
+	std::vector<std::string> j_inputs, j_wit;
+	skFieldCodec<FieldT>::ToDecimal(primary_input, j_inputs);
+	skFieldCodec<FieldT>::ToDecimal(auxiliary_input, j_wit);
 	json jValue;
 	jValue["inputs"] = j_inputs;
 	jValue["witnesses"] = j_wit;
@@ -82,6 +78,15 @@ bool R1CSUtils::SaveInputs(const std::string jsonFile, const r1cs_primary_input<
 }
 
 r1cs_constraint_system<FieldT> R1CSUtils::GenerateFromArithFile(const std::string &fname, const std::string &inputValues, json & assignments)
+{
+	r1cs_primary_input<FieldT> primary_input;
+	r1cs_auxiliary_input<FieldT> auxiliary_input;
+	r1cs_constraint_system<FieldT> constraints = GenerateFromArithFile(fname, inputValues, primary_input, auxiliary_input);
+	assignments = Inputs2Json(primary_input, auxiliary_input);
+    return constraints;
+}
+
+r1cs_constraint_system<FieldT> R1CSUtils::GenerateFromArithFile(const std::string &fname, const std::string &inputValues, r1cs_primary_input<FieldT> &primary_input, r1cs_auxiliary_input<FieldT> &auxiliary_input)
 {
     InitR1CS();
 	gadgetlib2::ProtoboardPtr pb = gadgetlib2::Protoboard::create(gadgetlib2::R1P);
@@ -94,16 +99,30 @@ r1cs_constraint_system<FieldT> R1CSUtils::GenerateFromArithFile(const std::strin
 	constraints.auxiliary_input_size = full_assignment.size() - constraints.num_inputs();
 
 	// extract primary and auxiliary input
-	const r1cs_primary_input<FieldT> primary_input(full_assignment.begin(),
-			full_assignment.begin() + constraints.num_inputs());
-	const r1cs_auxiliary_input<FieldT> auxiliary_input(
-			full_assignment.begin() + constraints.num_inputs(), full_assignment.end());
-	assignments = Inputs2Json(primary_input, auxiliary_input);
+	primary_input.assign(full_assignment.begin(), full_assignment.begin() + constraints.num_inputs());
+	auxiliary_input.assign(full_assignment.begin() + constraints.num_inputs(), full_assignment.end());
 
     return constraints;
 }
 
 
+template <class F>
+bool LibiopFromArith(const std::string &arithFile, const std::string &inputsFile, libiop::r1cs_constraint_system<F> &cs, libiop::r1cs_primary_input<F> &primary_input, libiop::r1cs_auxiliary_input<F> &auxiliary_input)
+{
+	R1CSUtils r1cs;
+	r1cs_primary_input<FieldT> in_primary;
+	r1cs_auxiliary_input<FieldT> in_auxiliary;
+	r1cs_constraint_system<FieldT> in_cs = r1cs.GenerateFromArithFile(arithFile, inputsFile, in_primary, in_auxiliary);
+
+	R1CSLibiop<F> r1cs_iop;
+	if (!r1cs_iop.FromLibsnark(in_cs, cs, true))
+		return false;
+	r1cs_iop.InputsFromLibsnark(in_primary, in_auxiliary, primary_input, auxiliary_input);
+	return true;
+}
+
+template bool LibiopFromArith<libff::edwards_Fr>(const std::string &, const std::string &, libiop::r1cs_constraint_system<libff::edwards_Fr> &, libiop::r1cs_primary_input<libff::edwards_Fr> &, libiop::r1cs_auxiliary_input<libff::edwards_Fr> &);
+template bool LibiopFromArith<libff::alt_bn128_Fr>(const std::string &, const std::string &, libiop::r1cs_constraint_system<libff::alt_bn128_Fr> &, libiop::r1cs_primary_input<libff::alt_bn128_Fr> &, libiop::r1cs_auxiliary_input<libff::alt_bn128_Fr> &);
 
 
 
@@ -139,6 +158,7 @@ bool R1CSUtils::ToJsonl(r1cs_constraint_system<FieldT>  &in_cs, const std::strin
 
 bool R1CSUtils::FromJsonl(const std::string jsonFile, r1cs_constraint_system<FieldT> &out_cs)
 {
+	skTrace::Span span("r1cs.load");
 	//read from file
 	std::ifstream r1cs_file(jsonFile);
 	if (!r1cs_file.good())
@@ -168,6 +188,8 @@ bool R1CSUtils::FromJsonl(const std::string jsonFile, r1cs_constraint_system<Fie
   	}
 	out_cs.primary_input_size = header["instance_nb"];
 	out_cs.auxiliary_input_size = header["witness_nb"];
+	skTrace::Count("constraints", out_cs.num_constraints());
+	skTrace::Count("witnesses", out_cs.auxiliary_input_size);
 
 	return true;
 }
@@ -175,6 +197,7 @@ bool R1CSUtils::FromJsonl(const std::string jsonFile, r1cs_constraint_system<Fie
 //Load the inputs from a json file .j1cs.in
 bool R1CSUtils::LoadInputs(const std::string jsonFile, r1cs_primary_input<FieldT> &primary_input, r1cs_auxiliary_input<FieldT> &auxiliary_input)
 {
+	skTrace::Span span("witness.load");
 	//load the inputs
 	std::ifstream jfile(jsonFile);
 	if (!jfile.good())
@@ -185,7 +208,7 @@ bool R1CSUtils::LoadInputs(const std::string jsonFile, r1cs_primary_input<FieldT
 	for (json::iterator it = j_inputs.begin(); it != j_inputs.end(); ++it) 
 	{
 		std::string str_coeff = (*it);
-		FieldT cc(str_coeff.c_str());
+		FieldT cc = skFieldCodec<FieldT>::FromDecimal(str_coeff);
 		primary_input.push_back(cc); 
 		//TODO handle one constant at idx 0
 	}
@@ -193,10 +216,36 @@ bool R1CSUtils::LoadInputs(const std::string jsonFile, r1cs_primary_input<FieldT
 	for (json::iterator it = j_wit.begin(); it != j_wit.end(); ++it) 
 	{
 		std::string str_coeff = (*it);
-		FieldT cc(str_coeff.c_str());
+		FieldT cc = skFieldCodec<FieldT>::FromDecimal(str_coeff);
 		auxiliary_input.push_back(cc);
   	}
 	return true;
 }
 
+static FieldT Evaluate(const linear_combination<FieldT> &lc, const std::vector<FieldT> &full)
+{
+	FieldT acc = FieldT::zero();
+	for (linear_term<FieldT> const &lt : lc)
+		acc += (lt.index == 0 ? FieldT::one() : full[lt.index - 1]) * lt.coeff;
+	return acc;
+}
+
+bool R1CSUtils::CheckSatisfied(const r1cs_constraint_system<FieldT> &cs, const r1cs_primary_input<FieldT> &primary_input, const r1cs_auxiliary_input<FieldT> &auxiliary_input, const std::string &r1csFile)
+{
+	skTrace::Span span("check");
+	std::vector<FieldT> full(primary_input);
+	full.insert(full.end(), auxiliary_input.begin(), auxiliary_input.end());
+	if (full.size() != cs.primary_input_size + cs.auxiliary_input_size)
+	{
+		printf("the assignment has %lu values for %lu variables\n", (unsigned long)full.size(), (unsigned long)(cs.primary_input_size + cs.auxiliary_input_size));
+		return false;
+	}
+	return skR1CSCheck::Check<FieldT>(cs.num_constraints(), [&cs, &full](size_t i, FieldT &a, FieldT &b, FieldT &c)
+	{
+		a = Evaluate(cs.constraints[i].a, full);
+		b = Evaluate(cs.constraints[i].b, full);
+		c = Evaluate(cs.constraints[i].c, full);
+	}, r1csFile);
+}
+
 
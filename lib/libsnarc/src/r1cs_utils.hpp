@@ -23,9 +23,12 @@ public:
 
     bool SaveInputs(const std::string jsonFile, const r1cs_primary_input<FieldT> &primary_input,const r1cs_auxiliary_input<FieldT> &auxiliary_input);
     r1cs_constraint_system<FieldT> GenerateFromArithFile(const std::string &fname, const std::string &inputValues, nlohmann::json & assignments);
+    r1cs_constraint_system<FieldT> GenerateFromArithFile(const std::string &fname, const std::string &inputValues, r1cs_primary_input<FieldT> &primary_input, r1cs_auxiliary_input<FieldT> &auxiliary_input);
     bool ToJsonl(r1cs_constraint_system<FieldT>  &in_cs, const std::string &out_fname);
     bool FromJsonl(const std::string jsonFile, r1cs_constraint_system<FieldT> &out_cs);
     bool LoadInputs(const std::string jsonFile, r1cs_primary_input<FieldT> &primary_input, r1cs_auxiliary_input<FieldT> &auxiliary_input);
+    //Parallel satisfaction check of the assignment (see skR1CSCheck); r1csFile locates the failing constraints
+    bool CheckSatisfied(const r1cs_constraint_system<FieldT> &cs, const r1cs_primary_input<FieldT> &primary_input, const r1cs_auxiliary_input<FieldT> &auxiliary_input, const std::string &r1csFile);
 
 };
 
@@ -1,6 +1,8 @@
 
 #include "skAurora.hpp"
 #include "r1cs_libiop.hpp"
+#include "R1CSCheck.hpp"
+#include "Trace.hpp"
 
 #include "libiop/snark/aurora_snark.hpp"
 
@@ -17,60 +19,54 @@ using json = nlohmann::json;
 
 using namespace libiop;
 
+//Parameters of the proof, they are saved in the verifier inputs, where the verifier checks them against its own
+json ParametersJson(size_t cs_num, size_t var_num)
+{
+    json jparams;
+    jparams["security_parameter"] = 128;
+    jparams["RS_extra_dimensions"] = 2;
+    jparams["FRI_localization_parameter"] = 3;
+    jparams["make_zk"] = true;
+    jparams["constraint_nb"] = cs_num;
+    jparams["variable_nb"] = var_num;
+    return jparams;
+}
+
 template<class F>
-aurora_snark_parameters<F> GenerateParameters(int cs_num, int var_num)
+aurora_snark_parameters<F> GenerateParameters(const json &jparams)
 {
-  const size_t security_parameter = 128;
-    const size_t RS_extra_dimensions = 2;
-    const size_t FRI_localization_parameter = 3;
     const LDT_reducer_soundness_type ldt_reducer_soundness_type = LDT_reducer_soundness_type::optimistic_heuristic;
     const FRI_soundness_type fri_soundness_type = FRI_soundness_type::heuristic;
     const field_subset_type domain_type = multiplicative_coset_type;
-	const bool make_zk = true;
-      aurora_snark_parameters<F> params(security_parameter,
+      aurora_snark_parameters<F> params(jparams["security_parameter"].get<size_t>(),
                                                ldt_reducer_soundness_type,
                                                fri_soundness_type,
-                                               FRI_localization_parameter,
-                                               RS_extra_dimensions,
-                                               make_zk,
+                                               jparams["FRI_localization_parameter"].get<size_t>(),
+                                               jparams["RS_extra_dimensions"].get<size_t>(),
+                                               jparams["make_zk"].get<bool>(),
                                                domain_type,
-                                               cs_num,
-                                               var_num);
+                                               jparams["constraint_nb"].get<size_t>(),
+                                               jparams["variable_nb"].get<size_t>());
     return params;
 }
 
-//Generate the proof from a (trusted) setup
-nlohmann::json skAurora::Proof(const std::string &r1cs_filename, const std::string &trustedSetup)
+template<class FieldT>
+bool AuroraProof(const std::string &r1cs_filename, const std::string &proofFile)
 {
-  json proof;
-  typedef libff::alt_bn128_Fr FieldT;
-  alt_bn128_pp::init_public_params();
-
   R1CSLibiop<FieldT> r1cs;
 
-  std::string inputsFile = r1cs_filename + ".in";
-
   r1cs_constraint_system<FieldT> cs;
-  printf("loading constraints....\n");
-
-  r1cs.FromJsonl(r1cs_filename, cs, true);
-  printf("padding...\n");
-  r1cs.Pad(cs);
-
-  //load the inputs
   r1cs_primary_input<FieldT> primary_input;
   r1cs_auxiliary_input<FieldT> auxiliary_input;
-  if (r1cs.LoadInputs(inputsFile, primary_input, auxiliary_input))
-    printf("inputs are loaded\n");
-  else
-    printf("error with inputs file\n");
-  r1cs.PadInputs(primary_input, auxiliary_input, cs.num_constraints());
+  if (!r1cs.LoadCircuit(r1cs_filename, cs, primary_input, auxiliary_input))
+    return false;
 
-  if (!cs.is_satisfied(primary_input, auxiliary_input))
-    printf("NOT SATISFIED!!!\n");
+  if (skR1CSCheck::Enabled() && !r1cs.CheckSatisfied(cs, primary_input, auxiliary_input, r1cs_filename))
+    return false;
 
   /* Actual SNARK test */
-  aurora_snark_parameters<FieldT> params = GenerateParameters<FieldT>(cs.num_constraints(), cs.primary_input_size_ + cs.auxiliary_input_size_);
+  json jparams = ParametersJson(cs.num_constraints(), cs.primary_input_size_ + cs.auxiliary_input_size_);
+  aurora_snark_parameters<FieldT> params = GenerateParameters<FieldT>(jparams);
 
   const aurora_snark_argument<FieldT> argument = aurora_snark_prover<FieldT>(
       cs,
@@ -81,45 +77,59 @@ nlohmann::json skAurora::Proof(const std::string &r1cs_filename, const std::stri
   printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
   printf("bcs size in bytes %lu\n", argument.BCS_size_in_bytes());
   printf("argument size in bytes %lu\n", argument.size_in_bytes());
+  skTrace::Count("constraints", cs.num_constraints());
+  skTrace::Count("proof_bytes", argument.size_in_bytes());
 
-  r1cs.SerializeProof(argument, proof);
-  proof["type"] = "aurora";
-  return proof;
+  r1cs.SaveVerifierInputs(proofFile + ".vin", "aurora", r1cs_filename, cs, jparams, primary_input);
+  size_t file_size = r1cs.SaveProof(argument, "aurora", proofFile);
+  printf("proof file size in bytes %lu (%.2fx the argument size)\n", file_size, double(file_size) / argument.size_in_bytes());
+  return file_size > 0;
 }
 
-bool skAurora::Verify(const std::string &r1cs_filename, const json &jProof)
+//Generate the proof from a (trusted) setup, over the field of the constraint system
+bool skAurora::Proof(const std::string &r1cs_filename, const std::string &trustedSetup, const std::string &proofFile)
+{
+  skTrace::Span span("prove");
+  std::string field = R1CSField(r1cs_filename);
+  if (!InitLibiopField(field))
+    return false;
+  if (field == "edwards")
+    return AuroraProof<libff::edwards_Fr>(r1cs_filename, proofFile);
+  return AuroraProof<libff::alt_bn128_Fr>(r1cs_filename, proofFile);
+}
+
+template<class FieldT>
+bool AuroraVerify(const std::string &r1cs_filename, const std::string &proofFile)
 {
-  //load r1cs
-    typedef libff::alt_bn128_Fr FieldT;
-    alt_bn128_pp::init_public_params();
-    /* Set up R1CS */
     R1CSLibiop<FieldT> r1cs;
-  
-  std::string inputsFile = r1cs_filename + ".in";
-	r1cs_constraint_system<FieldT> cs;
-	r1cs.FromJsonl(r1cs_filename, cs, true);
-    r1cs.Pad(cs);  
-	//load the inputs
+
+  //load the verifier inputs: public inputs and parameters, the witnesses are not needed
+  json jvin;
   r1cs_primary_input<FieldT> primary_input;
-	r1cs_auxiliary_input<FieldT> auxiliary_input;
-	if (r1cs.LoadInputs(inputsFile, primary_input, auxiliary_input))
-		printf("inputs are loaded\n");
-	else
-		printf("error with inputs file\n");
-r1cs.PadInputs(primary_input, auxiliary_input, cs.num_constraints());
-	
-  	//load proof
+  if (!r1cs.LoadVerifierInputs(proofFile + ".vin", jvin, primary_input))
+    return false;
+  //load r1cs, it must be the one of the proof
+	r1cs_constraint_system<FieldT> cs;
+  if (!r1cs.LoadVerifierConstraints(r1cs_filename, jvin, cs))
+    return false;
+  //the soundness comes from the verifier's parameters, a proof made with other ones (e.g. a lower security level) is rejected
+  json jparams = ParametersJson(cs.num_constraints(), cs.primary_input_size_ + cs.auxiliary_input_size_);
+  if (jvin["params"] != jparams)
+  {
+    printf("the parameters of the proof do not match the ones of the verifier\n");
+    return false;
+  }
 
+  	//load proof
      aurora_snark_argument<FieldT> argument;
-     r1cs.DeserializeProof(argument, jProof);
-
-        aurora_snark_parameters<FieldT> params = GenerateParameters<FieldT>( cs.num_constraints(), cs.primary_input_size_+cs.auxiliary_input_size_);
+     if (!r1cs.LoadProof(argument, proofFile))
+       return false;
 
+        aurora_snark_parameters<FieldT> params = GenerateParameters<FieldT>(jparams);
 
-                                                printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
+        printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
         printf("bcs size in bytes %lu\n", argument.BCS_size_in_bytes());
         printf("argument size in bytes %lu\n", argument.size_in_bytes());     
-printf("parameters are loaded\n");
  const bool bit = aurora_snark_verifier<FieldT>(
             cs,
             primary_input,
@@ -134,6 +144,17 @@ printf("parameters are loaded\n");
      return bit;
 }
 
+bool skAurora::Verify(const std::string &r1cs_filename, const std::string &proofFile)
+{
+  skTrace::Span span("verify");
+  std::string field = R1CSField(r1cs_filename);
+  if (!InitLibiopField(field))
+    return false;
+  if (field == "edwards")
+    return AuroraVerify<libff::edwards_Fr>(r1cs_filename, proofFile);
+  return AuroraVerify<libff::alt_bn128_Fr>(r1cs_filename, proofFile);
+}
+
 void skAurora::test()
  {
     
@@ -21,8 +21,10 @@ public:
     //Verify a proof
     bool Verify(const std::string& setup, std::string inputsFile, std::string proof);
 */
-       //Generate the proof from a (trusted) setup
-    nlohmann::json  Proof(const std::string &r1cs_filename,  const std::string &trustedSetup);
+       //Generate the proof from a (trusted) setup and save it to proofFile, in binary form or in json form if proofFile ends with .json
+       bool Proof(const std::string &r1cs_filename, const std::string &trustedSetup, const std::string &proofFile);
     void test();
-    bool Verify(const std::string &r1cs_filename, const nlohmann::json &jProof);
+    //Verify a proof saved by Proof, with its verifier inputs (proofFile.vin) and the constraint system, but without the witnesses.
+    //The field is the one of the constraint system, verifier inputs naming another field are rejected
+    bool Verify(const std::string &r1cs_filename, const std::string &proofFile);
 };
\ No newline at end of file
@@ -1,146 +1,236 @@
 
 #include "skFractal.hpp"
 #include "r1cs_libiop.hpp"
+#include "R1CSCheck.hpp"
+#include "Trace.hpp"
+#include "Util.hpp"
 
 #include "libiop/snark/fractal_snark.hpp"
 
 #include <libiop/relations/examples/r1cs_examples.hpp>
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+#include <libff/algebra/curves/edwards/edwards_pp.hpp>
 
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <map>
+#include <memory>
 
 using json = nlohmann::json;
 
 using namespace libiop;
 
 
- //Generate the proof from a (trusted) setup
-nlohmann::json skFractal::Proof(const std::string &r1cs_filename,  const std::string &trustedSetup)
+template<class F>
+fractal_snark_parameters<F> FractalParameters(std::shared_ptr<r1cs_constraint_system<F>> cs)
 {
-    json proof;  
-    typedef libff::alt_bn128_Fr FieldT;
-    alt_bn128_pp::init_public_params();
-
-	R1CSLibiop<FieldT> r1cs;
-    
     const size_t security_parameter = 128;
     const size_t RS_extra_dimensions = 2;
     const size_t FRI_localization_parameter = 3;
     const LDT_reducer_soundness_type ldt_reducer_soundness_type = LDT_reducer_soundness_type::optimistic_heuristic;
     const FRI_soundness_type fri_soundness_type = FRI_soundness_type::heuristic;
     const field_subset_type domain_type = multiplicative_coset_type;
-	const bool make_zk = true;
-
-	std::string inputsFile = r1cs_filename + ".in";
-
-
-	r1cs_constraint_system<FieldT> cs;
-     printf("loading constraints...\n");
-	r1cs.FromJsonl(r1cs_filename, cs, true);
-    r1cs.Pad(cs);       
-	//load the inputs
-   	r1cs_primary_input<FieldT> primary_input;
-	r1cs_auxiliary_input<FieldT> auxiliary_input;
-	if (r1cs.LoadInputs(inputsFile, primary_input, auxiliary_input))
-		printf("inputs are loaded\n");
-	else
-		printf("error with inputs file\n");
-    r1cs.PadInputs(primary_input, auxiliary_input, cs.num_constraints());
-	if(!cs.is_satisfied(primary_input, auxiliary_input))
-		printf("NOT SATISFIED!!!\n");
-
-    std::shared_ptr<r1cs_constraint_system<FieldT>> cs_ =
-        std::make_shared<r1cs_constraint_system<FieldT>>(cs);
-
-    /* Actual SNARK test */
-    fractal_snark_parameters<FieldT> params(security_parameter,
-                                               ldt_reducer_soundness_type,
-                                               fri_soundness_type,
-                                               FRI_localization_parameter,
-                                               RS_extra_dimensions,
-                                               make_zk,
-                                               domain_type,
-                                               cs_);
-
-    std::pair<bcs_prover_index<FieldT>, bcs_verifier_index<FieldT>> index = fractal_snark_indexer(params);
-    const fractal_snark_argument<FieldT> argument = fractal_snark_prover<FieldT>(
-            index.first,
-            primary_input,
-            auxiliary_input,
-            params);
+    const bool make_zk = true;
+    return fractal_snark_parameters<F>(security_parameter,
+                                          ldt_reducer_soundness_type,
+                                          fri_soundness_type,
+                                          FRI_localization_parameter,
+                                          RS_extra_dimensions,
+                                          make_zk,
+                                          domain_type,
+                                          cs);
+}
 
-        printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
-        printf("bcs size in bytes %lu\n", argument.BCS_size_in_bytes());
-        printf("argument size in bytes %lu\n", argument.size_in_bytes());
+//Result of the indexer for one constraint system
+template<class F>
+struct FractalIndex
+{
+    std::shared_ptr<r1cs_constraint_system<F>> cs;
+    fractal_snark_parameters<F> params;
+    std::pair<bcs_prover_index<F>, bcs_verifier_index<F>> index;
 
-    r1cs.SerializeProof(argument,proof);
-    proof["type"] = "fractal";	
-    return proof; 
+    FractalIndex(std::shared_ptr<r1cs_constraint_system<F>> cs_)
+        : cs(cs_), params(FractalParameters<F>(cs_)), index(fractal_snark_indexer(params))
+    {
+    }
+};
+
+//The indices only depend on the constraint system, so they are computed once per r1cs file.
+//The prover index holds the Merkle trees of the index oracles, which libiop cannot serialize,
+//so it is kept for the lifetime of the process; the verifier index is saved to disk.
+//A saved verifier index is never overwritten when it is the one of the constraint system, so the proofs of
+//a process are verified with the index of the setup; a stale one is rewritten by Index and refused by Proof.
+template<class F>
+std::map<std::string, std::shared_ptr<FractalIndex<F>>> &ProverIndices()
+{
+    static std::map<std::string, std::shared_ptr<FractalIndex<F>>> prover_indices;
+    return prover_indices;
+}
 
+template<class F>
+static bool SameVerifierIndex(const bcs_verifier_index<F> &vindex, const std::string &indexFile)
+{
+    R1CSLibiop<F> r1cs;
+    std::vector<std::string> roots;
+    std::vector<std::vector<F>> messages;
+    r1cs_constraint_system<F> shape;
+    return r1cs.LoadVerifierIndex(roots, messages, shape, indexFile)
+        && roots == vindex.index_MT_roots_ && messages == vindex.indexed_messages_;
+}
 
+template<class F>
+bool FractalIndexer(const std::string &r1cs_filename, const std::string &indexFile, bool rewrite)
+{
+    R1CSLibiop<F> r1cs;
+    std::shared_ptr<r1cs_constraint_system<F>> cs =
+        std::make_shared<r1cs_constraint_system<F>>();
+    if (skUtils::endsWith(r1cs_filename, ".arith"))
+    {
+        //the circuit is converted in memory; its assignment is recomputed by Proof
+        r1cs_primary_input<F> primary_input;
+        r1cs_auxiliary_input<F> auxiliary_input;
+        if (!r1cs.LoadCircuit(r1cs_filename, *cs, primary_input, auxiliary_input))
+            return false;
+    }
+    else
+    {
+        printf("loading constraints...\n");
+        if (!r1cs.FromJsonl(r1cs_filename, *cs, true))
+        {
+            printf("error with r1cs file %s\n", r1cs_filename.c_str());
+            return false;
+        }
+        r1cs.Pad(*cs);
+    }
+    skTrace::Count("constraints", cs->num_constraints());
+
+    std::shared_ptr<FractalIndex<F>> index = std::make_shared<FractalIndex<F>>(cs);
+    const bcs_verifier_index<F> &vindex = index->index.second;
+    if (!indexFile.empty() && std::ifstream(indexFile).good())
+    {
+        if (!SameVerifierIndex(vindex, indexFile))
+        {
+            if (!rewrite)
+            {
+                printf("the index %s is not the one of %s, run the setup again\n", indexFile.c_str(), r1cs_filename.c_str());
+                return false;
+            }
+            if (!r1cs.SaveVerifierIndex(vindex.index_MT_roots_, vindex.indexed_messages_, *cs, indexFile))
+            {
+                printf("cannot write the index file %s\n", indexFile.c_str());
+                return false;
+            }
+        }
+    }
+    else if (!indexFile.empty() && !r1cs.SaveVerifierIndex(vindex.index_MT_roots_, vindex.indexed_messages_, *cs, indexFile))
+    {
+        printf("cannot write the index file %s\n", indexFile.c_str());
+        return false;
+    }
+    ProverIndices<F>()[r1cs_filename] = index;
+    return true;
 }
 
-bool skFractal::Verify(const std::string &r1cs_filename, const json &jProof)
+bool skFractal::Index(const std::string &r1cs_filename, const std::string &indexFile)
 {
-  typedef libff::alt_bn128_Fr FieldT;
-    alt_bn128_pp::init_public_params();
+    skTrace::Span span("index");
+    std::string field = R1CSField(r1cs_filename);
+    if (!InitLibiopField(field))
+        return false;
+    if (field == "edwards")
+        return FractalIndexer<libff::edwards_Fr>(r1cs_filename, indexFile, true);
+    return FractalIndexer<libff::alt_bn128_Fr>(r1cs_filename, indexFile, true);
+}
 
-	R1CSLibiop<FieldT> r1cs;
-    
-    const size_t security_parameter = 128;
-    const size_t RS_extra_dimensions = 2;
-    const size_t FRI_localization_parameter = 3;
-    const LDT_reducer_soundness_type ldt_reducer_soundness_type = LDT_reducer_soundness_type::optimistic_heuristic;
-    const FRI_soundness_type fri_soundness_type = FRI_soundness_type::heuristic;
-    const field_subset_type domain_type = multiplicative_coset_type;
-	const bool make_zk = true;
+template<class F>
+bool FractalProof(const std::string &r1cs_filename, const std::string &trustedSetup, const std::string &proofFile)
+{
+    if (ProverIndices<F>().count(r1cs_filename) == 0 && !FractalIndexer<F>(r1cs_filename, trustedSetup, false))
+        return false;
+    FractalIndex<F> &index = *ProverIndices<F>()[r1cs_filename];
 
+	R1CSLibiop<F> r1cs;
 	std::string inputsFile = r1cs_filename + ".in";
 
-
-	r1cs_constraint_system<FieldT> cs;
-     printf("loading constraints...\n");
-	r1cs.FromJsonl(r1cs_filename, cs, true);
-    r1cs.Pad(cs);       
 	//load the inputs
-   	r1cs_primary_input<FieldT> primary_input;
-	r1cs_auxiliary_input<FieldT> auxiliary_input;
+   	r1cs_primary_input<F> primary_input;
+	r1cs_auxiliary_input<F> auxiliary_input;
+    if (skUtils::endsWith(r1cs_filename, ".arith"))
+    {
+        //the assignment of a circuit comes with its conversion
+        r1cs_constraint_system<F> cs;
+        if (!r1cs.LoadCircuit(r1cs_filename, cs, primary_input, auxiliary_input))
+            return false;
+    }
+    else
+    {
 	if (r1cs.LoadInputs(inputsFile, primary_input, auxiliary_input))
 		printf("inputs are loaded\n");
 	else
 		printf("error with inputs file\n");
-    r1cs.PadInputs(primary_input, auxiliary_input, cs.num_constraints());
-	if(!cs.is_satisfied(primary_input, auxiliary_input))
-		printf("NOT SATISFIED!!!\n");
-
-    std::shared_ptr<r1cs_constraint_system<FieldT>> cs_ =
-        std::make_shared<r1cs_constraint_system<FieldT>>(cs);
+    r1cs.PadInputs(primary_input, auxiliary_input, index.cs->num_constraints());
+    }
+	if (skR1CSCheck::Enabled() && !r1cs.CheckSatisfied(*index.cs, primary_input, auxiliary_input, r1cs_filename))
+		return false;
 
-    fractal_snark_parameters<FieldT> params(security_parameter,
-                                               ldt_reducer_soundness_type,
-                                               fri_soundness_type,
-                                               FRI_localization_parameter,
-                                               RS_extra_dimensions,
-                                               make_zk,
-                                               domain_type,
-                                               cs_);
+    const fractal_snark_argument<F> argument = fractal_snark_prover<F>(
+            index.index.first,
+            primary_input,
+            auxiliary_input,
+            index.params);
 
-    std::pair<bcs_prover_index<FieldT>, bcs_verifier_index<FieldT>> index = fractal_snark_indexer(params);
+        printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
+        printf("bcs size in bytes %lu\n", argument.BCS_size_in_bytes());
+        printf("argument size in bytes %lu\n", argument.size_in_bytes());
+    skTrace::Count("constraints", index.cs->num_constraints());
+    skTrace::Count("proof_bytes", argument.size_in_bytes());
 
+    r1cs.SaveVerifierInputs(proofFile + ".vin", "fractal", r1cs_filename, *index.cs, json::object(), primary_input);
+    size_t file_size = r1cs.SaveProof(argument, "fractal", proofFile);
+    printf("proof file size in bytes %lu (%.2fx the argument size)\n", file_size, double(file_size) / argument.size_in_bytes());
+    return file_size > 0;
+}
 
-     	//load proof
-    json proof;  
-     fractal_snark_argument<FieldT> argument;
-     r1cs.DeserializeProof(argument, jProof);
+ //Generate the proof, using the index of the constraint system, over the field of the constraint system
+bool skFractal::Proof(const std::string &r1cs_filename, const std::string &trustedSetup, const std::string &proofFile)
+{
+    skTrace::Span span("prove");
+    std::string field = R1CSField(r1cs_filename);
+    if (!InitLibiopField(field))
+        return false;
+    if (field == "edwards")
+        return FractalProof<libff::edwards_Fr>(r1cs_filename, trustedSetup, proofFile);
+    return FractalProof<libff::alt_bn128_Fr>(r1cs_filename, trustedSetup, proofFile);
+}
 
-//todo        aurora_snark_parameters<FieldT> params = GenerateParameters<FieldT>( cs.num_constraints(), cs.primary_input_size_+cs.auxiliary_input_size_);
+template<class F>
+bool FractalVerify(const std::string &indexFile, const std::string &proofFile)
+{
+	R1CSLibiop<F> r1cs;
+    bcs_verifier_index<F> vindex;
+    std::shared_ptr<r1cs_constraint_system<F>> shape =
+        std::make_shared<r1cs_constraint_system<F>>();
+    if (!r1cs.LoadVerifierIndex(vindex.index_MT_roots_, vindex.indexed_messages_, *shape, indexFile))
+    {
+        printf("error with index file %s\n", indexFile.c_str());
+        return false;
+    }
+    fractal_snark_parameters<F> params = FractalParameters<F>(shape);
 
+	//load the public inputs, the witnesses are not needed
+    json jvin;
+   	r1cs_primary_input<F> primary_input;
+    if (!r1cs.LoadVerifierInputs(proofFile + ".vin", jvin, primary_input))
+        return false;
 
+     	//load proof
+     fractal_snark_argument<F> argument;
+     if (!r1cs.LoadProof(argument, proofFile))
+        return false;
 
-        const bool bit = fractal_snark_verifier<FieldT>(
-            index.second,
+        const bool bit = fractal_snark_verifier<F>(
+            vindex,
             primary_input,
             argument,
             params);
@@ -154,6 +244,18 @@ bool skFractal::Verify(const std::string &r1cs_filename, const json &jProof)
 
 }
 
+//Verify a proof with the verifier index only: neither the constraint system nor the witnesses are loaded
+bool skFractal::Verify(const std::string &indexFile, const std::string &proofFile)
+{
+    skTrace::Span span("verify");
+    std::string field = VerifierIndexField(indexFile);
+    if (!InitLibiopField(field))
+        return false;
+    if (field == "edwards")
+        return FractalVerify<libff::edwards_Fr>(indexFile, proofFile);
+    return FractalVerify<libff::alt_bn128_Fr>(indexFile, proofFile);
+}
+
 
 void skFractal::test()
 {
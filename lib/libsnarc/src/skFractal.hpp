@@ -21,8 +21,15 @@ public:
     //Verify a proof
     bool Verify(const std::string& setup, std::string inputsFile, std::string proof);
 */
-       //Generate the proof from a (trusted) setup
-    nlohmann::json  Proof(const std::string &r1cs_filename,  const std::string &trustedSetup);
+    //Run the indexer on the constraint system; the verifier index is saved to indexFile, unless it already holds it,
+    //and the prover index is kept in memory for the next proofs of the same r1cs file
+    bool Index(const std::string &r1cs_filename, const std::string &indexFile);
+       //Generate the proof and save it to proofFile, in binary form or in json form if proofFile ends with .json
+       //The constraint system is indexed first, unless this process has already indexed it; the verifier index is
+       //saved to trustedSetup when it is missing, and the proof fails if trustedSetup holds the index of another system
+       bool Proof(const std::string &r1cs_filename, const std::string &trustedSetup, const std::string &proofFile);
     void test();
-    bool Verify(const std::string &r1cs_filename, const nlohmann::json &jProof);
+    //Verify a proof saved by Proof, using only the verifier index saved in indexFile and the verifier inputs of the proof.
+    //The field is the one recorded in the index, verifier inputs naming another field are rejected
+    bool Verify(const std::string &indexFile, const std::string &proofFile);
 };
\ No newline at end of file
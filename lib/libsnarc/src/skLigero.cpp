@@ -1,9 +1,13 @@
 #include "skLigero.hpp"
 #include "r1cs_libiop.hpp"
+#include "R1CSCheck.hpp"
+#include "Trace.hpp"
 
 
 #include "libiop/snark/ligero_snark.hpp"
 #include "Util.hpp"
+#include <libff/algebra/curves/edwards/edwards_pp.hpp>
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 
 #include <gmpxx.h>
 #include <iostream>
@@ -14,104 +18,109 @@ using json = nlohmann::json;
 
 using namespace libiop;
 
+//Parameters of the proof, they are saved in the verifier inputs, where the verifier checks them against its own
+json ParametersJson()
+{
+    json jparams;
+    jparams["security_level"] = 128;
+    jparams["height_width_ratio"] = 0.001;
+    jparams["RS_extra_dimensions"] = 2;
+    jparams["make_zk"] = true;
+    return jparams;
+}
+
 template<class FieldT>
-ligero_snark_parameters<FieldT> GenerateParameters()
+ligero_snark_parameters<FieldT> GenerateParameters(const json &jparams)
 {
   ligero_snark_parameters<FieldT> parameters;
-    parameters.security_level_ = 128;
-    parameters.height_width_ratio_ = 0.001;
-    parameters.RS_extra_dimensions_ = 2;
-    parameters.make_zk_ = true;
+    parameters.security_level_ = jparams["security_level"];
+    parameters.height_width_ratio_ = jparams["height_width_ratio"];
+    parameters.RS_extra_dimensions_ = jparams["RS_extra_dimensions"];
+    parameters.make_zk_ = jparams["make_zk"];
     parameters.domain_type_ = multiplicative_coset_type;
     parameters.LDT_reducer_soundness_type_ = LDT_reducer_soundness_type::proven;
     return parameters;
 }
 
- //Generate the proof from a (trusted) setup
-nlohmann::json  skLigero::Proof(const std::string &r1cs_filename,  const std::string &trustedSetup)
+template<class FieldT>
+bool LigeroProof(const std::string &r1cs_filename, const std::string &proofFile)
 {
-    typedef libff::alt_bn128_Fr FieldT;
-    alt_bn128_pp::init_public_params();
     /* Set up R1CS */
     R1CSLibiop<FieldT> r1cs;
   
-  std::string inputsFile = r1cs_filename + ".in";
 	r1cs_constraint_system<FieldT> cs;
-	//r1cs.FromJsonl(r1cs_filename, cs);
-  r1cs.FromJsonl(r1cs_filename, cs, true);
-  printf("padding...\n");
-  r1cs.Pad(cs);
-	//load the inputs
   r1cs_primary_input<FieldT> primary_input;
 	r1cs_auxiliary_input<FieldT> auxiliary_input;
-	if (r1cs.LoadInputs(inputsFile, primary_input, auxiliary_input))
-		printf("inputs are loaded\n");
-	else
-		printf("error with inputs file\n");
-  r1cs.PadInputs(primary_input, auxiliary_input, cs.num_constraints());
+  if (!r1cs.LoadCircuit(r1cs_filename, cs, primary_input, auxiliary_input))
+    return false;
 
-	if(!cs.is_satisfied(primary_input, auxiliary_input))
-		printf("NOT SATISFIED!!!\n");
+	if (skR1CSCheck::Enabled() && !r1cs.CheckSatisfied(cs, primary_input, auxiliary_input, r1cs_filename))
+		return false;
 
     /* Actual SNARK test */
-  ligero_snark_parameters<FieldT> parameters = GenerateParameters<FieldT>();
+  json jparams = ParametersJson();
+  ligero_snark_parameters<FieldT> parameters = GenerateParameters<FieldT>(jparams);
 
     const ligero_snark_argument<FieldT> argument =
         ligero_snark_prover<FieldT>(cs, primary_input, auxiliary_input, parameters);
 
-        //serialization
-    json proof;
-    r1cs.SerializeProof(argument,proof);
-     proof["type"] = "ligero";	
-  return proof;
-
-
-    const bool bit = ligero_snark_verifier<FieldT>(cs, primary_input, argument, parameters);
-
-
-
-    if (bit == true)
-		printf("PASS\n");
-	else
-		printf("verification FAILED\n");
-
-
+    printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
+    printf("bcs size in bytes %lu\n", argument.BCS_size_in_bytes());
+    printf("argument size in bytes %lu\n", argument.size_in_bytes());
+    skTrace::Count("constraints", cs.num_constraints());
+    skTrace::Count("proof_bytes", argument.size_in_bytes());
+
+    //serialization
+    r1cs.SaveVerifierInputs(proofFile + ".vin", "ligero", r1cs_filename, cs, jparams, primary_input);
+    size_t file_size = r1cs.SaveProof(argument, "ligero", proofFile);
+    printf("proof file size in bytes %lu (%.2fx the argument size)\n", file_size, double(file_size) / argument.size_in_bytes());
+    return file_size > 0;
+}
 
-    
+ //Generate the proof from a (trusted) setup, over the field of the constraint system
+bool skLigero::Proof(const std::string &r1cs_filename, const std::string &trustedSetup, const std::string &proofFile)
+{
+    skTrace::Span span("prove");
+    std::string field = R1CSField(r1cs_filename);
+    if (!InitLibiopField(field))
+        return false;
+    if (field == "edwards")
+        return LigeroProof<libff::edwards_Fr>(r1cs_filename, proofFile);
+    return LigeroProof<libff::alt_bn128_Fr>(r1cs_filename, proofFile);
 }
 
 
-bool skLigero::Verify(const std::string &r1cs_filename, const json &jProof)
+template<class FieldT>
+bool LigeroVerify(const std::string &r1cs_filename, const std::string &proofFile)
 {
-  //load r1cs
-    typedef libff::alt_bn128_Fr FieldT;
-    alt_bn128_pp::init_public_params();
-    /* Set up R1CS */
     R1CSLibiop<FieldT> r1cs;
-  
-  std::string inputsFile = r1cs_filename + ".in";
-	r1cs_constraint_system<FieldT> cs;
-	r1cs.FromJsonl(r1cs_filename, cs, true);
-   r1cs.Pad(cs);
-	//load the inputs
+
+  //load the verifier inputs: public inputs and parameters, the witnesses are not needed
+  json jvin;
   r1cs_primary_input<FieldT> primary_input;
-	r1cs_auxiliary_input<FieldT> auxiliary_input;
-	if (r1cs.LoadInputs(inputsFile, primary_input, auxiliary_input))
-		printf("inputs are loaded\n");
-	else
-		printf("error with inputs file\n");
-  r1cs.PadInputs(primary_input, auxiliary_input, cs.num_constraints());
-	
-  	//load proof
+  if (!r1cs.LoadVerifierInputs(proofFile + ".vin", jvin, primary_input))
+    return false;
+  //load r1cs, it must be the one of the proof
+	r1cs_constraint_system<FieldT> cs;
+  if (!r1cs.LoadVerifierConstraints(r1cs_filename, jvin, cs))
+    return false;
+  //the soundness comes from the verifier's parameters, a proof made with other ones (e.g. a lower security level) is rejected
+  json jparams = ParametersJson();
+  if (jvin["params"] != jparams)
+  {
+    printf("the parameters of the proof do not match the ones of the verifier\n");
+    return false;
+  }
 
+  	//load proof
   ligero_snark_argument<FieldT> argument;
-  r1cs.DeserializeProof(argument, jProof);
+  if (!r1cs.LoadProof(argument, proofFile))
+    return false;
 
-ligero_snark_parameters<FieldT> parameters = GenerateParameters<FieldT>();
+ligero_snark_parameters<FieldT> parameters = GenerateParameters<FieldT>(jparams);
 
  const bool bit = ligero_snark_verifier<FieldT>(cs, primary_input, argument, parameters);
 
-//TODO serialization..
 
     if (bit == true)
 		printf("PASS PASS\n");
@@ -119,4 +128,15 @@ ligero_snark_parameters<FieldT> parameters = GenerateParameters<FieldT>();
 		printf("serialization FAILED\n");
 
      return bit;
-}
\ No newline at end of file
+}
+
+bool skLigero::Verify(const std::string &r1cs_filename, const std::string &proofFile)
+{
+    skTrace::Span span("verify");
+    std::string field = R1CSField(r1cs_filename);
+    if (!InitLibiopField(field))
+        return false;
+    if (field == "edwards")
+        return LigeroVerify<libff::edwards_Fr>(r1cs_filename, proofFile);
+    return LigeroVerify<libff::alt_bn128_Fr>(r1cs_filename, proofFile);
+}
@@ -0,0 +1,287 @@
+#include "skPlonk.hpp"
+#include "Plonk.hpp"
+#include "r1cs_libiop.hpp"
+#include "Trace.hpp"
+#include "Util.hpp"
+
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+
+#include <fstream>
+
+using json = nlohmann::json;
+
+typedef libff::alt_bn128_pp PlonkPP;
+typedef libff::Fr<PlonkPP> PlonkField;
+
+//Points of alt_bn128 as decimal affine coordinates, [] for the point at infinity
+typedef skFieldCodec<libff::alt_bn128_Fq> FqCodec;
+
+static bool FqFromJson(const json &j, libff::alt_bn128_Fq &f)
+{
+    if (!j.is_string())
+        return false;
+    std::string s = j;
+    return FqCodec::FromDecimal(s.c_str(), s.size(), f);
+}
+
+template<>
+json skPlonkCurve<PlonkPP>::ToJson(const libff::alt_bn128_G1 &p)
+{
+    if (p.is_zero())
+        return json::array();
+    libff::alt_bn128_G1 a = p;
+    a.to_affine_coordinates();
+    return json::array({ FqCodec::ToDecimal(a.X), FqCodec::ToDecimal(a.Y) });
+}
+
+template<>
+bool skPlonkCurve<PlonkPP>::FromJson(const json &j, libff::alt_bn128_G1 &p)
+{
+    if (!j.is_array())
+        return false;
+    if (j.empty())
+    {
+        p = libff::alt_bn128_G1::zero();
+        return true;
+    }
+    libff::alt_bn128_Fq x, y;
+    if (j.size() != 2 || !FqFromJson(j[0], x) || !FqFromJson(j[1], y))
+        return false;
+    p = libff::alt_bn128_G1(x, y, libff::alt_bn128_Fq::one());
+    return p.is_well_formed();
+}
+
+template<>
+json skPlonkCurve<PlonkPP>::ToJson(const libff::alt_bn128_G2 &p)
+{
+    if (p.is_zero())
+        return json::array();
+    libff::alt_bn128_G2 a = p;
+    a.to_affine_coordinates();
+    return json::array({ FqCodec::ToDecimal(a.X.c0), FqCodec::ToDecimal(a.X.c1),
+                         FqCodec::ToDecimal(a.Y.c0), FqCodec::ToDecimal(a.Y.c1) });
+}
+
+template<>
+bool skPlonkCurve<PlonkPP>::FromJson(const json &j, libff::alt_bn128_G2 &p)
+{
+    if (!j.is_array())
+        return false;
+    if (j.empty())
+    {
+        p = libff::alt_bn128_G2::zero();
+        return true;
+    }
+    libff::alt_bn128_Fq2 x, y;
+    if (j.size() != 4 || !FqFromJson(j[0], x.c0) || !FqFromJson(j[1], x.c1) || !FqFromJson(j[2], y.c0) || !FqFromJson(j[3], y.c1))
+        return false;
+    p = libff::alt_bn128_G2(x, y, libff::alt_bn128_Fq2::one());
+    return p.is_well_formed();
+}
+
+template<>
+void skPlonkCurve<PlonkPP>::Write(std::ostream &out, const libff::alt_bn128_G1 &p)
+{
+    //the powers of tau are never the point at infinity
+    libff::alt_bn128_G1 a = p;
+    a.to_affine_coordinates();
+    char buf[2 * FqCodec::kBinarySize];
+    FqCodec::ToBinary(a.X, buf);
+    FqCodec::ToBinary(a.Y, buf + FqCodec::kBinarySize);
+    out.write(buf, sizeof buf);
+}
+
+template<>
+bool skPlonkCurve<PlonkPP>::Read(std::istream &in, libff::alt_bn128_G1 &p)
+{
+    char buf[2 * FqCodec::kBinarySize];
+    if (!in.read(buf, sizeof buf))
+        return false;
+    libff::alt_bn128_Fq x, y;
+    FqCodec::FromBinary(buf, x);
+    FqCodec::FromBinary(buf + FqCodec::kBinarySize, y);
+    p = libff::alt_bn128_G1(x, y, libff::alt_bn128_Fq::one());
+    return true;
+}
+
+
+static std::string &SrsFileName()
+{
+    static std::string srsFile = "plonk.srs";
+    return srsFile;
+}
+
+void skPlonk::SetSrsFile(const std::string &srsFile)
+{
+    SrsFileName() = srsFile;
+}
+
+const std::string &skPlonk::SrsFile()
+{
+    return SrsFileName();
+}
+
+static bool &InsecureDevSrs()
+{
+    static bool allow = false;
+    return allow;
+}
+
+void skPlonk::SetInsecureDevSrs(bool allow)
+{
+    InsecureDevSrs() = allow;
+}
+
+static int &LookupMode()
+{
+    static int mode = skPlonkCircuit<PlonkField>::kLookupsAuto;
+    return mode;
+}
+
+void skPlonk::SetLookups(int mode)
+{
+    LookupMode() = std::max<int>(skPlonkCircuit<PlonkField>::kLookupsNone, std::min<int>(mode, skPlonkCircuit<PlonkField>::kLookupsAll));
+}
+
+//The reference string for circuits of 'rows' rows. It is only generated if the file is missing or too small and
+//SetInsecureDevSrs allows it: generating it is the trusted step, and in production the file comes from a ceremony.
+static bool LoadSrs(size_t rows, skPlonkSrs<PlonkPP> &srs)
+{
+    skTrace::Span span("srs.load");
+    const bool loaded = srs.Load(SrsFileName());
+    if (loaded && srs.MaxRows() >= rows)
+        return true;
+    if (!InsecureDevSrs())
+    {
+        if (loaded)
+            printf("the reference string %s has %lu rows, the circuit needs %lu\n", SrsFileName().c_str(), (unsigned long)srs.MaxRows(), (unsigned long)rows);
+        else
+            printf("cannot read the reference string %s\n", SrsFileName().c_str());
+        printf("supply the reference string of a setup ceremony, or use --insecure-dev-srs for tests\n");
+        return false;
+    }
+    printf("WARNING: generating the PLONK reference string %s from a local tau, proofs with it are forgeable (--insecure-dev-srs)\n", SrsFileName().c_str());
+    srs.Generate(std::max<size_t>(rows, 1 << 16));
+    if (!srs.Save(SrsFileName()))
+    {
+        printf("cannot write the reference string %s\n", SrsFileName().c_str());
+        return false;
+    }
+    return true;
+}
+
+static json CircuitStats(const skPlonkCircuit<PlonkField> &circuit)
+{
+    json stats;
+    stats["rows"] = circuit.Rows().size();
+    stats["variables"] = circuit.NumVars();
+    stats["row_counts"] = circuit.RowCounts();
+    stats["lookups"] = LookupMode();
+    return stats;
+}
+
+bool skPlonk::Index(const std::string &arithFile, const std::string &keyFile)
+{
+    skTrace::Span span("index");
+    PlonkPP::init_public_params();
+    skPlonkCircuit<PlonkField> circuit;
+    circuit.SetLookups(static_cast<skPlonkCircuit<PlonkField>::LookupMode>(LookupMode()));
+    if (!circuit.Load(arithFile, ""))
+    {
+        printf("error with circuit file %s\n", arithFile.c_str());
+        return false;
+    }
+    skPlonkIndex<PlonkField> index;
+    index.Build(circuit);
+    skPlonkSrs<PlonkPP> srs;
+    if (!LoadSrs(index.n, srs))
+        return false;
+
+    skPlonkVerifierKey<PlonkPP> vk;
+    vk.n = index.n;
+    vk.numPublic = index.numPublic;
+    for (const auto &s : index.selectors)
+        vk.selectors.push_back(srs.Commit(s));
+    for (const auto &s : index.sigmas)
+        vk.sigmas.push_back(srs.Commit(s));
+    vk.g2 = srs.g2;
+    vk.tauG2 = srs.tauG2;
+    vk.digest = R1CSDigest(arithFile);
+    vk.stats = CircuitStats(circuit);
+    skTrace::Count("rows", circuit.Rows().size());
+    skTrace::Count("domain", index.n);
+    printf("%lu rows, domain of size %lu\n", (unsigned long)circuit.Rows().size(), (unsigned long)index.n);
+    if (!skUtils::WriteJson2File(keyFile, vk.ToJson()))
+    {
+        printf("cannot write the key file %s\n", keyFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool skPlonk::Proof(const std::string &arithFile, const std::string &keyFile, const std::string &proofFile)
+{
+    skTrace::Span span("prove");
+    PlonkPP::init_public_params();
+    skPlonkVerifierKey<PlonkPP> vk;
+    if (!vk.FromJson(skUtils::LoadJsonFromFile(keyFile)))
+    {
+        printf("error with key file %s\n", keyFile.c_str());
+        return false;
+    }
+    if (vk.digest != R1CSDigest(arithFile))
+    {
+        printf("the circuit %s does not match the key\n", arithFile.c_str());
+        return false;
+    }
+    //the rows must be those of the key, whatever the current mode (keys without the mode had no lookups)
+    skPlonkCircuit<PlonkField> circuit;
+    const int lookups = vk.stats.value("lookups", static_cast<int>(skPlonkCircuit<PlonkField>::kLookupsNone));
+    circuit.SetLookups(static_cast<skPlonkCircuit<PlonkField>::LookupMode>(lookups));
+    if (!circuit.Load(arithFile, arithFile + ".in"))
+    {
+        printf("error with circuit file %s or its inputs\n", arithFile.c_str());
+        return false;
+    }
+    skPlonkIndex<PlonkField> index;
+    index.Build(circuit);
+    skPlonkSrs<PlonkPP> srs;
+    if (!srs.Load(SrsFileName()) || !(srs.tauG2 == vk.tauG2) || srs.MaxRows() < index.n)
+    {
+        printf("the reference string %s does not match the key\n", SrsFileName().c_str());
+        return false;
+    }
+    skPlonkProof<PlonkPP> proof;
+    if (!PlonkProve(srs, vk, index, circuit, proof))
+        return false;
+    if (!skUtils::WriteJson2File(proofFile, proof.ToJson()))
+    {
+        printf("cannot write the proof file %s\n", proofFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool skPlonk::Verify(const std::string &keyFile, const std::string &proofFile)
+{
+    skTrace::Span span("verify");
+    PlonkPP::init_public_params();
+    skPlonkVerifierKey<PlonkPP> vk;
+    if (!vk.FromJson(skUtils::LoadJsonFromFile(keyFile)))
+    {
+        printf("error with key file %s\n", keyFile.c_str());
+        return false;
+    }
+    skPlonkProof<PlonkPP> proof;
+    if (!proof.FromJson(skUtils::LoadJsonFromFile(proofFile)))
+    {
+        printf("error with proof file %s\n", proofFile.c_str());
+        return false;
+    }
+    const bool bit = PlonkVerify(vk, proof);
+    if (bit)
+        printf("PASS\n");
+    else
+        printf("verification FAILED\n");
+    return bit;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include "json.hpp"
+
+//PLONK proofs of arithmetic circuits (.arith), see Plonk.hpp and PlonkCircuit.hpp.
+//The setup is universal: one structured reference string (SrsFile) serves all the circuits up to its size,
+//and the key of a circuit is computed from it without any secret.
+class skPlonk
+{
+
+public:
+    //The structured reference string, which must come from a setup ceremony: the setup fails if it is missing or too small
+    static void SetSrsFile(const std::string &srsFile);
+    static const std::string &SrsFile();
+    //Let the setup generate the reference string (or a larger one) from a local random tau instead of failing.
+    //Whoever ran it knows tau and can forge proofs: only for tests and development
+    static void SetInsecureDevSrs(bool allow);
+    //Tables of the splits and bitwise gates (skPlonkCircuit::LookupMode: 0 none, 1 range, 2 auto, 3 all).
+    //The key records the mode of the circuit, which the proofs follow
+    static void SetLookups(int mode);
+
+    //Compute the key of the circuit, from its rows and the reference string, and save it to keyFile (json)
+    bool Index(const std::string &arithFile, const std::string &keyFile);
+    //Generate the proof of the circuit for its inputs (arithFile.in) and save it to proofFile (json), with the public values
+    bool Proof(const std::string &arithFile, const std::string &keyFile, const std::string &proofFile);
+    //Verify a proof saved by Proof with the key of its circuit only
+    bool Verify(const std::string &keyFile, const std::string &proofFile);
+};
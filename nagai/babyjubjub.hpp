@@ -0,0 +1,1642 @@
+#pragma once
+
+// Generated by gen_fixed_base.cpp; do not edit.
+
+#include "edwards.hpp"
+
+__attribute__((always_inline))
+inline EdwardsCurve BabyJubjub()
+{
+    return EdwardsCurve(Field("168700"), Field("168696"));
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint BabyJubjubBase(const EdwardsCurve *curve)
+{
+    return curve->NewPoint(
+        Field("5299619240641551281634865583518297030282874472190772894086521144482721001553"),
+        Field("16950150798460657717958625567821834550301663161624707787222815936182638968203"));
+}
+
+// k * BabyJubjubBase(curve), for k < 2^254
+__attribute__((always_inline))
+inline EdwardsPoint BabyJubjubMultiplyBase(const Field &k, const EdwardsCurve *curve)
+{
+    EdwardsFixedBase m(k, curve);
+    // bits 0..2
+    m.Window(
+        "0",
+        "5299619240641551281634865583518297030282874472190772894086521144482721001553",
+        "10031262171927540148667355526369034398030886437092045105752248699557385197826",
+        "9320849781438120831560510540885989877928867589805203431788999674916123194604",
+        "12252886604826192316928789929706397349846234911198931249025449955069330867144",
+        "15816703297417962054296591450179777481671628090902468347592974266861588727756",
+        "10088085260282538488410977159907352530986276307469129742081970493846992983275",
+        "1059640048357984368016599047431946746674733771994146656336467621076721861717",
+        "1",
+        "16950150798460657717958625567821834550301663161624707787222815936182638968202",
+        "633281375905621697187330766174974863687049529291089048651929454608812697682",
+        "19610006447509301468320975060221778985040697970314735180066655888082907338425",
+        "1286140751908834028607023759717162073146610688084909004843365841635476459483",
+        "18800187369601738193483551818143364833106867411566190250410611584075058761477",
+        "14903477063648801046019369696822870569164144530729687024400696090472485201065",
+        "5593934850610064961351918118877543231016302637539222527333952279517843148549"
+    );
+    // bits 3..5
+    m.Window(
+        "0",
+        "7582035475627193640797276505418002166691739036475590846121162698650004832581",
+        "20535751008137662458650892643857854177364093782887716696778361156345824450120",
+        "11924041147927374444791297505297105253007795371111446596942287200309774806851",
+        "17637772869292411350162712206160621391799277598172371975548617963057997942415",
+        "819276408397490293607534387204112678753289911214078302404853394164116210512",
+        "12349251630777539753436482618647211817213929436938965340109349878935366125885",
+        "17340841288296610759659553316014362371725466178776171806720783292934352379820",
+        "1",
+        "7801528930831391612913542953849263092120765287178679640990215688947513841259",
+        "21459189231378695508316163458360356529222201254620325044724979975334648070150",
+        "21024438912708168392769827928513673601729790290123655093076323046077024694084",
+        "19641326725043875799903403987343978153690949184340502090612493837393445612300",
+        "209092853836345248782169609323198478705876906276449655538976236585636429231",
+        "3807339634073678343741062667690984428521996686315682066329509579567327806339",
+        "20460528936414707140006210171044718352134292597454643829750960008833883906861"
+    );
+    // bits 6..8
+    m.Window(
+        "0",
+        "11147493790480072323687435957938716856159204975974571370488032222228450666507",
+        "15682916869554082088927242380307540680242868250587650971620353578859275889350",
+        "2601302110160100411729703218970459579915969106416773155726964089891080537749",
+        "6731772326573707943281170126807511100588982199552205014357183957581855002669",
+        "10439073401772488345021041176438906993211463604904146935546114140013508060716",
+        "7269552009435802169405005320659336717423353653291075498485151598551118826927",
+        "974382645354014327838011169732860578334971301541874915920971548250796214656",
+        "1",
+        "7297783963315293144303066632651031949682903221819939895220732712782447138293",
+        "2256150559862924509301488304706696335357793961614189900426090067095184088265",
+        "13395728400466941945317295441101428951811471169503919053693698874204123892486",
+        "11973951889356123770128127962555067849151313231298804870147860675316725975747",
+        "8859632640783275716060026594161232045028512287169864451996065680099490398572",
+        "16536973073924546386105472442482325722688090594356827395248812243374660018079",
+        "17208364335002382483583927781397699112959930721167292420774265775032185300145"
+    );
+    // bits 9..11
+    m.Window(
+        "0",
+        "5302137634790117518217103058625746073394606742896349422255473727763681741566",
+        "8002483549832294162773183878688895687540015241151729522994976801202180095377",
+        "7073892036709647056776609938138316183125447597241956990717076640575431574320",
+        "2286651464569112544294953541116746863136500001098781865856980039751923274424",
+        "2193570098008408839073794585775437828209859192515652488519700831602945532335",
+        "12635599026717503910871541449557943544618369125357509755597027763461600013047",
+        "874344509806851749022251521573154663415600634034288351358927611743937574024",
+        "1",
+        "5715782234278246684037434299542088499278554735952525271260387151476520542124",
+        "9230261269014627056320236658183624618743880096729897065398761428492566647832",
+        "349188258178931562405077784285531788952760758014382150102355834324668033208",
+        "7363230526563484206447356558931199626455619717068375767259058182110698893910",
+        "18977913828920370673937544549866783653857539456230981072380327061451280580846",
+        "3772275639480726631185507285755229727066314028019924220556781736386940256686",
+        "13644466039273868996306134330545277863574149425005388954229701909793659464027"
+    );
+    // bits 12..14
+    m.Window(
+        "0",
+        "14553701413074991219096747080711615242065815659865424017845211034410965840239",
+        "19678128255920944991287858448093868740484672659646108311980516690580026068110",
+        "9231931429646431575208313521527400480614967383762299877347040610638606871265",
+        "15227170406973047599586217726306581161903787950549337238461996926532754888158",
+        "14842116594758930846008362881210002517983443666610616153796648960744108609642",
+        "21015442175350943712048316736503167118070921172211996164183961240334264570215",
+        "16439532683099266670651257231286934661016573652789881461929891957825732483888",
+        "1",
+        "13591243454297365848719372676992908085762757043204242277513940025707896351953",
+        "21272836954776476886917169960736847641993451090581680169106828110848349153635",
+        "4652378185553775689224467784467890798803350950090617247646749159673418755977",
+        "5997587780164905627222321320982748688838012655235182822671989907135512787655",
+        "2624613626357016927124728535645820397217690978519152054782846223970424424439",
+        "18007870398379004028296535859489992876133348863903887615691637053302553465163",
+        "15506303839809459565498401577075677422297961397153703773368026460032223827754"
+    );
+    // bits 15..17
+    m.Window(
+        "0",
+        "2159432878320710799047301437777456558024763119294390094099170870011697868850",
+        "6087860318543522148066035595487069153742436291511180267123197344643978926406",
+        "9382562301639665496898349036716421085062458231859015033370806584530247090271",
+        "21043986026226881658335140302855256039340865894916618016578909046624155458218",
+        "8690980320016149202045556005597761440551268097902318402532378878032602604863",
+        "4452960647841099704191357887852236943673191236585729961669789115832829883695",
+        "240986314336442744576438709675100506174653621677090487535711718141171081696",
+        "1",
+        "20556379768951106225497465810739987525270200668974586114514951160655326137736",
+        "21279850443278030856937990895443501144215625627019470193972148984983205961794",
+        "12573395342809322588008384512716663943965943427112244040539563426944594331897",
+        "16526380266692672615932128594058421414504994904611156529557362443278894695448",
+        "538921222926825299208614210341555363492500137257007186062381934923450288703",
+        "21431694547786609463106526290895536785294562355044703826265677928239285937736",
+        "12981652927619680970860863184814266230027205509226984761389676514924741178192"
+    );
+    // bits 18..20
+    m.Window(
+        "0",
+        "7018880040597171679619301901571935469792746257472108994634149534132957272339",
+        "7292237757592026547608113176730624015785473709073583335899082566975310335664",
+        "7089726854663670889940649453061798804442720926559665101577318477892001945570",
+        "19778492900002352124648515686864543223655015191596662007370083254218304690828",
+        "8598133778477049226385365338997488717750792892535131927076853362936756297361",
+        "21515394046865217631619668473430044575393156838264104001730963944067772364339",
+        "18268708621465297084205682704008514162628555729445578219589462699070337143289",
+        "1",
+        "10660625195243399351376766962182950884450440804655026801012608488026815258856",
+        "20487509553425843033426515597260184923273561091772733297617672650167555370600",
+        "10728783634791709356625938102185823283938594912698364779244096501822969833781",
+        "5973218203242513272835745690928765422621098470728843393050004275315589452023",
+        "21023330691786563984748129319363560953778232897132775942112039273238168482046",
+        "14415296905957499178007169404312443824078673873441926241778102812260880035563",
+        "2492601565962627215960928764547826344142616357314474399664957000573815392666"
+    );
+    // bits 21..23
+    m.Window(
+        "0",
+        "10729918080520118123464130235941844407435370400759784931720880958234364741202",
+        "18076958270990943237204235062947145477890430288742142965644160361311734126105",
+        "6757526671448165918022338940157507332432742956410172179257209744843175603485",
+        "15787423637776991190270802505250918900539496100549450323918627170607794952612",
+        "1524806124002347932317846539689980359287883464952382818722577062036223663852",
+        "21041059646460798545052728538756347881225558942895656769867543132010474278155",
+        "14495689451923806973330874977628059679190356462178345767590280138376837980284",
+        "1",
+        "10792289606471496202404806533469044337556676306189999502147940325575779035448",
+        "8493158497032493655678474755546082841022794488122625890689784582496215159605",
+        "8611001444561261248093938972754405749037249488592423461441523438444592434203",
+        "6087886223782492363610045662986807800941040348610967943184024284770446769860",
+        "19617517443650955403289141130218317239497760734179258216935737445498912005790",
+        "17556534890441860473919170797111104464817969648149332946625740143667746682664",
+        "19327327214000930735918414250893588840333092591727064779516882533472653290892"
+    );
+    // bits 24..26
+    m.Window(
+        "0",
+        "14039928464820124421050888682250598606935565423652438816847805570702203084223",
+        "5367702110741344770985151059531430158888921701835628397334584302629397019568",
+        "7606089731237340147536407267664306528093290870435009092791835598788460851743",
+        "15514484009085462523768962318060026818784898526521711265343545690065515165309",
+        "8861913754575064310609533477831413570296533429816214776074414891250035608855",
+        "12427212248587176194520528580682778399608948759733284680423913826168978747354",
+        "17075470417435178288506191580594158132527185672094918839859425758092072475609",
+        "1",
+        "5366670138758769914717825502348980772457625673164203689850802916249728019850",
+        "16847903117415152552110450697220860606066640144387478958516173230368899389437",
+        "10762052775289757458435235314382820903446043336962426946342329787312439200398",
+        "4994261979773101433898571297480736160409057976036039836124169449357769618790",
+        "8150452635765849726541870420201313550506858101997428883065025642790352785016",
+        "10282015125351046699580810718404728639588056166966713938897412990280782015540",
+        "6679748788345568331266856914821873623274138347851602311155991597638906075808"
+    );
+    // bits 27..29
+    m.Window(
+        "0",
+        "5978965049830640440789354952942063826079057614630617454027359737855185314618",
+        "8952703977308106773381678650553001603529097062087589727874413492001962390686",
+        "789279391994867368248048534964653655277815773225073099209696207911038202088",
+        "6306130290505896753091891989978579242271761641227566561619046952356078481227",
+        "8773997459597679670537202206142865952835138901783409904199302189186681601732",
+        "18812616894849725624913105340938548127942363515577844488307008208853166667003",
+        "1888205146087288354358527992862202537828742734755550367524827323999384758575",
+        "1",
+        "9206401761097751114235485525210546951459936063104562248311920687092997715825",
+        "18143455169742129651893987214073287724185746869272813449431722929632623189328",
+        "18925140101578486875741529880111001298991344889624599743756027918120889078810",
+        "16572699589422214560864406300943243666295889076901168917542155100898583354253",
+        "9988136857286232815942579656293256661373967207767003516335949446470707199993",
+        "20099310298931580541511335355893143385503898511726016536394739809149616148500",
+        "6119977336868822914584266150845068896444769153633994808349019506015922002426"
+    );
+    // bits 30..32
+    m.Window(
+        "0",
+        "12321328698847114099317943570564090682082102733985714438734692046545107815711",
+        "21372871726206208816813640205630131938345673671424128789183282815096876690209",
+        "17222328332244247067879880131613841241761034533097366001139597749195510473020",
+        "13924641157502813998759594372437865478825281838225516826720234568502723756325",
+        "13516331572988192634895328972375113989845831569887458495652767709599550827432",
+        "1176473297074560884699901210212140052298779809064390979106464929498319779475",
+        "2159317088096091205486015275638955861650998172645932513953273432110893131595",
+        "1",
+        "13546343462164398375610952051929842474944293246179717710044361280145845869958",
+        "21491782824646388571423914728088871457068984734024971785358900251994802117593",
+        "17481351471451543074655324203073730205541679055997007830678592739001786229584",
+        "5909344824063165275624417723557917583356454568781175462442470854960225156712",
+        "20148619059122142785505032466997329350564399250786414929178892428095610099167",
+        "898481872394947287939135788209703941571107824560745210021551224580669530570",
+        "21271542180873545560862983275400228172477473881584626091727847179129116545998"
+    );
+    // bits 33..35
+    m.Window(
+        "0",
+        "9082895948244164437177740500998344122940721136076790948386255475278429860274",
+        "21241877958269118349252055794288158267610665751705889513426830643707416732645",
+        "9220500810879114057293260260643980757038177368230871219787114988885044012773",
+        "17703211952018463495478103243995313872283905723193157491862059465185150356618",
+        "15980286026632195108963947471646313661142639473857148041313802260355929377828",
+        "11847297222138395808307720061993194944133864412916896871051352752116880629874",
+        "15057045932110653738558447937984407021848678262883677887022769183152777224181",
+        "1",
+        "10795372130698610547498215613147500539086793995885575249891830253826260960061",
+        "21021731325497391466040199910361597817345134231460120235109164205941141980484",
+        "18553291085397465468520433547814393030249866073016178121305305729078202326809",
+        "12440158894065727250161310112310671628120044389286965510380176422904246259712",
+        "16779621407227688529913314297348912992590863494368846446198886394781074330997",
+        "6042964834147173937812268506869955250839749711810551119349671413314115914618",
+        "6835910857537080943560208355137303928593195412000818828814828141706610188964"
+    );
+    // bits 36..38
+    m.Window(
+        "0",
+        "12922924855865174317381123733250527858852803435567169755546187555369719237384",
+        "18717920469648820640837013782794498811353995889026787605055908747714342618723",
+        "14874373970894122131978505542977679310071203933451573353362949284241007432862",
+        "14528951733968492300398491662818898839554913984523948162382447125866362530296",
+        "3918445486231804874360559610458403798643988825044849109580560159387319894106",
+        "10439124779875027138717083008695060453964093015456946816907029429608454409865",
+        "3750720979443794361136208852077116918554930333695060074064268251579466747427",
+        "1",
+        "2821944769690741670493738861774183114658792674677397036446844822979287887658",
+        "13153931782879480368414579229159228321046214897536665963976194025412022261740",
+        "11916436320959083270521214475214653125838029870325307926505501785837735398563",
+        "1738840812475072794000822431332215917621418929704838017048961606738342672437",
+        "13784484580018250345877145988263394915604560976569341755083412304789914273679",
+        "21394102953320924703625200454472990288844603372843624836204292150560301108735",
+        "15524467891016677116424319607044916036134627380918885022658354078731687432313"
+    );
+    // bits 39..41
+    m.Window(
+        "0",
+        "1708853014448844538186975599297749740193307916482363170037096276507092102269",
+        "1922364862937225794969445407984242679306843931604824366960335767162411229421",
+        "3786675260134998619191767099413678273901342445725889322526353798016353045480",
+        "14087347025655337214397516518329401665683242420776888305953519031495443874950",
+        "924696460750866097388380296686195351991696467834112573026868400623387635020",
+        "6567915914464357117941420998806979702786915264454276439874276152706689180705",
+        "7409624000067122221322795678410933594243802105426757618036169963723161275452",
+        "1",
+        "9530181497955858702903690505295999848334745497916449752314308467197450787720",
+        "409835779568587692372384972864995236820235824553758025048710389691129427521",
+        "7995714327538564352487292492292586113392820043434883403433127663382273012481",
+        "7076305323990798768328492548061267595465729634601171839117131384640080848260",
+        "19193930905190884822637670190858771951643513441912075284559368772585841791390",
+        "10409513528357465233311830840110621933945802595110912979492823449675600826323",
+        "21391274220971433408274546222901624000814609157315307141464436936129348158601"
+    );
+    // bits 42..44
+    m.Window(
+        "0",
+        "10822133453613922090137607341023416144218084185102711320326281596400714670080",
+        "11270963838532999811935840744838671853320049455745427367701687554315138537187",
+        "14005866106376634467936184721460370429961715977362336089482642972854006430491",
+        "3473090910751943848656785830477967319713879188422943521007200014391124099674",
+        "18877459334961732078759525195894533363409669685952709661725208200996464053525",
+        "7971339448207061199469233632001060887651134635600738534398611983814580829198",
+        "465375107511560114526280177513318004683434135079413952173843195806015463801",
+        "1",
+        "19627281887395329458268532326868623967998777237531685838663356892159375980175",
+        "19785628338688052587640851408202162764260996046206703619533586561004219718645",
+        "18990146743915516585371975583511068699467270540384245153224975953393013792930",
+        "19748851962936141001762450238066305840051403297809288235324786098010696196334",
+        "16470991339048858321913918625942989325055672605257647339447066310288108650301",
+        "17200177877494066618313986331852943799611767927263182150295193283609125202962",
+        "4807221158099958792029648585087183065281902058685755685633193309969243790382"
+    );
+    // bits 45..47
+    m.Window(
+        "0",
+        "3796243100649458168593938002004629653638015182608255510767971621758039476003",
+        "2940696173170780569015730405625986400812775718642239317321675850383387151066",
+        "3024552827206937924845910635452456195061682519412863241818236803139561780608",
+        "18079416035230656149234811836675734376721622358549707577590401938674282129515",
+        "1722427056054266245533743301906621569777280938007734886336583976234116586559",
+        "14317321202060667894857603091007109460714106634746617149918577398273315243849",
+        "1147214670977208760049881201872356838178079500289014305052998470254028031703",
+        "1",
+        "721483557009857689195670829632428104749290349705340260702465542429346022064",
+        "4276669164966298015460630779817850008391783859380551899856133012983276320580",
+        "3032085625267113253405743455071451803915025298933712830457811614735137525427",
+        "5621698601987675307528948441029834296456071929167250346404203380762199874729",
+        "9700266961911919976415492725564095960771420743679833245776164372258683303419",
+        "5390931339612203687501443619634472418796699986411749841970705251260806116073",
+        "4662585288312259371687559504304849460379725880242607723212367714734827435604"
+    );
+    // bits 48..50
+    m.Window(
+        "0",
+        "5361975302943842507890733473483048702455265142042473246996571995031725969534",
+        "19828349637491409533078528744837286005233439866911416416776376030430690920846",
+        "10357690118388337165488772869136300219889243886675075757186390304375489640569",
+        "21650284802870369919329306047127051552669484619629852626879947268001414229489",
+        "9926528691618738471125228765427201931703903396402658133202547143097531478458",
+        "13682397063035471126796319170971220253200905453995774548598146231422810470259",
+        "1155553694782349226502450108991676842695718862012203704086826377969225593950",
+        "1",
+        "3072034374648054167867677601745685009024481963789231479548604425310850807475",
+        "2223847491325449053677045711077391131201022363360509134624802612589594713173",
+        "9426420315012626138990062253524295135970267142482712085278059226769706366742",
+        "12374419870942973950770696188631682233229274234441526714583687433783837986775",
+        "4511580609054628964466492233964394545802689181543987485840003966111051984174",
+        "3849564088152535923236656718433768403950434158138321963532006738619894474213",
+        "17130747242151045389705856980676061172565199705439218957329754386363922474660"
+    );
+    // bits 51..53
+    m.Window(
+        "0",
+        "15548204179875058574785846547136497336391975222457372985529118535335009405775",
+        "3937166883539410805984358929911445965511059648279993507610886748617586866922",
+        "3888421095234599383207291516798009222977110189084249063554600506739160130336",
+        "21432929979471144880824373055406992287795092964587397042064064313060939335886",
+        "8719513593093025896573904001956120644943170266644191529976751464951648624588",
+        "5446849023764852460293485999163142898825219571067698541602085500052614220462",
+        "6538391944899569141646122549251863813478844155838337229941313809129531375107",
+        "1",
+        "5286213742464630792964598111882671724754589597045118964463037988498821432934",
+        "10774401781619132225795525259892382834015493095206333719115394143099940705077",
+        "3050379426587844756686861199245592860894009177358341786464752393424093665751",
+        "17239560032311799702434686174934452460522713331259656498490626097439581257566",
+        "14166675022945973541569573371175591304805679356097999097173434538707081242394",
+        "13411829884401471477689215898008133889590177769380300253298928443933000226426",
+        "17120753475155750926311843289964865529154479750498523496506159516904041386740"
+    );
+    // bits 54..56
+    m.Window(
+        "0",
+        "18898877488177594589233600795647071250832384451244918032683109403564097065822",
+        "17731705778762039472194850134683876463850911340948207928875774108379430081175",
+        "19586048729212546507708329964978145946283356098159861217410541079574738324399",
+        "4609261227866689087962851295588219157557857533993019743895049037049910007977",
+        "18684101474434629026642413618182651020539094475376616105482767416171146245028",
+        "13778894426532723280950130818814016034070100060238775773175712100354276429768",
+        "4784000550723507414195187036185982215163186673819370144985299178286965192775",
+        "1",
+        "9859690846220527600742557038971078577433843648851444471497893512709317387913",
+        "20919001986710312200752977023007723284926933878463761552563184673764305533651",
+        "12429488754313293508292922932508107652863696351497803810326134409801297620055",
+        "7514247399483479189240117641653087213731258166286687271303305535550415730758",
+        "1138222335043038710567207593167766096939408163259638048556514871618031960016",
+        "7984618645956379907260639480056532574683156686929253830940791098513464288179",
+        "2070356502356816820535862629686914331393646588773618262736105700562659408755"
+    );
+    // bits 57..59
+    m.Window(
+        "0",
+        "4068107002487462694861859226271994267531542037311772548883006823849504142455",
+        "811472830850042912621832713681755117678581787895283948175448625430751409804",
+        "15849598801764041399307318653924051858964758521976056550417580927289119964340",
+        "14419429594139418501450190324386942708310197242714114537379147928133305897864",
+        "4211057200392518509553601264073877304447876503439454332845165071040034533568",
+        "6499503923493170894599699187993239888952577549721925753465857271397683125162",
+        "17211722262425852915938646146879587922266425123603674159505801885084560067964",
+        "1",
+        "12676363936920405171468980707390133933113040232973361858255850950637685449043",
+        "12437397465583854687898983440893101182288209004413845856798172551731662233936",
+        "1231083576715510593903369362166649416270811561899293578899054901759175436231",
+        "15922632026015550649989885424808088074017415072019398593845046361871355856842",
+        "12146119777788881870487628703651954140165279227813187458920578846833467135309",
+        "21002804673705867771602525828654415154371796840871163240127119254582231328318",
+        "384855550552768995258919622756400730454210087310413923975230347981826855398"
+    );
+    // bits 60..62
+    m.Window(
+        "0",
+        "21713655108261872435735292030345367049597093276417149681210314235496836931748",
+        "20771353604557873779501255242355227254012825844381925304809892363178097700008",
+        "2787700700281841865897840979533228700831129616624506165680974315449761775600",
+        "4334857091115639445485335710443678878289937963653283157467964170140825820870",
+        "9621681462802288852078955865425838857026269437223001721816326988449692354908",
+        "228316164338221596787175852697148545196078921405333991841164694546419328435",
+        "9694087892090387901983548076100351490090497721897233386756402965646436279189",
+        "1",
+        "20824721178437066362128325986987397655134946191653357925678441839443869392571",
+        "15170617038999412748322345810632224309513984179469039711951679685292961533602",
+        "4135410430164842340371283163767669166372619252892460614531970053255586936107",
+        "10080233156507572987158455777239099070977307092883390788835918640919580867591",
+        "12899536927665645802204705579160841723934361608832994783727003954893690344483",
+        "7860317004134276127812455111014640692728966405689317715419877531552656584292",
+        "5977553777860315711797285834658682709299731964863951769117150763089211361828"
+    );
+    // bits 63..65
+    m.Window(
+        "0",
+        "16737714893491379770770528721035800780787896464870103912725995767541496719790",
+        "16764638822458977327186786061593466055111162619481137081092838603273621419560",
+        "21437043835140113469676737294725961166669072607646589861348840896339578563470",
+        "17950724888091640066291436888136748245101529136707239993193391784577224508466",
+        "12311099071447947125035404487135596168461726775086125894468816213986544199332",
+        "12354480962319750518076503116939835644885249024179825205268555562301749314839",
+        "5273126597737872700080398346353239609321734085049767811575379433144943302882",
+        "1",
+        "20662632037018641342455029072009121025968422104850797621629617897983058092663",
+        "1127439671418127976375250254135856815185956293144029847351582396768017092965",
+        "20340799467826330084709300975373509777053393099391118919813328944066936299740",
+        "18939340910837581048041367064723623541534665012693298804609091313872430178575",
+        "499491020432288102366432354679078980535874585357935652266042297048042645510",
+        "6615769653244063851629572471367920940250871309611155868096391000988667819511",
+        "8008601545210063322412252763932985557429778651354828501250471932014555362962"
+    );
+    // bits 66..68
+    m.Window(
+        "0",
+        "11184646480383582139436548388263671118611202483392084439588648551700082070872",
+        "4435482281760813086641367496471405515443177494589624068416740780841028281557",
+        "19199580613795069042596499573563605797465815566032028222634543605228311996170",
+        "13823089312715856636368233978473392308455005342781861010989415019506022880413",
+        "10470701389320322966503361728242948105303583164791948530523434837745114083830",
+        "9185305765714616621806036742566939916380437005123858944120792847477547922162",
+        "17844810476638821889600581135878284071295927922483026538250343486790846277104",
+        "1",
+        "2033040850803863807287368547134342622311714994116507359015165105503785154531",
+        "15364265370405345910291588767091049001307084379828663042293477981804030169855",
+        "19943993908858297620579566722126303488363280915033042342021007521040188939672",
+        "13556419251966618824387848274902472393793206125390204553981523313321176666431",
+        "21597901155913015166877593029818613112238766580512722540130991966987636863512",
+        "21250800786998396345633250313115685893751297322948950625945515321427094085242",
+        "5873418259506656791569655256358732563879690411863763555382121243129699543078"
+    );
+    // bits 69..71
+    m.Window(
+        "0",
+        "14117524690770708908293992888155424022716450618431518766568521014941281821906",
+        "21059560753493150717008188003258603191088039261995657815462129422261671494707",
+        "10196890956722301651918415415444207680013137455169994243885869666916215354179",
+        "7487337601196003827584993339941885302791204854776598117785366324781704904098",
+        "502388927909424325695362306671048780126676552363849768414006954083492395400",
+        "4217589589220340853747073714453600449463722205133261476457403328652482885012",
+        "18985204622016097750274193525322346365994064743669335327856824583550723120799",
+        "1",
+        "16049232270206131544604934434879990409150077230341900858065369729730721555178",
+        "3259813792158051106878181215875299718310778924790333142545658339197221964490",
+        "5654143939130607673705615075352939542393348635710030950399279638860767923934",
+        "4426533023125050717852591839726920578442966030904845872980706571095262764249",
+        "8501528706265015843795795661751395969572006767914342226081034100955451856300",
+        "9605878803090074973243706151775212885938847524907554180956562784534936652548",
+        "4072878439637340477453347009387461434633768022978382569384889021262400681597"
+    );
+    // bits 72..74
+    m.Window(
+        "0",
+        "10978044511409153323023184041639249894841402787624793335367487536643360060938",
+        "11063707641101149224675072520722162589112429712972507758345515207461036598771",
+        "18799107961506644776525106883720123259663527329130989447598481659767995135284",
+        "2892489805202699071974292372784232288056150226233792180172679971704267876172",
+        "16794642967688361005152813983204253513493494378126432702622299511236712729801",
+        "18060192667297220529967518219026272038067743401886083547066386688089137810280",
+        "4534573797075432211526278072899632394663913035047425679615313464438991917108",
+        "1",
+        "20351318861589637186942586059529728107218658444615645969039342849826923148451",
+        "7357811154888451005377103688773654614369808980502125269290896984328803163590",
+        "11416931083460423273566726865943743111817936520962455816638011588572883580460",
+        "200676681044717313432007287756732334642723954870529570230069458831802816734",
+        "14770190816138666018894020264104849419512265373026859074137146554146637873449",
+        "20361305241413702899114909335034665688624269484945184521247715934060336660807",
+        "13064448012572608572079973836586693738974729325703238394444700892129114838167"
+    );
+    // bits 75..77
+    m.Window(
+        "0",
+        "14105730577164136932280581373839500479556933870985221532237161950873034878802",
+        "7077645323475878146475089717721772407825969332619197499264777822110146740483",
+        "8689073962783442156945443651906225388765013080555233728609984197122931673303",
+        "2625793561905345955170555461658686065168924761954376495574300907672989926978",
+        "14027914702591197254696763726534499851780801426149002528189301849926803212289",
+        "7878275141815481212438217554084360482611984861815949166511437866783279928202",
+        "18215377141389294043753577601095801247415646924039107346033144916803834073017",
+        "1",
+        "21595339641999389342338711033899453440051659244909171715926810788403726304544",
+        "11813566083933244923112115177594896722288317477699481901919074486734708857093",
+        "9487071047279865209511420181647775087443155669763606622563729726172484277336",
+        "20160525129992937460790739769094427160693659433418863294402429521780087311963",
+        "13191831511891838636991923889080971055577009173099430008052132052711502574352",
+        "20592075698292845212468840061786321050081584330052319905849423207830643195433",
+        "4890759900047467448820719841057805009775157431080751348375954746202123021465"
+    );
+    // bits 78..80
+    m.Window(
+        "0",
+        "1324699898075260892982017871834065932537817746047313517795646938651695889927",
+        "7432369993766101529483947359347930383449521632167074584259543913611335312570",
+        "15958922690154416053126595930789152674256631222589091165201236868682523598051",
+        "16872713021045149922689773382406605144070175075610102140607545346840285239395",
+        "302552489126923722285374561044711761715635445070641880157059299237803524465",
+        "8212634959476012578407185539857038440239351548399603376878449809524964754042",
+        "732410081246658901919208521533820768326889521639795641255550590185057483343",
+        "1",
+        "5136051877680009513339517203699033327687543182071147089771384513516651908642",
+        "13918710928086603443321982398831411430378961675017697602784318388381536620126",
+        "12998010001948628064094965941588119612604626691139374121481339400145333324578",
+        "18934104016907768217364122461565578892886649652469998782399324507240509443772",
+        "2509159027268650867646528710142535848509112195780507921915849601996554091359",
+        "137361037987321085165555782085940259787913123359614089730402107578885209457",
+        "20199387173863399763527346621169287375795146697198245378189379187980796249367"
+    );
+    // bits 81..83
+    m.Window(
+        "0",
+        "123943172127229503284334346813305548437786836075195410708834670753623062003",
+        "7207972695621011632198462864324044032049175442698880856046000897015853114324",
+        "3051361538424258201656181563669400997398801067078367606696113513676775390320",
+        "8098047196736241169921424296416628953778369760273649068011892617224322938439",
+        "10989846266194146696495488872558512737933392925645630422350726940350679266715",
+        "18345521946562927668680154513196824704803721545027510220040507482927651288908",
+        "7151302247243293070790549581456608370263045934211467308368104148960454653793",
+        "1",
+        "20949382362122952001049892474629750967238740957736091372783886524341941419736",
+        "10317884576412086363116763942069250944363778335099060903519484031541544603896",
+        "8873252584699229377609200562231621001488537790816441514942045717315371891480",
+        "17789687620172293006440499687663432304804624978775647939427355567148534383243",
+        "18520549072396837934789595314676108526646642503067459188984960641952679474253",
+        "11196620914553012042003303470030749763346048461415279562921432267086017650137",
+        "13326446277345100958635852037340029227862953267051909628440291182303291819372"
+    );
+    // bits 84..86
+    m.Window(
+        "0",
+        "7353977873245457279924918292804957182290077454206159933064409691059280039381",
+        "19554964279138075796105785929523938995843897730897320770293920090151857983658",
+        "6403417061555407937058855036334185257266272580123023447583080117560001044391",
+        "18895463501259048465819007295793535855169782503875170646374058189759943464310",
+        "2092701608689625529446039903752210658786142960298046462712692976404979093394",
+        "16907871566886964991914348899496884293554518095964702791144793789879462173524",
+        "21654867087586867496203407067016856966198434583004467400141645159505460258894",
+        "1",
+        "8719323696245555724374447931988492404903947256740503895244820022785166349126",
+        "6251770748439952898738802976138737054043882319334197003278905219441937135287",
+        "18155460135895367445902368036664805619808855820881182445487992175912798542396",
+        "13493128635301319774654236837345166574198862188207005487838575756541746497528",
+        "17109363641513398147651292953627507885977115246561503277142652494267778326974",
+        "18796347444876080628677520414200897507485141704074871108950618778188280698318",
+        "6294291864290998144240027657135584055642553624566503612218321166614742649991"
+    );
+    // bits 87..89
+    m.Window(
+        "0",
+        "10855733428794067401980525676431222062808567249661103749529430834101148434815",
+        "13650053902620393455982956085548748811751067335501585767816283159461918406685",
+        "12633095134235718095278774960079355872490371936806792099720823043168112068425",
+        "13661572510741586310907022796023433072411357803013451206039430910914809136413",
+        "5824038414149894069635769361976782350210478390384458701188107132164586161437",
+        "3241118516227866003696027487424604130952507115947423738404664303950194424176",
+        "15202763761399635263441953735896282552894383612224529606467109539382577118316",
+        "1",
+        "3746255701087119630482826152238913995108201665062518383875526569869691887446",
+        "13068443780877595894810144716209356417402056054742667198082244360275910029033",
+        "17717924835194887983414501504552470947610998442176822982900021058620103783279",
+        "2582596668791051992017855485971623717841143839122353192903561552226725113664",
+        "15479862558804496909844634879448233535423029906723868938420786073921327430194",
+        "5839171057838466475207991746654618876900347880036891312016018021675501825040",
+        "13863005389457088646198528064802682189065197515019134999224349556620601110374"
+    );
+    // bits 90..92
+    m.Window(
+        "0",
+        "1954885857793627167937677119268961022744822536988328924321925715698824260308",
+        "18896203598951479933203019961388716651820649349948420809067748176847887376210",
+        "8245077474965025305267197494121418651074524192441755339261100940475390059681",
+        "7870009699444358771108305132375241429966527590237371779525727788857246611518",
+        "7127642050741334767344909141229685555640037920391157107626371023454504490711",
+        "6988407455901564271790959615378326480944258291904307293531169870417781858449",
+        "5416888320133095695320658746150025271194109007289481321551164408899872296041",
+        "1",
+        "4662762652723095553610230111989106157395916908129108919752364292847846762527",
+        "2164777567651442042580647918081179182258865322213803630836436476654601294414",
+        "9157392730658858008291066856120311984867132920520894291617947996979666302641",
+        "12640641634624758288784406658768679285196416306396376543924089082575700270553",
+        "8812596239664596817910348245600507400381638558031363853833137906336621288205",
+        "21210400191918567567542844638861818911779820401847144724743470837693169318410",
+        "4254624534996394785160035020170253648251929992480013454105634029281140802493"
+    );
+    // bits 93..95
+    m.Window(
+        "0",
+        "15022681818230760268821641996000205164192050456463713391197545543230715140419",
+        "2434610545413250866755623546869315550220439394321150225873151345139851412204",
+        "9383145220845857032260581484258791700170831844935458433311307518283905635696",
+        "13275368739947230139472146836792278137229926246989758993229077266618407966889",
+        "10283824936580672722289351103234511496466764226665368814655990894324139778817",
+        "17736684640071250252722385150848511427766567266196574232734872512963693483636",
+        "20940915734204772605265156520748303059163689876768878455665514159881303239416",
+        "1",
+        "10110093281737319919005734425701001509948313250906747566467111738260319466539",
+        "17894345946530961031969628205499056757687353595230071721495111881830618517233",
+        "328168448054579587672466847804450873387497977212156455378975793718033300864",
+        "7320809664650883561755818828927856748391309889060586934516230757891031929896",
+        "4578702963699679610641428062181151957111674916521838380988809285184505286843",
+        "525774899132904023072319928296873089805791856670053420976911726900887506663",
+        "7907395274528101790056252519392330912619783955179174121245799430048729444444"
+    );
+    // bits 96..98
+    m.Window(
+        "0",
+        "18896593303542233803388997006800684009311432157842440053726874230584965556284",
+        "4877718897113394998575159692057590423007722204871729089145029187795913504671",
+        "3776655803122732040849896395304908390760571241175832028321369910394522117159",
+        "9133493153533384087038530792050972618529729525189293763094351134176474979230",
+        "20252810830279356760715558684027897155611987049999082346290974589941651590137",
+        "19325168015801671148483366203560737089682287219356588232195503286209402631417",
+        "6345181591147601736018417401538052684672332111268270720459856838236275223467",
+        "1",
+        "12430144338611588192426217343884856927487992389290497067376762023895430115053",
+        "17853319844400775048308541733820208970752969704231149686183433628696793512365",
+        "1980533115811973070757016936022930863440013452621512442296893423015125125937",
+        "16957397977912996589008240850174389008399428994313515759591133988364245306649",
+        "18357052604017976722790095574429879755892891829006709010765946008849151351422",
+        "16125546319051317398488694205335239342351678587405086756123652583639469445326",
+        "1662332159054056324039541038968516673121160586894479110009316163210608479162"
+    );
+    // bits 99..101
+    m.Window(
+        "0",
+        "3341153178335358273186752335394973744065402005866610231122985455279865973961",
+        "10114273146143037434377844808908403150345064568708198747598648519545104472952",
+        "14244432579622475025335788330362887887687719866274531810429464019260479962416",
+        "14089911555064213535811443860704226489376702222908041728222278233126385889305",
+        "7570113758711803449076178316373154493983135686098122992880837083049587267343",
+        "12566234966877581161192308075566543035975662111346150970760863598831171979221",
+        "16548534777453317179066680306356211267978437700037272177465870840714449447172",
+        "1",
+        "878828442674810412649894343637911633445401449471609554799519417932737264500",
+        "2717288445871543707022361301538656504540252330484178842375450354081622661673",
+        "5721640690115165420036561061660074316299180824423761762940050493532745990183",
+        "9621521832294482653759268873019994947394360162920287289606397379819805421431",
+        "9697505376154122771388618084331883402318490533488293663194959822035891980292",
+        "9083112558572673281820096332218457964120302098118643562619564640379023596754",
+        "12942720294782775690557459330213900235666542836501771350608360964912239398409"
+    );
+    // bits 102..104
+    m.Window(
+        "0",
+        "6597376575009372370958545176693127656118295468965135238229226564094479202104",
+        "3892075572019233470199352937008600231030917758641538246877856343833253348131",
+        "953751164687682022130752098714495696379439215051090190720692474957417448039",
+        "9899273547872852652627194856058410251144393368386959709915130163219970148813",
+        "6546435521941508516390788657904041459118579000582351594149777048713117669808",
+        "11345346667815679721854593263949816307642744118438015395026023810565021841841",
+        "17991286251654323863032988062861094642970405553973424586247766841828142525043",
+        "1",
+        "1972640743496423324152534230823119479898062954005589386326654529257581024729",
+        "4744021023117654634660848738313713656617315885995495065779697914388202871182",
+        "18690856210870830903340805030445810317156655316581134707970400379090535070894",
+        "8715892660470224483781927835758840942876905247882290847598732950323377003243",
+        "20374872038877691046955097416770627894590831090519803039262146582937066873716",
+        "20238613646028105873278000847250237596952927772062451424879727966402509684932",
+        "2901524867439852539966294210280287944553063050562704799484008120830740726840"
+    );
+    // bits 105..107
+    m.Window(
+        "0",
+        "693398094317607794573158187381243975731462354669984543176625306431102210795",
+        "8321442760794040270440544081024975525162750452498773078898679038263474684405",
+        "2861613642254249919035893392529268107792823939754080699021507786341633794281",
+        "18211269500535566839260330636384815815457572337264953861160944460712354297892",
+        "11547166866424554696930191563749837354755987467013644816868322776192748855242",
+        "7326721807184970745313197918961126471561598724610436357732782642705740980413",
+        "14192598744593757273832972926636564702168563332442508262636930662028406221443",
+        "1",
+        "17091242607597684999438718329856021630187743559439342765100621168825616845376",
+        "9845101263869041587009071174670024574032903959023303552754115914118146000542",
+        "7727770162326273513252330331293591136213228443100935946433701348558050569262",
+        "8718234741368560253781777821943440366916054326144261405765881101055754355634",
+        "10593572834550134885237662133831754589937396744300871074228612875280985158870",
+        "1873865539337975335593981448457515244980921019340386748272184788649772008411",
+        "18191608276580867945749157626877596905038696779852919702686724755899278874458"
+    );
+    // bits 108..110
+    m.Window(
+        "0",
+        "8644783915018389684232973393109429391901928103227511277296994674513569434440",
+        "18639886500889007843570859641609467255489393398360918369481720930526352975641",
+        "19097570125904696473907496967726912633419411038160532658017517861233885365469",
+        "5402438956776233350721920072595265363348998727991038660312774610642837856577",
+        "20324186888641575213781102359203629371740150439206064160112952955471878143238",
+        "506107635028344307625598710515546913338597110215986036035239561074698603448",
+        "21879543307797507857604626806062739166474004356010741798390416690092567733450",
+        "1",
+        "3158872409265269225120083888468895950198834919076332399612341110976067120072",
+        "7658668909936882966347999545907226135474077924674407727338341279731029165490",
+        "7440883028666963202907386405706407229033743826844049607228733865895325917246",
+        "5093841731716781137305459863382693581854425228765375145742728625226638064884",
+        "8001143253895171726286435612049732123357134299641990278573828975618091835635",
+        "2286791724737883673420579224102686939936702912282037821306333664983673415016",
+        "21288581368287541434449257150462226999467114107645708092438374545116805407962"
+    );
+    // bits 111..113
+    m.Window(
+        "0",
+        "1956267260590775957011416071156231399763609491134631680120961421384721301235",
+        "6248049042342730801676136699668454605641266703358933411499447504196065248407",
+        "18846628790364766785509744326244094858578260030602714020888426058264164095938",
+        "3948863526164669667340726123804843698560999389999066895480938573621464201914",
+        "9814297887752352325048798968419529476122782561065664956091400196614383367309",
+        "5376188379209651358762114382058992328969959109160413790557802242397023661653",
+        "2297922483726967566814522962573138405546297193751654558234328543686907119563",
+        "1",
+        "8242652765745411061480526050247364277115626340883347866902328157852536065652",
+        "2486286498781682111028455111415647393816499164258727627660433326322569007317",
+        "1874050239738227715125957290518613764686486188726348476420931528493779736279",
+        "15095491952214361001881989217192953218661088542170965250107322596422360489892",
+        "4401217819863900886951181895649899909177136910158113751960197242748199019574",
+        "7339828156583496222902226319046723047310542428207884223502269306947579165169",
+        "19793176883236357894956066452798101497528401388842520904846611837769111412647"
+    );
+    // bits 114..116
+    m.Window(
+        "0",
+        "10436817334566592836673163157066174354962487206309502058534731058620964484130",
+        "15221319512869015143490957560563809953976052410780834733128520716045002475223",
+        "6683490014071325883980933373099736893138448936386705904793792344925643912615",
+        "8914943600868916235734584419283274885233001010467008776672072325478010776834",
+        "1327873286345698811331864347260171972589766016949319903509497049815299622957",
+        "8238724983412807905415168972771742688279551760540931945816909182427510444247",
+        "4211961245832261976949630615697413180752192788681115086916434489559669634459",
+        "1",
+        "20994897281268879481428472342514450138690828846097570476603069336445345044848",
+        "10685953263944041271118175720242634593098062369974675902529309280683001851216",
+        "18277925753561049557262624745873901594921740863428486556519443696794343594221",
+        "18748451494166649099940462985282095514337866594711534684943292259615103169084",
+        "6063019925320756648947118517129572066158068808411227422532875242009038426150",
+        "1911925067168280144599105993438766586289901976149986052881840382331909144200",
+        "21748761388844388633310288655733743603467828272966509123394438141274731209492"
+    );
+    // bits 117..119
+    m.Window(
+        "0",
+        "13478115137849985395357419013836490626190478321980953096762985752781862905543",
+        "18653468903112364246248804569792905529015048116088001117375113560704316589202",
+        "19248626011866080385434534981031076015143098693097376594247893869804306979659",
+        "1548903026454565617896025422820722746735544316130885739435922136446487300083",
+        "18623220478578898553247784630500922221598455202763736109031945508327656863680",
+        "2750887706523305471501138359530557712121728284908372238423242174492271209945",
+        "3567509319946649299500507273112797822038132795901970389650537108464050208924",
+        "1",
+        "16799508042241215679805627065419682473639219492743642380938192312059714231888",
+        "2598138591058086752394434999092593820266319980335660558941591681492107923449",
+        "16218164687954701609611125319113421843442958232441486508019924363768734805993",
+        "11002431391549121127962725950923766962146462793834868517214514631348494356423",
+        "14338400491762691451334415882448657764808453004937648415101314949521821182599",
+        "19345725095860878396991073148921403158508449879963109411995080124704972439080",
+        "5421169468560848131922085358589537066220818176821038957754948631015489088293"
+    );
+    // bits 120..122
+    m.Window(
+        "0",
+        "13302863704348626255247142609109887658715909579507359595131714715788432128925",
+        "16541514113907688828140301979629760319046918185849813937156338455169633309794",
+        "18178570188727707024561203539014764675242851790798868236667622705065571703757",
+        "407005325116997490248728731209238689343136027748351456769031199849733852351",
+        "12660403954127182205285155401142171449579344779844223784704143296337774725125",
+        "7219277475271338552165019114162585109793885635904774948652780579973281380160",
+        "4376613442812451868270177768896053465920683757816928830996516031467551421438",
+        "1",
+        "270745718185399994435774541620855974412130442984612400610644356876336336766",
+        "3639104765332013442756606403533373340963044794564321453302297201592945434328",
+        "19278410442066785598601872697115833940565884701522987214573601997641335293260",
+        "7607282185378030818196920645706928161192945673027909957973362386040860359834",
+        "13557804516881027294546854437324653577566816500486305248929904859533069519556",
+        "16907621837016535082049902707588418382759518652141956399281837421730818602209",
+        "10411191719192700611546442577476332374373378837939142994990131220007475943041"
+    );
+    // bits 123..125
+    m.Window(
+        "0",
+        "9810854338087866015221785336780049553256684886405309078589594045227590582006",
+        "6372314886335030891374293937379966736250953160843828586320915405375668666129",
+        "1013031283473707451120069315318398384452055801025956220192132677291534394531",
+        "14883537080013620145881499563412702256024875474786297851221793436827496306138",
+        "7829198724789071874582962201158195546797405736316059794207154889676247293921",
+        "2830783501293807990862804329680947239573676219493963639345725081780028228805",
+        "548239729149687200635060945376167940341978352072206910213739777116653281961",
+        "1",
+        "8721184945650803679250140922703270216778788376989464225195744177154686648238",
+        "5682178371955920180522357076201071873291730561905048271712601474983751498057",
+        "5180425971019780887287979658644396637349035849977031059391278904670051732852",
+        "11752099628469221112885754887337391630347332173330370661455782299789758988997",
+        "5123734357109398213507574031641479191989104354119100786120972266691413512602",
+        "16042940821402726061655711109656236088493516278388718124126256396915616191449",
+        "20258652796208970765233670246621255359561892979983195639764958943651489901749"
+    );
+    // bits 126..128
+    m.Window(
+        "0",
+        "676583362441941884904849513306435237997697751417913180854758603789978062322",
+        "10711996111964199685347916601784101748408275090782195430640140983222150540126",
+        "8244486415300757583877776894414766059576326401125470997459134046916518835222",
+        "10288974518820505514752818269060448351810381487680098163350900759224851730336",
+        "535886652316507680001839270443168785327295760705483760112107748832395393061",
+        "3991700313903374004029010700454542686751336310176801131457206117402155442754",
+        "20502917560788605394532368603698091309344633522191919147194693431526899326506",
+        "1",
+        "16598826128984567586970516975504581535000905301776882198018384134335919147982",
+        "2201018300873950736007718658887855005855709262514182592310236706351593324715",
+        "16389266018203685223189255396136775788464182299086477521962335211149964387411",
+        "21651882603086694405693098948972420980963565681985490126120123423300778618928",
+        "8146539125654087554696779596433877851727784303965631015197657940998734184118",
+        "794274760408045716413095736109988814858759200524314301793702355384093240584",
+        "18516569050235736507896863006761787481700469788385873831855246769233635270033"
+    );
+    // bits 129..131
+    m.Window(
+        "0",
+        "12862814070426821830032772031905477772215236093271638886792320133097091662321",
+        "15831644631497195825058711412699108719319718559236689644581297972391242428266",
+        "1640789236141874153478855293336032062343887715738179350973484301219936794597",
+        "17490674886141821114261243862753629736354068589817024523387615619146306866337",
+        "21516848671605566095517577880152231412245299560226914342123898944967973687177",
+        "16298073080448737634857814423910533367734710193578957942260090317020312080699",
+        "16261422387541036263723290932309420623997832618651563058713318864780449326216",
+        "1",
+        "20728801537065575200220871767503957852787064423241271869179117069272601425639",
+        "5170623923927370028826767949757661806866135602670102939648682646045496912972",
+        "16499804401246573590016084938800668175821133565582739988579356819050912574490",
+        "18790551310986193494571556057535103703011767374084323655555787331216583764850",
+        "16629299176468567653019205206346444065566456116301114378744183937411836809339",
+        "7323925166940082712250988974966844302620120097541275164654385614256320312177",
+        "14523006164203568176975355296898190298081527753984157425957431600477968643092"
+    );
+    // bits 132..134
+    m.Window(
+        "0",
+        "5079048234336978213340200158027050528148508727698587510154888615437066045598",
+        "2756923660815785903412162480713311210269368715355769335884387001364078869542",
+        "11728724502105216211067491017337556038066731762337180003932527923458420914240",
+        "2948054090009025942814798478371812968352166179039554378681603068666228343900",
+        "10732616857583437904544881012599350551794562781204676438337655714041063849682",
+        "2584662632483344218464635280088753374285753811293511749710573389364015342882",
+        "8734351698333985002963441597947135234668779344744121998349111801698397343926",
+        "1",
+        "5016496752852685159650377201461293376288381686104673134839516571522950281638",
+        "19934811516391708581189788870384182316674070783324245702447333550491885438212",
+        "17019522980961277064816660718894816901100961930460437207660193377905016855053",
+        "4715500910436417957826294295760244051262970467193047980696057554880414729164",
+        "21040907083312857504064055850577900425503286337559504470275976323356486276461",
+        "21029493559356204202560324029947279610895891759685942500680453936564528327131",
+        "16117150333401684077049177622557896119230361020706657505299726508224445102412"
+    );
+    // bits 135..137
+    m.Window(
+        "0",
+        "18040991090214835348778866218236111966812716690606841483840150457121160705500",
+        "18905071495524654478069556580163675726776769232298510201587615914505921119104",
+        "16207464338810388119490902939653002257981891805673178317713147652741742704829",
+        "4069187415913990179266103957934902108967308077870994085512049147450982557143",
+        "12579184886768227799223506528288234342796994370159705284700869739250351556788",
+        "622564717493987420916965985613040391216972216137048435919403560292401954284",
+        "10627265384428085405944701905265024404604418269584259390151317423616660374161",
+        "1",
+        "864901652872155634660415399948337546550876975798113377554498829871696472355",
+        "5663018614146207446343697212999621605425217453319805520829939328865770589362",
+        "11405639333955257411802406742215008016687897228308640680292790378070830141553",
+        "9812487442015774842444261704807794016482403939299389256977608073253672117004",
+        "7653601608832236071882240688065539692085316454715732344839480065461828571249",
+        "20212029977362219240289820021195324532619456866391617145201159860881001133598",
+        "2362607597233922011074304044831530080696724855559192154137352813392036975513"
+    );
+    // bits 138..140
+    m.Window(
+        "0",
+        "13292251513784204679728311976842681245471289697498404503828184959998848964673",
+        "16096461564138763786316399872718957716747208206622416245320611294326236805361",
+        "12524137668918407017678485644298416703374044942324376557889357479155860738247",
+        "19948230843829418355246103443595227435367503124820551044840689287625724875562",
+        "7122595887876191219571865862051748697504985197961821156499364239297238248609",
+        "3121934087738426580858245351436757357169668868595816133045496556501165839544",
+        "18464693839266989647629083442273991460138380769675466977956093770814596572751",
+        "1",
+        "5657472042636692585542089509213115110994625145613051048946009150864991939897",
+        "7095223579965327997708259606056868709666207120734925502485879996781159766571",
+        "11490114585484540707841478557427534251540420083980942737800686608922713380606",
+        "9247276207807186098590522850993885755610415270774481392426179992583777981762",
+        "871920567529067274656336309121066866408967071800687691336091776270568445307",
+        "4233313995297211557884380389476325722678759587794851195003737531083172818989",
+        "3919302104058803110885226810801631724561999110633797929778395400006558868864"
+    );
+    // bits 141..143
+    m.Window(
+        "0",
+        "18078587995639042845266278543819104576657603737679003135929933311007147677573",
+        "971999376842705805940748029607564871764541381709871005906969669216857534299",
+        "691435007636514793332511464909768683566892855196184936452760521548431360155",
+        "6503988821230857227882360121201717128604328948011914106783814796441717567363",
+        "2394745495516150138477278651015496899663730169081052067684821707256349806487",
+        "11727050181659133693296165815068574432218914584816817993046713647433908308652",
+        "20912265708145506852242695764174217894293516828584071001473458211028066797593",
+        "1",
+        "433783653657962300712169010630526283936413887729531785156686850494049833819",
+        "1952317639551332544376745605658965432816167254535632677476581217176411959730",
+        "15034398323375221373293340079433492604772331407698941264755570600879748616980",
+        "18990840910381322600740339257244736344859147300821318671164466855384495068597",
+        "15041444949442895222651240693723182505577468753471241027442868319002867611404",
+        "15289334710412635711247126306849720866413429605964427906427153481376125256588",
+        "3070455491292434993292355368264626262124342179543451551714519415346729007136"
+    );
+    // bits 144..146
+    m.Window(
+        "0",
+        "3942640364905314263134088693201010210915481499434836368887730592470021493008",
+        "2873203522003730597777818223641057376072307829568384488663915313705750436345",
+        "685644852222767191234147908375379095257080449000173873405555501243224314677",
+        "20748757235868345447544673787736069831104394608374369239391582504633992646118",
+        "11156200706821211751855514299565976300790936370730391448834889684556195556834",
+        "5406643208493648503850483464230016818137595306269599652275829714448246878005",
+        "17661755738556751841790314264202272086561821797435072837745242250057909925978",
+        "1",
+        "18017017411376140155542943054870752929167161027323856747511929810182885078540",
+        "21561960936704907769532345172918475484748509438847618719474478227066226274566",
+        "7841095880434798164722020121736480451297313593072303753885162743540118438908",
+        "5330960125712070605040396222638776137585375127307747592546715250089908824095",
+        "17352804527079827961486953334345915196497728875134803636891251402292405630663",
+        "7508681725233440573242381592688924488149758778470108277498610179183941496897",
+        "18111948600254614873806186701632899013455416250671912807054201259952945602358"
+    );
+    // bits 147..149
+    m.Window(
+        "0",
+        "20214133434410786988343308166107553632478373296605774872601512374950439311312",
+        "6902995848487401757361460475840319768682999140791970715415799548392379044176",
+        "2013984302058944515387280801042980570888414287510298389638061450805819056228",
+        "3663540440198001111532595785956193475765772308572456547686649209767661077313",
+        "13889886687007237995144161452505501269192127021801413950685107876963492440951",
+        "19203270463291403513395734714304422661278115146560656386516079547293629098829",
+        "5634420432354542798683065705713128415793196574000792147587767097135386428626",
+        "1",
+        "20440813314706907386994932442329737049680495595487269010465762304801898265557",
+        "13971981709322897375518975346533168038386160750033449815505979864771759008466",
+        "6707660022464058734515127027758131326006322543993769345461241401656751750818",
+        "20203912468906281573941419973661579539795287386924854547173017921989782861923",
+        "6236025215676593902736509641413576611476612546960284377715034893472631260306",
+        "18828266825895982039620043485686269485611668187116284306079429464605992592169",
+        "13784715033342105051104943582645851650868731870843277448913277071755988064423"
+    );
+    // bits 150..152
+    m.Window(
+        "0",
+        "16087571668586716177164188637215701937407761250094686726412385171029950523917",
+        "9300651692843398247405776033902350098147129364098244165782875542412036699432",
+        "13457671956920607417671235902925331678362534845256242611766576507184846486334",
+        "18756421728711809326541662244313168532863409376729692175835102632551058796160",
+        "8090542637582124132526536190839010872461281657828382077125895403622466897919",
+        "16202056970972125049546397536102243551138770060265320860376859385680111126470",
+        "20500444263014943427081702093996943688979102992910255241635838976431405994138",
+        "1",
+        "18791981151660865223651703283334510711889789682210730939212452769105974133274",
+        "13593974147234101153452287046707643242006180056535539949759797082695638090614",
+        "10405348803869033655489807091992238182692878474416779473398689494308240361828",
+        "8217270997241278154546227574233276004066731697374950641033473435041021404493",
+        "3233149859031014693999927615124719864367578101262870272825136115921658568289",
+        "4276834768469606047676885611786679463776026977804249614196994735105224731573",
+        "14828283533783481892044277482223265490429058874740826312567800373840460506360"
+    );
+    // bits 153..155
+    m.Window(
+        "0",
+        "7919596744979066433880443329331579033210883366934125137907710139950675508745",
+        "21057126966090974515726654511528093595326782961719662602185090435600119012422",
+        "10876766257809266988530637958029263943268096550078103255341602803018833426252",
+        "2659397599719577901836176513122803731295731113953685397548547597945370008501",
+        "5475477179464494631584683014024555017766132841902100592885084174732813735001",
+        "3647707064181175802395774501914458789184245104814724619919821439509411843898",
+        "20265740830738737908896818310083272481658175054815980769978238984484390298320",
+        "1",
+        "12192743673107462688029196994354021993143253823689207093730372712866251672228",
+        "2397192929943775705704034520464331497473266373953052762714833002044264451508",
+        "6940414232825087029424362888803432167760499483831632194766100129904597813779",
+        "14807851379589828535560738628417280762726722210536398205235334202060943804768",
+        "9186745967360451024561834660299639186900943983883554281511333126735241934538",
+        "3210192936054801593352527334588365178076080113611742220484774705045932315969",
+        "1210508863825044487904542263919367596257308252587325160459334420974524152875"
+    );
+    // bits 156..158
+    m.Window(
+        "0",
+        "19714425413448256436270625917186595989949621892068444574696640461775450118243",
+        "1945180360738686733827310324148581222833589520266107026478654434278223418132",
+        "10359387958776883915839895256425546615462120554594324214658010052537337059853",
+        "7993015071965337688612577875197734205768942106427738802172227155345498501379",
+        "11081710709738285360826492239231671881411430724684296473195000963958122869831",
+        "13446139563157347489943732827592144896053772428650693658855639723352440100779",
+        "19498546991012061706482757299498944116655040684731961613750271930397348377168",
+        "1",
+        "19521992621632526881005228567671133303429130442290493747954402061353138784065",
+        "7668574154598364807656757387551810991139514511037353763600703711320259828601",
+        "4674981816014266665661322989297647108193282297751413143756604313225970560286",
+        "12322233490939020823789386945409712221971527379203470152004806756990188479854",
+        "8874888811713915281706666799777048942578211017333792760902712927966548137138",
+        "6809576539925922947776251182607042722171272989212948120054036101070714201961",
+        "11146771147760810503519515630757277665148312118334189471629099235214044059579"
+    );
+    // bits 159..161
+    m.Window(
+        "0",
+        "17956650350345346971138977829377963933376730508302742369581836170197314656956",
+        "17832573847650214406920365064811324664880902283917194092834109207713191814139",
+        "2860714773401253203085906564603797411926446237734473580277838429401793535406",
+        "3105910163804607644891245715861502924094630495286383892538172143787421351966",
+        "7902454317276227821824172833669891505967441271397132957717642944724172619431",
+        "21770310807276914701834858143882789504756214619851533528735612317223438529827",
+        "13038022306934568304516966348741381720813764273177284637100130672104885275499",
+        "1",
+        "20769645164507719936138478504682312330595270787493978236318437393588567510950",
+        "15028307989854508826950035631060242035909150449380776747282653874910632018840",
+        "13324899104525828771995364261679970917822618780317764897327967281284824292112",
+        "20367203226271157411685806313705295143180981546200139617619344407585166696372",
+        "1686798521219649023829194938485242399290173372010718417235691687249993534717",
+        "7444208831654623636781375860977716478494893688470505360568354271118592262256",
+        "16152748332186523417495545722374729105584033688569879302038326221747992851487"
+    );
+    // bits 162..164
+    m.Window(
+        "0",
+        "15759134233466714291335441163128030314941164897469832158606612526162200490536",
+        "6710104337961521721571549697151135926602288348039444224735039791906369983373",
+        "14608788313231510117172203299582713747445203636609185038372895437839348406065",
+        "20946641049708578016319856272172977547140960466257403397380867145248258653516",
+        "11863605856196183879061294729810792003059973026570434892003422010491071594066",
+        "18285265929098986618152233563450421372752671162251070396496107098735712158246",
+        "19069304530202454311643068609993082302220951766683600344553118756640184649579",
+        "1",
+        "10593574770473729786735109968549312993348592760534824691431855111607054634058",
+        "145447008361265953002828279555443789078442833508824950678161403034507312357",
+        "15756929544452105766194460765355489407300382923220688452898091150115568832675",
+        "2260412488400389493846297982105253911562780727235869984579558727893158012353",
+        "18582938027356169206640124984287803714758471366341211891826252342354149385646",
+        "2706201850888122139662742476611005467395450252988280896953142505209143885121",
+        "13936390401146657026927025252863767505701329157956641776003109582955653963853"
+    );
+    // bits 165..167
+    m.Window(
+        "0",
+        "14311283168062922286002996311566952225517459596749536390347472455743622228023",
+        "21667696622031295117456058752926369941447682286909084742535134385547194299910",
+        "14927796676585964094835099663398126091325047856875482264808052322506859746165",
+        "12820418760107777980993531675953754030719879496717243895614179600077600836095",
+        "9182441525619332066071831755641931096709228310446464792387680792246060563426",
+        "21819782161224705447202496306570354289598810255359757899518529735416093887888",
+        "15378994068075023216463991639222172273252495595854477927505094057437382811942",
+        "1",
+        "10854962729032266920365552285267984725147417429595998891921959090276035848136",
+        "1448534544892662153889868964088925308473112781387627351585829428193196191232",
+        "19017215733238025079778928272296245322689577555152616491587208569630962673770",
+        "12645171810661173919305098814413820086200714019135035337719448793612431116848",
+        "11840418248368402988481140438105328856419468103536867059725418397268295340231",
+        "17366514896826413744668906485996698981880124935119263517073434361798357166213",
+        "16269656664104682149712746370378055913737245243356902163371296669957802372412"
+    );
+    // bits 168..170
+    m.Window(
+        "0",
+        "19324878011497297838085837584405195701265359513869322488390798241703610348430",
+        "9594905001421447329467713825512663410107371436568618312733926796176097128016",
+        "7581346270503539077228994719192408968910220605176298489599384650940314419830",
+        "21156634623941570312543141180376706611820294735524616840098479777873047914486",
+        "15507136366332026377947445503125623252778398814262054909703091893150977139066",
+        "3401225594682714332959918539235488962624019310907035256999017260105070791226",
+        "5537383793123369883063800781825401675113739964425167226150329587286250294764",
+        "1",
+        "14253451451861702904179223846473230156777765841495663459945620141167354193901",
+        "13650715148341055955544374277916039050382899960084033015112956091453895394592",
+        "10917397773412741428338511519297067910210475614605135947500550838315351355428",
+        "14278447206160592504576861337045909856922736517792320961142605009509481539076",
+        "3588903634485789634845222623183896454260079582713266477410971926555869602313",
+        "19117299195157106860562346014799512253362880821442319660341929718615839670712",
+        "8875263043234293704674408097238532059063243948926330404281606960410556487169"
+    );
+    // bits 171..173
+    m.Window(
+        "0",
+        "12279991469293970836324810704887287738214658290706264188431884481985279868257",
+        "18109820537509628013544845040636137613157599986098407188911716734596105474889",
+        "2332768549174793548595643394582855971104976775225842987447607145967994253535",
+        "14515792885039363928685403180388500670176852488814904191176292452454370776256",
+        "20710017923732511343738869606670336981598963563215536587276079157058353902506",
+        "545915928896813969195028402324648545208538507396800230209525031835775641202",
+        "14648420289610178908906599442494199457987929072520555730485393156281269656399",
+        "1",
+        "4835594873250599049802938058659959675850427600233348490782165743934367500920",
+        "7570593150327132517082519221781604935395013814284138201478599554072494128255",
+        "14404950809593716807011487969646355012631717787824398681626619296272548979641",
+        "12584115283538843031164139134102187779433099697039236033079549279918567994801",
+        "5250101124227068671273648810928234261959057679026015406784719444656158340133",
+        "12366083647031000713019727499417930534371103311536231921346137487541993683215",
+        "754168090531844443241066363375095556975671091747913739570478934923642512566"
+    );
+    // bits 174..176
+    m.Window(
+        "0",
+        "16902128808329164585466410168727766100377880496971275859710873142053314153737",
+        "9486793511426521429385539541725507627068052724054627773121863789123808037657",
+        "21632340580321845468373215367874747455879841182974162071332309208445381200464",
+        "3865106370513697642445135581554793317341448120833695161623853645516209892850",
+        "2877500479427595019134289704300588122469218508294274334975015654668664388086",
+        "17398812090932188756842638133762555625177345764857374239908808619246127325898",
+        "18819704644579385997922448676942725779048901716859998642089870201722987764540",
+        "1",
+        "253398144512666199685236700442081333627507762851499327195880063728161330969",
+        "6777868069115964920260403841188059851710927376044216538465464879610985806181",
+        "2077567125178268844641978053858232427162195685676989408507471121346486636966",
+        "141202996790423611215439268472529114665165921027441772194517341042851522718",
+        "14318290838158213994419725109432360735056669873059294434642992791677279908403",
+        "15334945376547870576942487660394741791840842638918921762803366259369005329385",
+        "847863229304290044565943079663796425269557575175008611282104895788570904256"
+    );
+    // bits 177..179
+    m.Window(
+        "0",
+        "16026086789296048661946694333331282153340119280294515316625929316099363591468",
+        "8272252355496153070375600507297503341818164489707282779826686103887426394266",
+        "12467491044616599929184893450915739786175241068011587445334196873985937996685",
+        "14616258890795804180093683085849899902550428795099517385818408985367260844800",
+        "9818888820220219798802163951628397432841327051423719431347905330419129966850",
+        "1473648329998726128502020664628168711395355821402556515526210368302014650196",
+        "15883256179917833627808288593445415584319832559318280048136592462130946647036",
+        "1",
+        "8281747946839150983953109661394279915838622797671296100372236110312010502006",
+        "13291522031328964133111809729266014850225809262102219857118535637691498000423",
+        "4081620893507143071927743828575566489982087308840698516818298638061305385939",
+        "467062466373395183480590994299875912263352378193588542033073872269611397760",
+        "9224978321093572134023084001032360761449040797367662642364583696494702162625",
+        "9951995059580844396577620151947339165918270976315658189327784553533070334337",
+        "4594358513908981119713718650784343536301726100078046300042582787487884149411"
+    );
+    // bits 180..182
+    m.Window(
+        "0",
+        "12354755047119208278074922674420704753354797064979596665336639467285955827863",
+        "12562753277141579278135994519095653496433818046731990218640601454950882151688",
+        "6042924538357531156369535756496212249914900482393653253742180738182472360706",
+        "20671353404449008551829232670517903144789423342935869552974460273102406919148",
+        "3488581380991476999343084408219507880012265429247146521183904923902001146929",
+        "17013020287832814209582668392193583561683404107092074511491712337474628062643",
+        "6325377396255916115405189757032823764132971779389465071534146722924108418766",
+        "1",
+        "8530506158974351692563966292922217971141565219415853979583777697211862951159",
+        "14599004868433034303972862582910265388238406268822232382751177189346372693352",
+        "14126149595311529333051801835754236523582021020248751293042174501839519719737",
+        "5857248543216914486123605098290333724460980855062064659729668602478874326177",
+        "10674204404979668691980421259552947408053941338586340975806165469126061328675",
+        "14404422025665474883567946710285146670863463641831326088494746561740127881680",
+        "15449569655531997603118200086778547545914421201072880151858410479875109172472"
+    );
+    // bits 183..185
+    m.Window(
+        "0",
+        "21026910499498137571917458075591786887261522479165824075752596259910530682839",
+        "15868362509547698248962879670842530709576605856240688694653007075232475888163",
+        "17830957946516331177179079438153717215837800855784065287222412526882169274649",
+        "19947034467359050966504424142076995194645383567965264172778372399637698088664",
+        "1066030711641834168475182311125684331905357616799417442335887485475678082842",
+        "21093108526829403071190365607008216483663459321276794369696304928569659625520",
+        "16119566924543295044371807887099616516575630690453722302725121790508517711971",
+        "1",
+        "12942077288700699485022811417492381801100880733270449701440605741858265735862",
+        "19067762653888688245560216701698559564080662400057918181472999978545431288330",
+        "19025850255538872059248103530217920251374984273202800649626974822103063879277",
+        "20518701832889031391620160662590243499413987461379157740773871562772141774746",
+        "15221124686452032640222326535897192996902459165911548796624438748732241005449",
+        "2276384069188978012704897490220578896907965349033192210367384215646089201730",
+        "360870433667904401602242329127974131323132628330046632690736970693267913442"
+    );
+    // bits 186..188
+    m.Window(
+        "0",
+        "12853890557274341420193726186245178222491095767191340297474489359725367407259",
+        "1667210290082521111052370325860671761316917944097750706780308729438865841705",
+        "4923364921594844689362078093545484205098204813480820127049302505487137441922",
+        "6034041747487870421349910926119768201264036337462952160635576003451337733086",
+        "20821718416791445030648450994547323074058505905967086905076716352530441389919",
+        "19746045176085277099955987007424426158387778984342604854374143675993933261373",
+        "3032148695563134398165242778019717458931578075198271842079697958993703338141",
+        "1",
+        "4012164650668920106633199655336653542168274760483159725871864874908548808886",
+        "4186681720036987874796963782400922329261151087689700333313852727545263822448",
+        "8897706573270654325425774375954395177722097252435968359481097293584896045100",
+        "4976609209745464085117713053029727252309660332932791902822051822029589034245",
+        "19676201013898535843805245425849509512035757785560374143111933103530162492960",
+        "11844902563195586979583232000453883214873674309884910432371542842770972808689",
+        "240261114806001049494953965929557437570309151501849246915603838841906903705"
+    );
+    // bits 189..191
+    m.Window(
+        "0",
+        "9565933528458921713979499421139137970927902031849667102685285938238077249012",
+        "4665612624541174650892577348116638270419234278301672403490255484076727671917",
+        "16771941377692823418686096717759871068287503361612729575379702740636379123996",
+        "16626302884075457524130192163294492480504562895249527301125214215280566794644",
+        "11550620020802928985674182230507351680547313030578148453452426175015492868103",
+        "3855773442951846502289160104142249229488711186297522918583011556335357360892",
+        "20514594343703071099617350647585853238717529677211146401249744539140584572487",
+        "1",
+        "5111787792287118033749423257776565291186605061650395011469453239025033545836",
+        "2708779711680449316373998420060384690929423097669418122091271901354054565966",
+        "12330468223948078006353719759927226028330277407589397809347808386310664050978",
+        "21414474327158385392150188147574225137187648489711250448548395500127457992593",
+        "15709274179259882848460099775157713341636687547137364738069216687521502450252",
+        "433823963873359368536005362148413096597313218607277741323779836211201542214",
+        "12129377088518004913293424738909055078627616379641537399984179589239613568034"
+    );
+    // bits 192..194
+    m.Window(
+        "0",
+        "3705748894728097837204393961270869529851801919083195621279801862077192033000",
+        "5667597917070318833680071322792015540303313239690352831423637856910707503400",
+        "20720157629975306971326587006312735004859270490130526820389833793995530394872",
+        "1863862801816364256770257484169791113958455358517637286782498738780013588520",
+        "6875862631835243825043496580781539304104849685709868576494271424380241791022",
+        "6342311527533150295415534901165499794610844237119813567806288038558398497942",
+        "15745244104471709761207803988039746789692742637567909198691405904124699909633",
+        "1",
+        "102290427861389392717804922119629308109793629901400883474787996162414356217",
+        "12407027708714783103382847080620937113860766170001335755889251116300298024982",
+        "4689822909285644785367733478797918265681958292009504455930614309079634238398",
+        "21365548713519610139911256874813893901221821988470404948880079673443901145868",
+        "11603137006643116675620555138610066304699094888420700806671713733941059090724",
+        "2182608756009617482221400269196079016176745010820217511525372960658791867633",
+        "11938675158529966641631156410201099738707758821039224681686906889959599722867"
+    );
+    // bits 195..197
+    m.Window(
+        "0",
+        "21329919605547106129398282245272508478408338039725901356752579780977768352744",
+        "5339250354565540983624337888398624895091415784107032249113187710932423440951",
+        "8858481368293623550228919852070992525286577911877763544532333049818538855222",
+        "11045053094309175760800868426410139183715587621699082107463419844970604579604",
+        "18089624137087695649674575327077243440431513101324894471703073942285265587796",
+        "20225833674313130298841364302789726721251980340839811971594690939142901622928",
+        "19744775347708065747253617248984522959437191580868042585266904387246922457813",
+        "1",
+        "20667151460668904833281776150948027487771554026470184158852907970887283414103",
+        "7464388092530550777263181394200023196702615084309628546630983743032802709300",
+        "16144555759144522941843479799801302794252364856892026807569223073308920976971",
+        "863980324334998336320021431769325287050395171620327236891443158482033277064",
+        "21071354943618875895394626884877558721909989603705067309234304624418800761015",
+        "19041169376238906997706942112894527386858019135864640773090894846540362413251",
+        "1164685106081986707080817242144549976821441422704466321244878581961097570570"
+    );
+    // bits 198..200
+    m.Window(
+        "0",
+        "21636255170395997639969691006876856732203174042557194931457822536780962774221",
+        "16905194542111300796394613305726519084754924680475523473368144762489007204534",
+        "20377146822318912808508854700357952444519364315288265179735169518097828633699",
+        "5724625655608868645689535268422070084543995927732212059724113152068754891373",
+        "7636175594970018491774822212560329033781500399000338641335904584874356788768",
+        "5573760841853996600189946029433596204061591291574198863788109821439091882616",
+        "14776443669920713485784355294182635502087664340548990155932802851874435901049",
+        "1",
+        "6456265092174412691557917179308794433358382742351655931853812609352749911813",
+        "8234497811415585671483390063627601200375201363173799221180667840632232536862",
+        "6117449735804027550371576716501101905008710755199409821941106634307472034422",
+        "10308923700401579816603597606813811960552754413890927913080984195249222032506",
+        "15252128925286703495163019550240611426017131935055506958506147612678394081941",
+        "18488300999725599369556667066183849047198443515891457801549507205390290898542",
+        "678783513213334232012937954512807656731988342224667286508555402979017292062"
+    );
+    // bits 201..203
+    m.Window(
+        "0",
+        "6415199545995144128192406980577729592136453757690453917738278191932962989241",
+        "10708527891671357989133513830177661867514487421458583395074312146641705056046",
+        "6672062763091181917631310361793890507430780190594479910651023491406335174854",
+        "5757875670161352627628877854573399900889439086113153488345671257370967211755",
+        "18782906028895862177028432840075884487319708643770594298540967032202091435706",
+        "16490878313115801524931781582435117990195013305048928279588629512761028205312",
+        "17104365458867625746842761103936698027699612895914006457525253923392751648732",
+        "1",
+        "508732211478975231120557164369310333917472569034838519214664665624413625135",
+        "9044810538568980521490533209832115329351009697707715597283200503770073952858",
+        "6570486891290591115592915230888088442797887665136580106868796767164103233540",
+        "4074736026485790805367892850935365987164840374605213452438286346088530162345",
+        "10334723697431739263623984229500831472171091872065660872684068941939262514503",
+        "4587251896240934061394313671102547068369042398081804634692251916270106329050",
+        "8400074143444680149787438060737380787285567640788924353174242955732927059916"
+    );
+    // bits 204..206
+    m.Window(
+        "0",
+        "11477257176508053191844082102665264382942512018934412629972361503731082169603",
+        "21653993229114152964668356325524493144558341291007205484088426394699534938777",
+        "21019228166407654905490898225660902232980835089452170248869786111794131684309",
+        "4737671142346544996302872283273888653417391805451983548313655498309021638478",
+        "7503785246625280989688922986724331551345637931428983217501836743715619375178",
+        "19160651591527687736825422644228018088547292776256475407281704774504964147909",
+        "1932392503197393958007987880976687531103967266383983427077113624250850452027",
+        "1",
+        "3888668753532157817137219333721384953051891377388398518492577491257839400140",
+        "19103728899212132655338366285953424145997704616740238581044733288360967243038",
+        "16452676600737544471471251417462850898395694676529993943399673887119060298498",
+        "4904946739366063286149240163440193038814789564669395489332548846853829580572",
+        "20125823604216499177775153127438495772405394583992886550423277445111367069865",
+        "13476694470621644412897391949201096424867906258513697833988761389650288577217",
+        "8993220180902891363540544362390109529366886524953511045750200883745065109708"
+    );
+    // bits 207..209
+    m.Window(
+        "0",
+        "19723630415461250765078307643596431268497020766308850443746812137513180793677",
+        "6826149046257472318758150162702356721489789010159715178302315568677119043",
+        "5598637320931417052904321548238847339180152912301204033894742435900283206230",
+        "4525239687238791599400641157621520614013452373006774239880828140246069217494",
+        "411529165307359035161664219941635127772457557071253047639066883426992895126",
+        "14289580322131286766710428031123924723500530394598284935314127041383570100446",
+        "12006930466986556372775941988543318356632239354042130258663525478895809559464",
+        "1",
+        "16863754499016433428266370531400309877110010842792208512122181387423690693579",
+        "5590060906243811642192361782866454364469663905287293782868420695781348851987",
+        "15280165615265634693098940498551529510750086565237137354137795602844224805174",
+        "8852384089944014379472917644588382108833284912886421215416200584047666321985",
+        "1353025734938105710411384700842514033304301558572293128593514886409634261527",
+        "2727662212053032880191067966371830919946975641090681048922836577355086197484",
+        "4025063055890443550186029922298090490757797690311195191250027071931859743452"
+    );
+    // bits 210..212
+    m.Window(
+        "0",
+        "15084391058222517623188742111009884980109733210118995681928289547023824364735",
+        "11439422426070754712254427092043863259326999834139544367950985434370911691762",
+        "7517665268698774223039602022919103680084339020109223720928132362699413000639",
+        "12345921871604312772096478994182638536478440759476115432022451208294262161679",
+        "3491889020819502132024292023976433946510522085432279844043863164672130062398",
+        "14617265555955081583355576188918565082385381131903885711598712130533865002595",
+        "20296674919678160554007919670337916437864456149883988751939497492462999201566",
+        "1",
+        "20673475563890900547831743556008288040197768889350131714304493990343640712104",
+        "18933337903020033947828363568302275259360954458986035575923273645970669358899",
+        "2537280884737870766907607179669302095603540543311001708955002142952120824322",
+        "11103900768297349509880152396036264655361074356920569058234067528342513443473",
+        "18293495016280646406647952670025163179915990230653581162482749788693786621193",
+        "12978666294905217446618764857820920118937013591982818392731558909863055540439",
+        "17959795452384183471824887362282739435517110287468111258876265709298178842969"
+    );
+    // bits 213..215
+    m.Window(
+        "0",
+        "6550588973810015181715624100374852812372677550393773058589051646760160756317",
+        "20816938872213376368762275119088965404305318078648320078557382967478043356418",
+        "11496484531951132941293737517470121774853422220955681563511369772497281146234",
+        "11404009316188164897826411490190834723509794297179688279179243499662416672722",
+        "11099389344287708615479984262995640942401131136967369758518328830469579471014",
+        "19716612872854939690746827621288689054394550208880166767736867069201384017952",
+        "10535713399019990908646813969352488588466090551375623842127210972222139050146",
+        "1",
+        "15697325923610978679943932694483361775427927876365150333581552542737389187368",
+        "20474602590200558786601154519593804186614595283876421080985367874368749830682",
+        "16948492263164110070989544643996840081889351046797287260784890427330469751573",
+        "14807397269781016576706665513177691518668899754380034239254202264901761693357",
+        "3161273990806437044947920288513525046079476864375710128344930826737781580668",
+        "17124015506070284617327748384088860349909391327032071516070415375857528635190",
+        "20483683016286663741263286129831146213588397677934102859816326186013443470242"
+    );
+    // bits 216..218
+    m.Window(
+        "0",
+        "2632946016263195398547888841760246345102686124228422389698390520596019228098",
+        "16305151008866555107525263521465115946896858668603590338356083667154979597659",
+        "21139941817420975044560066310918598419180738805659752331083338795894841928269",
+        "6133519501913028371777857122105899713211833378448012368236975538521298277881",
+        "6963746333110055603908778035291822510828447970129329871356861211232554283751",
+        "1720178717625979122200328483873595540815292060255991371927957963183180341116",
+        "4745533470033334620426169542786233953772945053056030844976148435631604520116",
+        "1",
+        "11884734304562612233406023626992523413465681385143113327867825354026307046149",
+        "18784479509196042287904586335690285170945506956881740729422419673864126946131",
+        "17912585668454943423176479120255606221010875486374630526951409066062591167992",
+        "18239340960929595164666305522005735598352936251648315039082448139194283862318",
+        "17694993609881412726458249499312971796653781980991501786606889969351572888947",
+        "10594650702364130113389666469228406768354372004920634776368807327387790137162",
+        "14646942481532764833752316988597725618515652355248978350155574565057330861232"
+    );
+    // bits 219..221
+    m.Window(
+        "0",
+        "11102700140878249447613260017808748050398523591189597434759697121811102122817",
+        "17261171471750689430076443525127138496769237135133787192236071830616075213204",
+        "18029288583957552844165635602927481489892423982909290358530661157096187672675",
+        "10696291362639886158899982788827669729427734198596017471691766441725145258966",
+        "15109520686347528066799758034811735801531243874305145895717718196515388539401",
+        "16007655599737604400522389167513855813162695314479326601222029371274690380943",
+        "12561159257407851285683990580169611775344372391027042171973921124479809604564",
+        "1",
+        "18178142932948360555711234223812569077429903612243747300877226965791834009411",
+        "17269325333093496200432897943461707824817255226757270857641558624201045522714",
+        "3849451775860000388763344247828983623571194017704854475671638458560995090354",
+        "13239762714081467371289873127410192035639196756196091493436725532575859370619",
+        "5242567181597463305537327481216734660934487655175690611894749975869391514797",
+        "7637096678272592020207396166723710037220056709322907315255594618837861285484",
+        "14165688539513956984429632201883407910143001575758417676441635562291827505595"
+    );
+    // bits 222..224
+    m.Window(
+        "0",
+        "17064290401144974550289576966465669248298727554708733574685800159318520510895",
+        "1351989364744702047808405121356218573358896800528516473895699016149947790453",
+        "20981255373180120766870224178467551539554138286900093822218778897500733224345",
+        "18456645900957154843786848802504288387321034796596551991238651908448595835462",
+        "2650337306181227510437948967168860750231731610064367466237178791610991932136",
+        "19296462676213338231736187449987819117670836006299978516217790205275978383058",
+        "1587359533896587057203625304702479401638769952728713445979332342207049119758",
+        "1",
+        "5477440375418908257522321121715516512260174701139180806634239654672368978927",
+        "16265441513554435832262538580668280438082287796205562262243109198013255448681",
+        "3723243569521851390272143624520876658912984523227446070356854241140405203368",
+        "10649305757300261149501955182354265319084577328219935046341945437983778496205",
+        "6274748034385653950978004977741311343117367156437288031220872827865927105021",
+        "11021334234972634975130654392991891978586662572144814620208342859253074354548",
+        "2413693957308058315807273230763845315117426015938053068725307799549413963281"
+    );
+    // bits 225..227
+    m.Window(
+        "0",
+        "267214382286628971399537655941431308198400996259133005716543464115537893211",
+        "3153810280694673653775355511032882350468833500929747447514015136526674143839",
+        "13517499779869591615111079823552459445496691226538617512679507525671551601527",
+        "8360146156083222760376925987216922020816822003262768889402572998368994351553",
+        "14031108559979327927097994238015458362215554472648912477504619098926415614254",
+        "8522811137895019426329956301753066032971191122261409253940405426309708214729",
+        "2742000542715497651999861579190543786950353664715027398865749742420762033043",
+        "1",
+        "16674455456252435884502495533129492356969191873550269187167059230303548976833",
+        "15858245573315742409711645453795138685924344787621995467077107467552357285706",
+        "21674300329262169473850317351290767522083230849947063699972739042035100877204",
+        "7123849381894495843470941508032044746475185308487618299523661064281621590513",
+        "18047065956972304930451524767668127890260285293924746506191437452747332160972",
+        "14110889448303840317590830770703485484969288555210920105193672199067654915138",
+        "323791396213467258847345050310849664990458268957959841404592607133003562294"
+    );
+    // bits 228..230
+    m.Window(
+        "0",
+        "17936829959895908229127760462426488752610331519841722287353102191117197395699",
+        "15651721469404208777536888616019206836240326941839730116722789839883705706896",
+        "20116778959773919676346891660465572575719193116749080245066715540298035548771",
+        "12129618786017794222046411167813685027784362917159164101925010131916039535809",
+        "92745103634820295986883598337211986504962898350734947296581852428594971313",
+        "20823326109349852095886081677599000071701529356539448972278516756734794212393",
+        "2516487881120425901648141244381386911572824240776516837698236920125083130862",
+        "1",
+        "9349564834305991032726128899569098725855655706319304065823631645601555511525",
+        "17991528325060672439723056971567779596992270625858547626253969112700353993729",
+        "15766222725302513909901785177062052232822885567675090315495851391003922749293",
+        "4625860008076069820579528959194868531240038385980209936023636743834792601337",
+        "9509494835181006383818176831643149559634499085394719842723322936428096565081",
+        "3806672391108868202080561418206981804666492996294967743320883435917215563077",
+        "17411247435227526717217532449080631962858701933610165490815152669949867682265"
+    );
+    // bits 231..233
+    m.Window(
+        "0",
+        "9988127771503980439604075976946755137019850580096159393787449524892310275569",
+        "10200040740023897506276667839279347711831838584474855445093088844455619430900",
+        "6119118827522685677944808383217979671448182965812128889593423229440042079341",
+        "15628916762983777324748152347179000809611244211222578888182891962604607908556",
+        "17425034426202739259211856992285268189021856505990963828535271965648684444617",
+        "11497439251994024322666624659691272555803770173363239600941641135774834814587",
+        "14449605008388305066676440691229010526728971929219612274745756335216696968096",
+        "1",
+        "2552623156220062235275289092773405250358207373164467836096105561321728735374",
+        "8541013504708003526960107274778590638432595536873828476168361749770617050092",
+        "10806692345206326335127168040498567333051571978999483557907552251898542992413",
+        "7803492202838832096616633861709985095100722097395790284961387366654439009715",
+        "3518977391550998913049066495750892552468022658960527348168850477478755374650",
+        "1155832789382311136413270840605297877826393881805559047050824098986702274153",
+        "20381689516937688546948924571938534020107207922323448492389616009029251302269"
+    );
+    // bits 234..236
+    m.Window(
+        "0",
+        "18667282379215974520779105820819117791655037453958838761324157632577287066687",
+        "1443695812121085597226302620410922737987943769125389302266234344473301467144",
+        "9346042332506626932592369085886303374040798370553740324226714015575483731265",
+        "7639883602969203993843880205942915138859218883144004722833372361118783035123",
+        "8613139328367970665908026101987529013863027273581013777428897341402918844991",
+        "9189796395928395162085257060448540002989156563185778103499531561492902760203",
+        "7828962935880779433334363700715997738331721363247944307992336564788634734884",
+        "1",
+        "15187431086367736491324177208478285126445640035699175833678143349949363742985",
+        "9906824484671303755131602868292337197677610515031271387244041948952419971465",
+        "12343623592787595736816459598209906595484254111306035038641345658062895840923",
+        "13695878519736308628153958420177201326172354088839501898642431855436607634132",
+        "20318875122493320707701501136135966669428326673498690278175157071481686200277",
+        "13974193913772220048877195024537071002126607141330639008482769135983182186415",
+        "14254766716002171809509968503728746261243239300374119600333060250853729521499"
+    );
+    // bits 237..239
+    m.Window(
+        "0",
+        "16334320188735612564997669446071055414383249952747412747584054440536134403459",
+        "4395954441067162227912936997551677805169123264127653263394598068507735100955",
+        "3559182895096457961269492220209735592637029123151180724175561629618834726424",
+        "491896894915771632463198774729895436238778145705583036377211876050734417437",
+        "10972317593605854529177476022536858458589012756634009187200891333697241536221",
+        "17499984635449911191008255788741358722580117869724965579396565990098368526987",
+        "15501877173080881192266999508389416326079531862404460639891325749559937809149",
+        "1",
+        "4287098819158178198081383788935109561770479053053250875120754150495649850907",
+        "10531058705679276005296511148271576132213050292943602657199464509407065433934",
+        "18164606483568345260573726680882057270049128933060504020669068414518229621770",
+        "12792704157860871723088608963288815261065543401616700743082174321559448515661",
+        "13011226877493130531525297688903524773205241466549003736773578226336142668046",
+        "8610922813255115045509997264207683764121447894296970901592448221569931258084",
+        "14808532947625158543492078617158565843497591655767970529345766539204177671684"
+    );
+    // bits 240..242
+    m.Window(
+        "0",
+        "15884465147355431597872978755952287417457997701239076301792562582211716349893",
+        "11277074276903309996913681295651202915098754224015622918120761473925641497077",
+        "2044100239351813292837859973099251343969695984657194303917794304397534142058",
+        "19917287942850200989795103912531661919899283562997757811308901676845000940174",
+        "16601346397889683303032658095722201930906884434430231958504268955526493015550",
+        "9453986924297569174863523498390919378485395526866199483511604749076962186006",
+        "5204580364738218163970795552286992569801101086030210529564920057004583856862",
+        "1",
+        "6425369991486593535757320685100201164481826335205559545199785136805279410576",
+        "14130875911183800312997334715449078883995501007988238827587595837702221716360",
+        "7066225651262785995182237687186368664558571487183781979566203271264047113872",
+        "21782661812150097054758994165076218692216420112595512981403181329617888716171",
+        "20146361955102525796882209271889736184651235257336799125030129318139453409722",
+        "14537525224824774109939908211540538431180475468492592058123203213734533061445",
+        "1362710323060606346251366959246817016351843333149303642007389820806337191101"
+    );
+    // bits 243..245
+    m.Window(
+        "0",
+        "13591278656580725974538809093652579734041530065580939399910303884508677349338",
+        "437830350418612079113607070238477979311366620337428438334977540233370165408",
+        "3649601754569774400715108597164008917913152033404099563162718154247420856985",
+        "17859157829712061478840401852099123448321350344410326845302536173845978282979",
+        "1132843560562544218857116817794970799620041626112169749925909053425872286408",
+        "10116207173253401594178929939037748800137705700346371989510389985446350929556",
+        "20531596910718001213774393908302967645515048687273206839784590548520538213645",
+        "1",
+        "16892921154637577666617950030076240898792682863520349289375519205384829409979",
+        "15860893515322495944486437168460217407094757880116893981531544806176576049133",
+        "15843155346910154961630545809353190156633490144468948712772448483314408735074",
+        "12386963392264417545944613845371941172467729634418090245338233940428408076450",
+        "5835360246637431887334820401620039763604152822988152534004925541243749342524",
+        "3419499995916208830448785553805452657465786242529644005871352705092169556952",
+        "890089368375190326304818319535662174618299086597699074212795094233790662468"
+    );
+    // bits 246..248
+    m.Window(
+        "0",
+        "8448361671856611094368094893873528300213448016874278049008935486981108396466",
+        "656664048562521973466419256715499020845725485662946447370378703096238650872",
+        "11530252776670095891229043769243782036128827736729905050010244553287852467349",
+        "6627039242741567253720108977807967903640237853660963235862267660302275149970",
+        "21282417049542896503661728726662528241573391427203360302691577819961036512619",
+        "8654255034006407804342152990726855303331031428163260039933425084112109753922",
+        "17538750373956391908036933780953493110084834927845290353418226428467628377269",
+        "1",
+        "3719130040286663224590128240427185068966755285258175280098621282171226423212",
+        "1233483711299226689843291173597276405126073556217603037694946776191569791630",
+        "16663082714756558227951191695196960935868956362650243506107798295865190634465",
+        "10297314759674437170693296998290212191303882453090853125630851749220298986542",
+        "5885004558718098861425049544605294430677461546372048114287489392750387639448",
+        "1261330051041859540176816089298555908146358932949450927930707568196998907118",
+        "19459592827692480887410736248105188606660670483173435087606329497506439103861"
+    );
+    // bits 249..251
+    m.Window(
+        "0",
+        "19770875486055357231464976665155595723245424221724704572412615515366030800948",
+        "13954438557671558111989431802538312830703752934913127401738198249543007519536",
+        "10075994822183359431932716587482301666449250614971756606815494870173163320650",
+        "8655053728553930580635932803450054562699969735613599472553519062460921774421",
+        "16263644202500179989877859874177793572165253626302701463320114022385072039882",
+        "7625998280562620400488288111366728025276860013306545151086290006090348515745",
+        "2716611712639369573046441160017619644997385464771851172092165445504227441414",
+        "1",
+        "11426680139972549304394780604480797483302238743554080027960742755442896461614",
+        "18470584551415129579199247001078606733569507783840135981816074768215083677828",
+        "6358853786522138406315454623795389840207246394970638114943902091635342117882",
+        "15249488394945361745397791323570379908242511300328815012469245432233652436317",
+        "18547056511895739688478862122897151980319475928563896313389071827563618701425",
+        "13942449975616050138364159111799425596804603704943694417239777823784876190601",
+        "10680677611614531062701577630364864746843526183907022740850847375398991359354"
+    );
+    // bits 252..254
+    m.Window(
+        "0",
+        "2804455449971704844846902771359263528558049942842015341031030459215355425849",
+        "11442838843010920200987124236381046990413412306061849620555104260513476564711",
+        "4967906450236016642927970206941194804494666599263602696898947244860130751217",
+        "8758568581607664587393137782739897129689704749021147636129402116634657241384",
+        "843602386469229041697216239977432672692328490572679170571621779045558717764",
+        "18310176326135641622400678366214591321003889854870284947406653564319533271621",
+        "1503557677949867929648287802213393668849471589683240224431230842791388864273",
+        "1",
+        "4908820804137610238479783986953946137849366450143740413356524292946974364170",
+        "1546787711467127135265359368331802992527265292358767805130453611590664485774",
+        "14171342606461532651948170469618400749217053450174954979206038755902491095082",
+        "2218909707834507373146775231765023325805981001515788375501787055093581124559",
+        "21028163400219276765661214958151895323066955394782048736717890157355347232218",
+        "18552902578418743252298124819275152181418329678081774757816632759696167981180",
+        "18232461614596844510221085269246696325184477013860880654590561067709326656079"
+    );
+    return m.Result();
+}
@@ -6,6 +6,7 @@ class ECCPoint;
 
 
 //Elliptic Curve: y^2 = x^3+ax+b
+//For circuits, edwards.hpp has complete formulas and cheaper scalar multiplications
 class ECC
 {
 	public:
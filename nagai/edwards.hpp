@@ -0,0 +1,259 @@
+#pragma once
+
+#include "field.hpp"
+
+// Elliptic curve gadgets for in-circuit use, on a twisted Edwards curve a*x^2 + y^2 = 1 + d*x^2*y^2
+// embedded in the field of the proof (such as Baby Jubjub in the field of bn128, see babyjubjub.hpp).
+//
+// When a is a square and d is not, the addition formula is complete: it holds for any two points,
+// including the neutral element (0, 1) and a point added to itself, and never divides by zero.
+// The gadgets thus need no branch: in the circuit, a branch on a Field costs a zerop and a
+// multiplication per Field it merges, and ECCPoint (ecc.hpp) cannot handle the point at infinity.
+//
+// Each multiplication of two non-constant Fields, and each division, costs one constraint; additions
+// and multiplications by constants are free. Estimated constraints per operation under this model,
+// for an n-bit scalar, without the split of the scalar (n + 1 constraints, once per scalar):
+//
+//     Add                                 6
+//     Double                              5
+//     Select                              2
+//     Multiply (signed 2-bit windows)     10 * n + 1              (2541 for n = 254)
+//     Ladder                              15 * n - 3              (3807 for n = 254)
+//     fixed base (3-bit windows)          9 * ceil(n / 3) - 6     (759 for n = 254, see EdwardsFixedBase)
+//
+// isekai may lay down a few more, e.g. when a product of two large constants becomes a wire;
+// tests/circuit_cost/ecc-report measures the circuits of ecc.cpp. For comparison, ECCPoint::Multiply
+// on Baby Jubjub in short Weierstrass form does 1069 multiplications and divisions for a 254-bit
+// scalar, plus 256 branches on Fields, each merged as above; its result is wrong when an intermediate
+// point is the point at infinity or when it adds a point to itself.
+
+class EdwardsPoint;
+
+// Twisted Edwards curve: a*x^2 + y^2 = 1 + d*x^2*y^2
+class EdwardsCurve
+{
+public:
+    Field a;
+    Field d;
+
+    __attribute__((always_inline))
+    EdwardsCurve(Field fa, Field fd)
+        : a{fa}
+        , d{fd}
+    {}
+
+    // The neutral element (0, 1)
+    EdwardsPoint Zero() const;
+
+    EdwardsPoint NewPoint(Field x, Field y) const;
+};
+
+// Curve point, in affine coordinates
+class EdwardsPoint
+{
+public:
+    Field x = 0;
+    Field y = 1;
+
+private:
+    // Curve the point belongs to
+    const EdwardsCurve *ec;
+
+public:
+    __attribute__((always_inline))
+    EdwardsPoint(Field px, Field py, const EdwardsCurve *ecc)
+        : x{px}
+        , y{py}
+        , ec{ecc}
+    {}
+
+    // Return '-P'
+    EdwardsPoint Negate() const;
+
+    // Return 'P + Q', for any points
+    EdwardsPoint Add(const EdwardsPoint &q) const;
+
+    // Return '2P'; cheaper than 'Add(*this)'
+    EdwardsPoint Double() const;
+
+    // Return 'bit ? p : q'. 'bit' must be 0 or 1, as returned by 'Field::bit_at'
+    static EdwardsPoint Select(const Field &bit, const EdwardsPoint &p, const EdwardsPoint &q);
+
+    // Return 'k * P', where k is taken modulo 2^nbits (nbits > 0). Processes 2 bits of k per
+    // addition, as a signed digit looked up in a table of P and 3P.
+    EdwardsPoint Multiply(const Field &k, unsigned nbits = 254) const;
+
+    // Return 'k * P', where k is taken modulo 2^nbits, with a Montgomery ladder: one addition and one
+    // doubling per bit, without table. Costs more constraints than 'Multiply'; for code which follows
+    // a specification written with a ladder.
+    EdwardsPoint Ladder(const Field &k, unsigned nbits = 254) const;
+
+private:
+    // Bit i of k, or 0 if i >= nbits
+    static Field BitAt(const Field &k, unsigned i, unsigned nbits);
+};
+
+// Multiplication of a fixed base point B by a scalar, with a table precomputed by gen_fixed_base:
+// for each window of 3 bits of the scalar, the table gives j * 8^i * B (j = 0..7) as the 8
+// coefficients of the polynomial of the window bits which is 1 on the chosen point, so the lookup
+// costs 3 constraints and the addition 6. The generated code (see babyjubjub.hpp) is:
+//
+//     EdwardsFixedBase m(k, curve);
+//     m.Window(<x coefficients>, <y coefficients>);  // once per window, lowest first
+//     ...
+//     return m.Result();
+class EdwardsFixedBase
+{
+    Field k;
+    const EdwardsCurve *ec;
+    // first bit of the next window
+    unsigned pos = 0;
+    bool first = true;
+    EdwardsPoint acc;
+
+    __attribute__((always_inline))
+    static Field Lookup(
+        const Field &b0, const Field &b1, const Field &b01, const Field &b2,
+        const char *c0, const char *c1, const char *c2, const char *c3,
+        const char *c4, const char *c5, const char *c6, const char *c7)
+    {
+        Field low = Field(c0) + Field(c1) * b0 + Field(c2) * b1 + Field(c3) * b01;
+        Field high = Field(c4) + Field(c5) * b0 + Field(c6) * b1 + Field(c7) * b01;
+        return low + b2 * high;
+    }
+
+public:
+    __attribute__((always_inline))
+    EdwardsFixedBase(const Field &scalar, const EdwardsCurve *ecc)
+        : k{scalar}
+        , ec{ecc}
+        , acc{0, 1, ecc}
+    {}
+
+    __attribute__((always_inline))
+    void Window(
+        const char *x0, const char *x1, const char *x2, const char *x3,
+        const char *x4, const char *x5, const char *x6, const char *x7,
+        const char *y0, const char *y1, const char *y2, const char *y3,
+        const char *y4, const char *y5, const char *y6, const char *y7)
+    {
+        Field b0 = k.bit_at(pos);
+        Field b1 = k.bit_at(pos + 1);
+        Field b2 = k.bit_at(pos + 2);
+        Field b01 = b0 * b1;
+        EdwardsPoint p(
+            Lookup(b0, b1, b01, b2, x0, x1, x2, x3, x4, x5, x6, x7),
+            Lookup(b0, b1, b01, b2, y0, y1, y2, y3, y4, y5, y6, y7),
+            ec);
+        acc = first ? p : acc.Add(p);
+        first = false;
+        pos += 3;
+    }
+
+    __attribute__((always_inline))
+    EdwardsPoint Result() const
+    {
+        return acc;
+    }
+};
+
+////////////////////////////////////Implementation//////////////////////////
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsCurve::Zero() const
+{
+    return EdwardsPoint(0, 1, this);
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsCurve::NewPoint(Field x, Field y) const
+{
+    return EdwardsPoint(x, y, this);
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsPoint::Negate() const
+{
+    return EdwardsPoint(-x, y, ec);
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsPoint::Add(const EdwardsPoint &q) const
+{
+    // x3 = (x1*y2 + y1*x2) / (1 + d*x1*x2*y1*y2)
+    // y3 = (y1*y2 - a*x1*x2) / (1 - d*x1*x2*y1*y2)
+    Field xx = x * q.x;
+    Field yy = y * q.y;
+    Field t = ec->d * (xx * yy);
+    // x1*y2 + y1*x2, with one multiplication
+    Field cross = (x + y) * (q.x + q.y) - xx - yy;
+    Field one = 1;
+    return EdwardsPoint(cross / (one + t), (yy - ec->a * xx) / (one - t), ec);
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsPoint::Double() const
+{
+    // On the curve, 1 + d*x^2*y^2 = a*x^2 + y^2:
+    // x3 = 2*x*y / (a*x^2 + y^2)
+    // y3 = (y^2 - a*x^2) / (2 - a*x^2 - y^2)
+    Field axx = ec->a * (x * x);
+    Field yy = y * y;
+    Field two = 2;
+    return EdwardsPoint((two * (x * y)) / (axx + yy), (yy - axx) / (two - axx - yy), ec);
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsPoint::Select(const Field &bit, const EdwardsPoint &p, const EdwardsPoint &q)
+{
+    return EdwardsPoint(q.x + bit * (p.x - q.x), q.y + bit * (p.y - q.y), q.ec);
+}
+
+__attribute__((always_inline))
+inline Field EdwardsPoint::BitAt(const Field &k, unsigned i, unsigned nbits)
+{
+    return i < nbits ? k.bit_at(i) : Field();
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsPoint::Multiply(const Field &k, unsigned nbits) const
+{
+    // Signed digits: with K = floor(k/2) + 2^(n-1), for an even n >= nbits, and K_i its bits,
+    //     sum((2*K_i - 1) * 2^i) = 2*K - (2^n - 1) = k + 1 - k_0
+    // and K_i = k_(i+1), except K_(n-1) = 1. The digits of 2 bits are d = 2*K_i + 4*K_(i+1) - 3, that is
+    // +-1 or +-3 (never 0): their lookup is a select between P and 3P, and a negation.
+    const unsigned n = nbits + (nbits & 1);
+    EdwardsPoint p3 = Double().Add(*this);
+
+    // the highest digit is 1 or 3
+    EdwardsPoint result = Select(BitAt(k, n - 1, nbits), p3, *this);
+    for (unsigned i = n - 2; i > 0;) {
+        i -= 2;
+        Field lo = BitAt(k, i + 1, nbits);
+        Field hi = BitAt(k, i + 2, nbits);
+        // |d| = 1 if lo != hi, negative if !hi
+        Field one_not_three = lo + hi - Field(2) * (lo * hi);
+        EdwardsPoint d = Select(one_not_three, *this, p3);
+        d.x = d.x * (Field(2) * hi - Field(1));
+        result = result.Double().Double().Add(d);
+    }
+
+    // 'result' is (k + 1 - k_0) * P
+    return result.Add(Select(k.bit_at(0), ec->Zero(), Negate()));
+}
+
+__attribute__((always_inline))
+inline EdwardsPoint EdwardsPoint::Ladder(const Field &k, unsigned nbits) const
+{
+    // invariant: r1 = r0 + P
+    EdwardsPoint r0 = ec->Zero();
+    EdwardsPoint r1 = *this;
+    for (unsigned i = nbits; i-- > 0;) {
+        Field bit = k.bit_at(i);
+        // bit ? (r0 + r1, 2*r1) : (2*r0, r0 + r1)
+        EdwardsPoint sum = r0.Add(r1);
+        EdwardsPoint dbl = Select(bit, r1, r0).Double();
+        r0 = Select(bit, sum, dbl);
+        r1 = EdwardsPoint(sum.x + dbl.x - r0.x, sum.y + dbl.y - r0.y, ec);
+    }
+    return r0;
+}
@@ -0,0 +1,138 @@
+// Generates the table of a fixed-base scalar multiplication for edwards.hpp (see EdwardsFixedBase).
+//
+// USAGE: gen_fixed_base <name> <prime> <a> <d> <x> <y> <nbits> > <name>.hpp
+//
+// Writes a header with the curve '<Name>()', its base point '<Name>Base()', and
+// '<Name>MultiplyBase(k)', which computes k * (x, y) for k < 2^nbits. The numbers are in base 10.
+// babyjubjub.hpp was generated with the bn128 prime, a = 168700, d = 168696, the generator of the
+// prime-order subgroup of Baby Jubjub (EIP-2494) and nbits = 254, so that any Field is a scalar:
+//
+//     gen_fixed_base BabyJubjub
+//         21888242871839275222246405745257275088548364400416034343698204186575808495617
+//         168700 168696
+//         5299619240641551281634865583518297030282874472190772894086521144482721001553
+//         16950150798460657717958625567821834550301663161624707787222815936182638968203
+//         254
+
+#include <gmpxx.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+namespace {
+
+mpz_class prime, curve_a, curve_d;
+
+mpz_class reduce(const mpz_class &v)
+{
+    mpz_class r;
+    mpz_mod(r.get_mpz_t(), v.get_mpz_t(), prime.get_mpz_t());
+    return r;
+}
+
+mpz_class divide(const mpz_class &u, const mpz_class &v)
+{
+    mpz_class inv;
+    if (mpz_invert(inv.get_mpz_t(), reduce(v).get_mpz_t(), prime.get_mpz_t()) == 0) {
+        fprintf(stderr, "gen_fixed_base: division by zero; are the formulas complete on this curve?\n");
+        exit(1);
+    }
+    return reduce(u * inv);
+}
+
+struct Point
+{
+    mpz_class x, y;
+};
+
+Point add(const Point &p, const Point &q)
+{
+    mpz_class t = reduce(curve_d * p.x * q.x * p.y * q.y);
+    return Point{
+        divide(p.x * q.y + p.y * q.x, 1 + t),
+        divide(p.y * q.y - curve_a * p.x * q.x, 1 - t),
+    };
+}
+
+bool parse(const char *s, mpz_class &v)
+{
+    return v.set_str(s, 10) == 0;
+}
+
+void print_coefficients(const mpz_class (&t)[8], bool last)
+{
+    // the polynomial of (b0, b1, b2) which is t[b0 + 2*b1 + 4*b2] on bits:
+    // low(b0, b1) + b2 * high(b0, b1), see EdwardsFixedBase::Lookup
+    const mpz_class low[4] = {t[0], t[1] - t[0], t[2] - t[0], t[3] - t[2] - t[1] + t[0]};
+    const mpz_class upper[4] = {t[4], t[5] - t[4], t[6] - t[4], t[7] - t[6] - t[5] + t[4]};
+    for (int i = 0; i < 4; ++i)
+        printf("        \"%s\",\n", reduce(low[i]).get_str().c_str());
+    for (int i = 0; i < 4; ++i)
+        printf("        \"%s\"%s\n", reduce(upper[i] - low[i]).get_str().c_str(), (last && i == 3) ? "" : ",");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Point base;
+    if (argc != 8
+        || !parse(argv[2], prime)
+        || !parse(argv[3], curve_a)
+        || !parse(argv[4], curve_d)
+        || !parse(argv[5], base.x)
+        || !parse(argv[6], base.y))
+    {
+        fprintf(stderr, "USAGE: %s <name> <prime> <a> <d> <x> <y> <nbits>\n", argv[0]);
+        return 2;
+    }
+    const std::string name = argv[1];
+    const int nbits = atoi(argv[7]);
+    if (nbits <= 0) {
+        fprintf(stderr, "gen_fixed_base: invalid nbits '%s'\n", argv[7]);
+        return 2;
+    }
+    if (reduce(curve_a * base.x * base.x + base.y * base.y - 1 - curve_d * base.x * base.x * base.y * base.y) != 0) {
+        fprintf(stderr, "gen_fixed_base: the base point is not on the curve\n");
+        return 1;
+    }
+
+    printf("#pragma once\n\n");
+    printf("// Generated by gen_fixed_base.cpp; do not edit.\n\n");
+    printf("#include \"edwards.hpp\"\n\n");
+    printf("__attribute__((always_inline))\n");
+    printf("inline EdwardsCurve %s()\n{\n", name.c_str());
+    printf("    return EdwardsCurve(Field(\"%s\"), Field(\"%s\"));\n}\n\n",
+           curve_a.get_str().c_str(), curve_d.get_str().c_str());
+    printf("__attribute__((always_inline))\n");
+    printf("inline EdwardsPoint %sBase(const EdwardsCurve *curve)\n{\n", name.c_str());
+    printf("    return curve->NewPoint(\n        Field(\"%s\"),\n        Field(\"%s\"));\n}\n\n",
+           base.x.get_str().c_str(), base.y.get_str().c_str());
+    printf("// k * %sBase(curve), for k < 2^%d\n", name.c_str(), nbits);
+    printf("__attribute__((always_inline))\n");
+    printf("inline EdwardsPoint %sMultiplyBase(const Field &k, const EdwardsCurve *curve)\n{\n", name.c_str());
+    printf("    EdwardsFixedBase m(k, curve);\n");
+
+    // window_base = 8^i * base
+    Point window_base = base;
+    for (int pos = 0; pos < nbits; pos += 3) {
+        Point t[8];
+        t[0] = Point{0, 1};
+        for (int j = 1; j < 8; ++j)
+            t[j] = add(t[j - 1], window_base);
+        mpz_class xs[8], ys[8];
+        for (int j = 0; j < 8; ++j) {
+            xs[j] = t[j].x;
+            ys[j] = t[j].y;
+        }
+        printf("    // bits %d..%d\n", pos, pos + 2);
+        printf("    m.Window(\n");
+        print_coefficients(xs, false);
+        print_coefficients(ys, true);
+        printf("    );\n");
+        window_base = add(t[7], window_base);
+    }
+
+    printf("    return m.Result();\n}\n");
+    return 0;
+}
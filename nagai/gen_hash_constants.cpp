@@ -0,0 +1,306 @@
+// Generates the constants of the hash functions of hash.hpp, for the field of bn128, as circomlib:
+//
+//     gen_hash_constants poseidon > poseidon.hpp
+//     gen_hash_constants mimc > mimc.hpp
+//
+// Poseidon: the round constants and the MDS matrix are sampled with the Grain LFSR of the reference
+// implementation (generate_parameters_grain.sage), for a prime field, the x^5 S-box, 8 full rounds
+// and the partial rounds of circomlib. Known answers: Poseidon(1, 2) =
+// 7853200120776062878684798364095072458815029376092732009249414926327459813530.
+//
+// MiMC-7: 91 rounds; c_0 = 0, and c_i = h_i mod p with h_1 = keccak256(keccak256("mimc")) and
+// h_(i+1) = keccak256(h_i), as big-endian numbers. Known answer: MiMC7(1, 2) =
+// 0x176c6eefc3fdf8d6136002d8e6f7a885bbd1c4e3957b93ddc1ec3ae7859f1a08.
+
+#include <gmpxx.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char *const kPrime = "21888242871839275222246405745257275088548364400416034343698204186575808495617";
+const int kPrimeBits = 254;
+
+mpz_class prime;
+
+mpz_class reduce(const mpz_class &v)
+{
+    mpz_class r;
+    mpz_mod(r.get_mpz_t(), v.get_mpz_t(), prime.get_mpz_t());
+    return r;
+}
+
+mpz_class inverse(const mpz_class &v)
+{
+    mpz_class r;
+    mpz_invert(r.get_mpz_t(), reduce(v).get_mpz_t(), prime.get_mpz_t());
+    return r;
+}
+
+// The self-shrinking Grain LFSR of the Poseidon paper
+class Grain
+{
+    std::vector<int> state;
+
+    int Step()
+    {
+        const int bit = state[62] ^ state[51] ^ state[38] ^ state[23] ^ state[13] ^ state[0];
+        state.erase(state.begin());
+        state.push_back(bit);
+        return bit;
+    }
+
+    void Push(unsigned value, int nbits)
+    {
+        for (int i = nbits - 1; i >= 0; --i)
+            state.push_back((value >> i) & 1);
+    }
+
+public:
+    Grain(int t, int rounds_f, int rounds_p)
+    {
+        Push(1, 2);     // prime field
+        Push(0, 4);     // x^alpha S-box
+        Push(kPrimeBits, 12);
+        Push(t, 12);
+        Push(rounds_f, 10);
+        Push(rounds_p, 10);
+        Push(0x3fffffff, 30);
+        for (int i = 0; i < 160; ++i)
+            Step();
+    }
+
+    int Bit()
+    {
+        for (;;) {
+            if (Step())
+                return Step();
+            Step();
+        }
+    }
+
+    mpz_class Bits(int n)
+    {
+        mpz_class v = 0;
+        for (int i = 0; i < n; ++i)
+            v = v * 2 + Bit();
+        return v;
+    }
+
+    // Round constants are rejected until below p
+    mpz_class Element()
+    {
+        for (;;) {
+            mpz_class v = Bits(kPrimeBits);
+            if (v < prime)
+                return v;
+        }
+    }
+};
+
+void print_literals(const std::vector<mpz_class> &values, const char *sep)
+{
+    for (size_t i = 0; i < values.size(); ++i)
+        printf("%s\"%s\"", i ? sep : "", values[i].get_str().c_str());
+}
+
+void gen_poseidon(int max_inputs)
+{
+    // partial rounds of circomlib, by width t = 2...
+    static const int kRoundsP[] = {56, 57, 56, 60, 60, 63, 64, 63, 60, 66, 60, 65, 70, 60, 64, 68};
+    const int rounds_f = 8;
+
+    printf("#pragma once\n\n");
+    printf("// Generated by gen_hash_constants.cpp; do not edit.\n\n");
+    printf("#include \"field.hpp\"\n\n");
+    printf("// x^5, the S-box of Poseidon\n");
+    printf("__attribute__((always_inline))\n");
+    printf("inline Field PoseidonSBox(const Field &x)\n{\n");
+    printf("    Field x2 = x * x;\n");
+    printf("    return x2 * x2 * x;\n}\n");
+
+    for (int n = 1; n <= max_inputs; ++n) {
+        const int t = n + 1;
+        const int rounds_p = kRoundsP[t - 2];
+        Grain grain(t, rounds_f, rounds_p);
+        std::vector<mpz_class> constants;
+        for (int i = 0; i < (rounds_f + rounds_p) * t; ++i)
+            constants.push_back(grain.Element());
+        // Cauchy matrix 1 / (x_i + y_j), of distinct x_i and y_j
+        std::vector<mpz_class> xy;
+        for (;;) {
+            xy.clear();
+            for (int i = 0; i < 2 * t; ++i)
+                xy.push_back(reduce(grain.Bits(kPrimeBits)));
+            bool distinct = true;
+            for (int i = 0; i < 2 * t; ++i)
+                for (int j = 0; j < i; ++j)
+                    distinct = distinct && xy[i] != xy[j];
+            if (distinct)
+                break;
+        }
+
+        printf("\n// State of Poseidon of width %d (%d input%s): %d full rounds, %d partial rounds\n",
+               t, n, n > 1 ? "s" : "", rounds_f, rounds_p);
+        printf("class PoseidonState%d\n{\npublic:\n", t);
+        printf("    Field");
+        for (int i = 0; i < t; ++i)
+            printf("%s s%d", i ? "," : "", i);
+        printf(";\n\n");
+        printf("    __attribute__((always_inline))\n");
+        printf("    void Round(bool full");
+        for (int i = 0; i < t; ++i)
+            printf(", const char *c%d", i);
+        printf(")\n    {\n");
+        printf("        s0 = PoseidonSBox(s0 + Field(c0));\n");
+        for (int i = 1; i < t; ++i)
+            printf("        s%d = s%d + Field(c%d);\n", i, i, i);
+        printf("        if (full) {\n");
+        for (int i = 1; i < t; ++i)
+            printf("            s%d = PoseidonSBox(s%d);\n", i, i);
+        printf("        }\n");
+        for (int i = 0; i < t; ++i) {
+            printf("        Field m%d =", i);
+            for (int j = 0; j < t; ++j)
+                printf("%s\n            Field(\"%s\") * s%d", j ? " +" : "",
+                       inverse(xy[i] + xy[t + j]).get_str().c_str(), j);
+            printf(";\n");
+        }
+        for (int i = 0; i < t; ++i)
+            printf("        s%d = m%d;\n", i, i);
+        printf("    }\n};\n\n");
+
+        printf("__attribute__((always_inline))\n");
+        printf("inline Field Poseidon(");
+        for (int i = 0; i < n; ++i)
+            printf("%sconst Field &in%d", i ? ", " : "", i);
+        printf(")\n{\n");
+        printf("    PoseidonState%d s;\n", t);
+        for (int i = 0; i < n; ++i)
+            printf("    s.s%d = in%d;\n", i + 1, i);
+        for (int r = 0; r < rounds_f + rounds_p; ++r) {
+            const bool full = r < rounds_f / 2 || r >= rounds_f / 2 + rounds_p;
+            printf("    s.Round(%s,\n        ", full ? "true" : "false");
+            print_literals(std::vector<mpz_class>(constants.begin() + r * t, constants.begin() + (r + 1) * t),
+                           ",\n        ");
+            printf(");\n");
+        }
+        printf("    return s.s0;\n}\n");
+    }
+}
+
+// Keccak-256, as in Ethereum (the padding of the original Keccak, not of SHA-3)
+std::vector<uint8_t> keccak256(const std::vector<uint8_t> &data)
+{
+    static const uint64_t kRoundConstants[24] = {
+        0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+        0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+        0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+        0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+        0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+        0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+    };
+    // rotations of lane x + 5*y
+    static const int kRotations[25] = {
+        0, 1, 62, 28, 27,
+        36, 44, 6, 55, 20,
+        3, 10, 43, 25, 39,
+        41, 45, 15, 21, 8,
+        18, 2, 61, 56, 14,
+    };
+    const size_t rate = 136;
+    std::vector<uint8_t> msg = data;
+    msg.push_back(0x01);
+    while (msg.size() % rate)
+        msg.push_back(0);
+    msg.back() |= 0x80;
+
+    auto rotl = [](uint64_t v, int n) { return n ? (v << n) | (v >> (64 - n)) : v; };
+    uint64_t a[25] = {0};
+    for (size_t off = 0; off < msg.size(); off += rate) {
+        for (size_t i = 0; i < rate / 8; ++i)
+            for (int b = 0; b < 8; ++b)
+                a[i] ^= uint64_t(msg[off + 8 * i + b]) << (8 * b);
+        for (int round = 0; round < 24; ++round) {
+            uint64_t c[5], b[25];
+            for (int x = 0; x < 5; ++x)
+                c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+            for (int x = 0; x < 5; ++x) {
+                const uint64_t d = c[(x + 4) % 5] ^ rotl(c[(x + 1) % 5], 1);
+                for (int y = 0; y < 5; ++y)
+                    a[x + 5 * y] ^= d;
+            }
+            for (int x = 0; x < 5; ++x)
+                for (int y = 0; y < 5; ++y)
+                    b[y + 5 * ((2 * x + 3 * y) % 5)] = rotl(a[x + 5 * y], kRotations[x + 5 * y]);
+            for (int x = 0; x < 5; ++x)
+                for (int y = 0; y < 5; ++y)
+                    a[x + 5 * y] = b[x + 5 * y] ^ (~b[(x + 1) % 5 + 5 * y] & b[(x + 2) % 5 + 5 * y]);
+            a[0] ^= kRoundConstants[round];
+        }
+    }
+    std::vector<uint8_t> out(32);
+    for (int i = 0; i < 32; ++i)
+        out[i] = uint8_t(a[i / 8] >> (8 * (i % 8)));
+    return out;
+}
+
+void gen_mimc()
+{
+    const int rounds = 91;
+    std::vector<mpz_class> constants{0};
+    const char *seed = "mimc";
+    std::vector<uint8_t> h = keccak256(std::vector<uint8_t>(seed, seed + strlen(seed)));
+    for (int i = 1; i < rounds; ++i) {
+        h = keccak256(h);
+        mpz_class c;
+        mpz_import(c.get_mpz_t(), h.size(), 1, 1, 1, 0, h.data());
+        constants.push_back(reduce(c));
+    }
+
+    printf("#pragma once\n\n");
+    printf("// Generated by gen_hash_constants.cpp; do not edit.\n\n");
+    printf("#include \"field.hpp\"\n\n");
+    printf("// Rounds of MiMC-7: x -> (x + k + c)^7, and the key added at the end\n");
+    printf("class MiMC7Rounds\n{\n");
+    printf("    Field x;\n    Field k;\n\n");
+    printf("public:\n");
+    printf("    __attribute__((always_inline))\n");
+    printf("    MiMC7Rounds(const Field &in, const Field &key)\n");
+    printf("        : x{in}\n        , k{key}\n    {}\n\n");
+    printf("    __attribute__((always_inline))\n");
+    printf("    void Round(const char *c)\n    {\n");
+    printf("        Field t = x + k + Field(c);\n");
+    printf("        Field t2 = t * t;\n");
+    printf("        Field t4 = t2 * t2;\n");
+    printf("        x = t4 * t2 * t;\n    }\n\n");
+    printf("    __attribute__((always_inline))\n");
+    printf("    Field Result() const\n    {\n");
+    printf("        return x + k;\n    }\n};\n\n");
+    printf("// MiMC-7 encryption of x with the key k, %d rounds\n", rounds);
+    printf("__attribute__((always_inline))\n");
+    printf("inline Field MiMC7(const Field &x, const Field &k)\n{\n");
+    printf("    MiMC7Rounds r(x, k);\n");
+    for (int i = 0; i < rounds; ++i)
+        printf("    r.Round(\"%s\");\n", constants[i].get_str().c_str());
+    printf("    return r.Result();\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    prime = mpz_class(kPrime);
+    if (argc == 2 && !strcmp(argv[1], "poseidon")) {
+        gen_poseidon(4);
+    } else if (argc == 2 && !strcmp(argv[1], "mimc")) {
+        gen_mimc();
+    } else {
+        fprintf(stderr, "USAGE: %s {poseidon | mimc}\n", argv[0]);
+        return 2;
+    }
+    return 0;
+}
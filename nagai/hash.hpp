@@ -0,0 +1,80 @@
+#pragma once
+
+#include "field.hpp"
+#include "mimc.hpp"
+#include "poseidon.hpp"
+
+// Hash functions over the field of the proof, for commitments and Merkle trees in the circuit: unlike
+// SHA-256, they need no split of their inputs into bits, nor boolean gates. Their constants are
+// those of circomlib for the field of bn128 (isekai's default), generated by gen_hash_constants.
+//
+//     Poseidon(in0, ..., in(n-1))    Poseidon of 1 to 4 inputs, as circomlib's Poseidon(n)
+//     MiMC7(x, k)                    MiMC-7 encryption, as circomlib's MiMC7(91)
+//     MiMCHash(a, b)                 MiMC-7 in Miyaguchi-Preneel mode, as circomlib's MultiMiMC7(2, 91)
+//
+// Estimated constraints, one per multiplication of two non-constant Fields (the S-box x^5 costs 3
+// and x^7 costs 4; the first S-box of Poseidon is partly on constants):
+//
+//     Poseidon, 1 input                   213
+//     Poseidon, 2 inputs                  240
+//     Poseidon, 3 inputs                  261
+//     Poseidon, 4 inputs                  297
+//     MiMC7                               364
+//     MiMCHash                            728
+//     Merkle path of depth 20, Poseidon   4820      (plus the split of the index)
+//     Merkle path of depth 20, MiMC       14580     (plus the split of the index)
+//
+// isekai may lay down a few more, e.g. when a product of two large constants becomes a wire.
+// tests/circuit_cost/hash-report measures them against the SHA-256 of 64 bytes of
+// tests/backend/testcases/g_hash, which splits every 32-bit word into bits.
+
+// MiMC-7 in Miyaguchi-Preneel mode, with the key 0: r = 0, then r += x + MiMC7(x, r) for each input
+__attribute__((always_inline))
+inline Field MiMCHash(const Field &a, const Field &b)
+{
+    Field r = a + MiMC7(a, Field());
+    return r + b + MiMC7(b, r);
+}
+
+// Hashers of the Merkle trees: 'Hash(left, right)' is the parent of two nodes
+struct PoseidonHasher
+{
+    __attribute__((always_inline))
+    static Field Hash(const Field &left, const Field &right)
+    {
+        return Poseidon(left, right);
+    }
+};
+
+struct MiMCHasher
+{
+    __attribute__((always_inline))
+    static Field Hash(const Field &left, const Field &right)
+    {
+        return MiMCHash(left, right);
+    }
+};
+
+// Root of a Merkle tree, from the leaf at 'index' and the 'depth' siblings on its path, from the
+// leaf up: bit i of index is 1 if the node at level i is a right child.
+template <class Hasher = PoseidonHasher>
+__attribute__((always_inline))
+inline Field MerkleRoot(const Field &leaf, const Field *siblings, const Field &index, unsigned depth)
+{
+    Field node = leaf;
+    for (unsigned i = 0; i < depth; ++i) {
+        Field right_child = index.bit_at(i);
+        // right_child ? (sibling, node) : (node, sibling)
+        Field left = node + right_child * (siblings[i] - node);
+        node = Hasher::Hash(left, node + siblings[i] - left);
+    }
+    return node;
+}
+
+// Whether the leaf at 'index' belongs to the Merkle tree of root 'root' (see MerkleRoot)
+template <class Hasher = PoseidonHasher>
+__attribute__((always_inline))
+inline bool MerkleVerify(const Field &root, const Field &leaf, const Field *siblings, const Field &index, unsigned depth)
+{
+    return !static_cast<bool>(MerkleRoot<Hasher>(leaf, siblings, index, depth) - root);
+}
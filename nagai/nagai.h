@@ -15,6 +15,8 @@ extern "C" {
 #   define NAGAI_NOTHROW_ /*nothing*/
 #endif
 
+// Field elements. isekai turns these functions into gates; to run a program natively, link it with
+// the runtime built by CMakeLists.txt (libnagai.a, and -lgmp).
 struct Nagai;
 typedef struct Nagai Nagai;
 
@@ -60,7 +62,8 @@ Nagai *nagai_exp(Nagai *b, Nagai *e, unsigned limit)
     for (unsigned i = 0; i < limit; ++i) {
         Nagai *bit = nagai_getbit(e, i);
         // Yes, we sort of "leak" "memory" here...
-        // Anyway, in isekai, 'nagai_free()' currently does nothing.
+        // Anyway, in isekai, 'nagai_free()' does nothing; the native runtime (runtime.cpp)
+        // keeps the leaked values in its pool.
         if (nagai_nonzero(bit)) {
             // r *= b;
             r = nagai_mul(r, b);
@@ -0,0 +1,1393 @@
+#pragma once
+
+// Generated by gen_hash_constants.cpp; do not edit.
+
+#include "field.hpp"
+
+// x^5, the S-box of Poseidon
+__attribute__((always_inline))
+inline Field PoseidonSBox(const Field &x)
+{
+    Field x2 = x * x;
+    return x2 * x2 * x;
+}
+
+// State of Poseidon of width 2 (1 input): 8 full rounds, 56 partial rounds
+class PoseidonState2
+{
+public:
+    Field s0, s1;
+
+    __attribute__((always_inline))
+    void Round(bool full, const char *c0, const char *c1)
+    {
+        s0 = PoseidonSBox(s0 + Field(c0));
+        s1 = s1 + Field(c1);
+        if (full) {
+            s1 = PoseidonSBox(s1);
+        }
+        Field m0 =
+            Field("2910766817845651019878574839501801340070030115151021261302834310722729507541") * s0 +
+            Field("19727366863391167538122140361473584127147630672623100827934084310230022599144") * s1;
+        Field m1 =
+            Field("5776684794125549462448597414050232243778680302179439492664047328281728356345") * s0 +
+            Field("8348174920934122550483593999453880006756108121341067172388445916328941978568") * s1;
+        s0 = m0;
+        s1 = m1;
+    }
+};
+
+__attribute__((always_inline))
+inline Field Poseidon(const Field &in0)
+{
+    PoseidonState2 s;
+    s.s1 = in0;
+    s.Round(true,
+        "4417881134626180770308697923359573201005643519861877412381846989312604493735",
+        "5433650512959517612316327474713065966758808864213826738576266661723522780033");
+    s.Round(true,
+        "13641176377184356099764086973022553863760045607496549923679278773208775739952",
+        "17949713444224994136330421782109149544629237834775211751417461773584374506783");
+    s.Round(true,
+        "13765628375339178273710281891027109699578766420463125835325926111705201856003",
+        "19179513468172002314585757290678967643352171735526887944518845346318719730387");
+    s.Round(true,
+        "5157412437176756884543472904098424903141745259452875378101256928559722612176",
+        "535160875740282236955320458485730000677124519901643397458212725410971557409");
+    s.Round(false,
+        "1050793453380762984940163090920066886770841063557081906093018330633089036729",
+        "10665495010329663932664894101216428400933984666065399374198502106997623173873");
+    s.Round(false,
+        "19965634623406616956648724894636666805991993496469370618546874926025059150737",
+        "13007250030070838431593222885902415182312449212965120303174723305710127422213");
+    s.Round(false,
+        "16877538715074991604507979123743768693428157847423939051086744213162455276374",
+        "18211747749504876135588847560312685184956239426147543810126553367063157141465");
+    s.Round(false,
+        "18151553319826126919739798892854572062191241985315767086020821632812331245635",
+        "19957033149976712666746140949846950406660099037474791840946955175819555930825");
+    s.Round(false,
+        "3469514863538261843186854830917934449567467100548474599735384052339577040841",
+        "989698510043911779243192466312362856042600749099921773896924315611668507708");
+    s.Round(false,
+        "12568377015646290945235387813564567111330046038050864455358059568128000172201",
+        "20856104135605479600325529349246932565148587186338606236677138505306779314172");
+    s.Round(false,
+        "8206918720503535523121349917159924938835810381723474192155637697065780938424",
+        "1309058477013932989380617265069188723120054926187607548493110334522527703566");
+    s.Round(false,
+        "14076116939332667074621703729512195584105250395163383769419390236426287710606",
+        "10153498892749751942204288991871286290442690932856658983589258153608012428674");
+    s.Round(false,
+        "18202499207234128286137597834010475797175973146805180988367589376893530181575",
+        "12739388830157083522877690211447248168864006284243907142044329113461613743052");
+    s.Round(false,
+        "15123358710467780770838026754240340042441262572309759635224051333176022613949",
+        "19925004701844594370904593774447343836015483888496504201331110250494635362184");
+    s.Round(false,
+        "10352416606816998476681131583320899030072315953910679608943150613208329645891",
+        "10567371822366244361703342347428230537114808440249611395507235283708966113221");
+    s.Round(false,
+        "5635498582763880627392290206431559361272660937399944184533035305989295959602",
+        "11866432933224219174041051738704352719163271639958083608224676028593315904909");
+    s.Round(false,
+        "5795020705294401441272215064554385591292330721703923167136157291459784140431",
+        "9482202378699252817564375087302794636287866584767523335624368774856230692758");
+    s.Round(false,
+        "4245237636894546151746468406560945873445548423466753843402086544922216329298",
+        "12000500941313982757584712677991730019124834399479314697467598397927435905133");
+    s.Round(false,
+        "7596790274058425558167520209857956363736666939016807569082239187494363541787",
+        "2484867918246116343205467273440098378820186751202461278013576281097918148877");
+    s.Round(false,
+        "18312645949449997391810445935615409295369169383463185688973803378104013950190",
+        "15320686572748723004980855263301182130424010735782762814513954166519592552733");
+    s.Round(false,
+        "12618438900597948888520621062416758747872180395546164387827245287017031303859",
+        "17438141672027706116733201008397064011774368832458707512367404736905021019585");
+    s.Round(false,
+        "6374197807230665998865688675365359100400438034755781666913068586172586548950",
+        "2189398913433273865510950346186699930188746169476472274335177556702504595264");
+    s.Round(false,
+        "6268495580028970231803791523870131137294646402347399003576649137450213034606",
+        "17896250365994900261202920044129628104272791547990619503076839618914047059275");
+    s.Round(false,
+        "13692156312448722528008862371944543449350293305158722920787736248435893008873",
+        "15234446864368744483209945022439268713300180233589581910497691316744177619376");
+    s.Round(false,
+        "1572426502623310766593681563281600503979671244997798691029595521622402217227",
+        "80103447810215150918585162168214870083573048458555897999822831203653996617");
+    s.Round(false,
+        "8228820324013669567851850635126713973797711779951230446503353812192849106342",
+        "5375851433746509614045812476958526065449377558695752132494533666370449415873");
+    s.Round(false,
+        "12115998939203497346386774317892338270561208357481805380546938146796257365018",
+        "9764067909645821279940531410531154041386008396840887338272986634350423466622");
+    s.Round(false,
+        "8538708244538850542384936174629541085495830544298260335345008245230827876882",
+        "7140127896620013355910287215441004676619168261422440177712039790284719613114");
+    s.Round(false,
+        "14297402962228458726038826185823085337698917275385741292940049024977027409762",
+        "6667115556431351074165934212337261254608231545257434281887966406956835140819");
+    s.Round(false,
+        "20226761165244293291042617464655196752671169026542832236139342122602741090001",
+        "12038289506489256655759141386763477208196694421666339040483042079632134429119");
+    s.Round(false,
+        "19027757334170818571203982241812412991528769934917288000224335655934473717551",
+        "16272152964456553579565580463468069884359929612321610357528838696790370074720");
+    s.Round(false,
+        "2500392889689246014710135696485946334448570271481948765283016105301740284071",
+        "8595254970528530312401637448610398388203855633951264114100575485022581946023");
+    s.Round(false,
+        "11635945688914011450976408058407206367914559009113158286982919675551688078198",
+        "614739068603482619581328040478536306925147663946742687395148680260956671871");
+    s.Round(false,
+        "18692271780377861570175282183255720350972693125537599213951106550953176268753",
+        "4987059230784976306647166378298632695585915319042844495357753339378260807164");
+    s.Round(false,
+        "21851403978498723616722415377430107676258664746210815234490134600998983955497",
+        "9830635451186415300891533983087800047564037813328875992115573428596207326204");
+    s.Round(false,
+        "4842706106434537116860242620706030229206345167233200482994958847436425185478",
+        "6422235064906823218421386871122109085799298052314922856340127798647926126490");
+    s.Round(false,
+        "4564364104986856861943331689105797031330091877115997069096365671501473357846",
+        "1944043894089780613038197112872830569538541856657037469098448708685350671343");
+    s.Round(false,
+        "21179865974855950600518216085229498748425990426231530451599322283119880194955",
+        "14296697761894107574369608843560006996183955751502547883167824879840894933162");
+    s.Round(false,
+        "12274619649702218570450581712439138337725246879938860735460378251639845671898",
+        "16371396450276899401411886674029075408418848209575273031725505038938314070356");
+    s.Round(false,
+        "3702561221750983937578095019779188631407216522704543451228773892695044653565",
+        "19721616877735564664624984774636557499099875603996426215495516594530838681980");
+    s.Round(false,
+        "6383350109027696789969911008057747025018308755462287526819231672217685282429",
+        "20860583956177367265984596617324237471765572961978977333122281041544719622905");
+    s.Round(false,
+        "5766390934595026947545001478457407504285452477687752470140790011329357286275",
+        "4043175758319898049344746138515323336207420888499903387536875603879441092484");
+    s.Round(false,
+        "15579382179133608217098622223834161692266188678101563820988612253342538956534",
+        "1864640783252634743892105383926602930909039567065240010338908865509831749824");
+    s.Round(false,
+        "15943719865023133586707144161652035291705809358178262514871056013754142625673",
+        "2326415993032390211558498780803238091925402878871059708106213703504162832999");
+    s.Round(false,
+        "19995326402773833553207196590622808505547443523750970375738981396588337910289",
+        "5143583711361588952673350526320181330406047695593201009385718506918735286622");
+    s.Round(false,
+        "15436006486881920976813738625999473183944244531070780793506388892313517319583",
+        "16660446760173633166698660166238066533278664023818938868110282615200613695857");
+    s.Round(false,
+        "4966065365695755376133119391352131079892396024584848298231004326013366253934",
+        "20683781957411705574951987677641476019618457561419278856689645563561076926702");
+    s.Round(false,
+        "17280836839165902792086432296371645107551519324565649849400948918605456875699",
+        "17045635513701208892073056357048619435743564064921155892004135325530808465371");
+    s.Round(false,
+        "17055032967194400710390142791334572297458033582458169295920670679093585707295",
+        "15727174639569115300068198908071514334002742825679221638729902577962862163505");
+    s.Round(false,
+        "1001755657610446661315902885492677747789366510875120894840818704741370398633",
+        "18638547332826171619311285502376343504539399518545103511265465604926625041234");
+    s.Round(false,
+        "6751954224763196429755298529194402870632445298969935050224267844020826420799",
+        "3526747115904224771452549517614107688674036840088422555827581348280834879405");
+    s.Round(false,
+        "15705897908180497062880001271426561999724005008972544196300715293701537574122",
+        "574386695213920937259007343820417029802510752426579750428758189312416867750");
+    s.Round(false,
+        "15973040855000600860816974646787367136127946402908768408978806375685439868553",
+        "20934130413948796333037139460875996342810005558806621330680156931816867321122");
+    s.Round(false,
+        "6918585327145564636398173845411579411526758237572034236476079610890705810764",
+        "14158163500813182062258176233162498241310167509137716527054939926126453647182");
+    s.Round(false,
+        "4164602626597695668474100217150111342272610479949122406544277384862187287433",
+        "12146526846507496913615390662823936206892812880963914267275606265272996025304");
+    s.Round(false,
+        "10153527926900017763244212043512822363696541810586522108597162891799345289938",
+        "13564663485965299104296214940873270349072051793008946663855767889066202733588");
+    s.Round(false,
+        "5612449256997576125867742696783020582952387615430650198777254717398552960096",
+        "12151885480032032868507892738683067544172874895736290365318623681886999930120");
+    s.Round(false,
+        "380452237704664384810613424095477896605414037288009963200982915188629772177",
+        "9067557551252570188533509616805287919563636482030947363841198066124642069518");
+    s.Round(false,
+        "21280306817619711661335268484199763923870315733198162896599997188206277056900",
+        "5567165819557297006750252582140767993422097822227408837378089569369734876257");
+    s.Round(false,
+        "10411936321072105429908396649383171465939606386380071222095155850987201580137",
+        "21338390051413922944780864872652000187403217966653363270851298678606449622266");
+    s.Round(true,
+        "12156296560457833712186127325312904760045212412680904475497938949653569234473",
+        "4271647814574748734312113971565139132510281260328947438246615707172526380757");
+    s.Round(true,
+        "9061738206062369647211128232833114177054715885442782773131292534862178874950",
+        "10134551893627587797380445583959894183158393780166496661696555422178052339133");
+    s.Round(true,
+        "8932270237664043612366044102088319242789325050842783721780970129656616386103",
+        "3339412934966886386194449782756711637636784424032779155216609410591712750636");
+    s.Round(true,
+        "9704903972004596791086522314847373103670545861209569267884026709445485704400",
+        "17467570179597572575614276429760169990940929887711661192333523245667228809456");
+    return s.s0;
+}
+
+// State of Poseidon of width 3 (2 inputs): 8 full rounds, 57 partial rounds
+class PoseidonState3
+{
+public:
+    Field s0, s1, s2;
+
+    __attribute__((always_inline))
+    void Round(bool full, const char *c0, const char *c1, const char *c2)
+    {
+        s0 = PoseidonSBox(s0 + Field(c0));
+        s1 = s1 + Field(c1);
+        s2 = s2 + Field(c2);
+        if (full) {
+            s1 = PoseidonSBox(s1);
+            s2 = PoseidonSBox(s2);
+        }
+        Field m0 =
+            Field("7511745149465107256748700652201246547602992235352608707588321460060273774987") * s0 +
+            Field("10370080108974718697676803824769673834027675643658433702224577712625900127200") * s1 +
+            Field("19705173408229649878903981084052839426532978878058043055305024233888854471533") * s2;
+        Field m1 =
+            Field("18732019378264290557468133440468564866454307626475683536618613112504878618481") * s0 +
+            Field("20870176810702568768751421378473869562658540583882454726129544628203806653987") * s1 +
+            Field("7266061498423634438633389053804536045105766754026813321943009179476902321146") * s2;
+        Field m2 =
+            Field("9131299761947733513298312097611845208338517739621853568979632113419485819303") * s0 +
+            Field("10595341252162738537912664445405114076324478519622938027420701542910180337937") * s1 +
+            Field("11597556804922396090267472882856054602429588299176362916247939723151043581408") * s2;
+        s0 = m0;
+        s1 = m1;
+        s2 = m2;
+    }
+};
+
+__attribute__((always_inline))
+inline Field Poseidon(const Field &in0, const Field &in1)
+{
+    PoseidonState3 s;
+    s.s1 = in0;
+    s.s2 = in1;
+    s.Round(true,
+        "6745197990210204598374042828761989596302876299545964402857411729872131034734",
+        "426281677759936592021316809065178817848084678679510574715894138690250139748",
+        "4014188762916583598888942667424965430287497824629657219807941460227372577781");
+    s.Round(true,
+        "21328925083209914769191926116470334003273872494252651254811226518870906634704",
+        "19525217621804205041825319248827370085205895195618474548469181956339322154226",
+        "1402547928439424661186498190603111095981986484908825517071607587179649375482");
+    s.Round(true,
+        "18320863691943690091503704046057443633081959680694199244583676572077409194605",
+        "17709820605501892134371743295301255810542620360751268064484461849423726103416",
+        "15970119011175710804034336110979394557344217932580634635707518729185096681010");
+    s.Round(true,
+        "9818625905832534778628436765635714771300533913823445439412501514317783880744",
+        "6235167673500273618358172865171408902079591030551453531218774338170981503478",
+        "12575685815457815780909564540589853169226710664203625668068862277336357031324");
+    s.Round(false,
+        "7381963244739421891665696965695211188125933529845348367882277882370864309593",
+        "14214782117460029685087903971105962785460806586237411939435376993762368956406",
+        "13382692957873425730537487257409819532582973556007555550953772737680185788165");
+    s.Round(false,
+        "2203881792421502412097043743980777162333765109810562102330023625047867378813",
+        "2916799379096386059941979057020673941967403377243798575982519638429287573544",
+        "4341714036313630002881786446132415875360643644216758539961571543427269293497");
+    s.Round(false,
+        "2340590164268886572738332390117165591168622939528604352383836760095320678310",
+        "5222233506067684445011741833180208249846813936652202885155168684515636170204",
+        "7963328565263035669460582454204125526132426321764384712313576357234706922961");
+    s.Round(false,
+        "1394121618978136816716817287892553782094854454366447781505650417569234586889",
+        "20251767894547536128245030306810919879363877532719496013176573522769484883301",
+        "141695147295366035069589946372747683366709960920818122842195372849143476473");
+    s.Round(false,
+        "15919677773886738212551540894030218900525794162097204800782557234189587084981",
+        "2616624285043480955310772600732442182691089413248613225596630696960447611520",
+        "4740655602437503003625476760295930165628853341577914460831224100471301981787");
+    s.Round(false,
+        "19201590924623513311141753466125212569043677014481753075022686585593991810752",
+        "12116486795864712158501385780203500958268173542001460756053597574143933465696",
+        "8481222075475748672358154589993007112877289817336436741649507712124418867136");
+    s.Round(false,
+        "5181207870440376967537721398591028675236553829547043817076573656878024336014",
+        "1576305643467537308202593927724028147293702201461402534316403041563704263752",
+        "2555752030748925341265856133642532487884589978209403118872788051695546807407");
+    s.Round(false,
+        "18840924862590752659304250828416640310422888056457367520753407434927494649454",
+        "14593453114436356872569019099482380600010961031449147888385564231161572479535",
+        "20826991704411880672028799007667199259549645488279985687894219600551387252871");
+    s.Round(false,
+        "9159011389589751902277217485643457078922343616356921337993871236707687166408",
+        "5605846325255071220412087261490782205304876403716989785167758520729893194481",
+        "1148784255964739709393622058074925404369763692117037208398835319441214134867");
+    s.Round(false,
+        "20945896491956417459309978192328611958993484165135279604807006821513499894540",
+        "229312996389666104692157009189660162223783309871515463857687414818018508814",
+        "21184391300727296923488439338697060571987191396173649012875080956309403646776");
+    s.Round(false,
+        "21853424399738097885762888601689700621597911601971608617330124755808946442758",
+        "12776298811140222029408960445729157525018582422120161448937390282915768616621",
+        "7556638921712565671493830639474905252516049452878366640087648712509680826732");
+    s.Round(false,
+        "19042212131548710076857572964084011858520620377048961573689299061399932349935",
+        "12871359356889933725034558434803294882039795794349132643274844130484166679697",
+        "3313271555224009399457959221795880655466141771467177849716499564904543504032");
+    s.Round(false,
+        "15080780006046305940429266707255063673138269243146576829483541808378091931472",
+        "21300668809180077730195066774916591829321297484129506780637389508430384679582",
+        "20480395468049323836126447690964858840772494303543046543729776750771407319822");
+    s.Round(false,
+        "10034492246236387932307199011778078115444704411143703430822959320969550003883",
+        "19584962776865783763416938001503258436032522042569001300175637333222729790225",
+        "20155726818439649091211122042505326538030503429443841583127932647435472711802");
+    s.Round(false,
+        "13313554736139368941495919643765094930693458639277286513236143495391474916777",
+        "14606609055603079181113315307204024259649959674048912770003912154260692161833",
+        "5563317320536360357019805881367133322562055054443943486481491020841431450882");
+    s.Round(false,
+        "10535419877021741166931390532371024954143141727751832596925779759801808223060",
+        "12025323200952647772051708095132262602424463606315130667435888188024371598063",
+        "2906495834492762782415522961458044920178260121151056598901462871824771097354");
+    s.Round(false,
+        "19131970618309428864375891649512521128588657129006772405220584460225143887876",
+        "8896386073442729425831367074375892129571226824899294414632856215758860965449",
+        "7748212315898910829925509969895667732958278025359537472413515465768989125274");
+    s.Round(false,
+        "422974903473869924285294686399247660575841594104291551918957116218939002865",
+        "6398251826151191010634405259351528880538837895394722626439957170031528482771",
+        "18978082967849498068717608127246258727629855559346799025101476822814831852169");
+    s.Round(false,
+        "19150742296744826773994641927898928595714611370355487304294875666791554590142",
+        "12896891575271590393203506752066427004153880610948642373943666975402674068209",
+        "9546270356416926575977159110423162512143435321217584886616658624852959369669");
+    s.Round(false,
+        "2159256158967802519099187112783460402410585039950369442740637803310736339200",
+        "8911064487437952102278704807713767893452045491852457406400757953039127292263",
+        "745203718271072817124702263707270113474103371777640557877379939715613501668");
+    s.Round(false,
+        "19313999467876585876087962875809436559985619524211587308123441305315685710594",
+        "13254105126478921521101199309550428567648131468564858698707378705299481802310",
+        "1842081783060652110083740461228060164332599013503094142244413855982571335453");
+    s.Round(false,
+        "9630707582521938235113899367442877106957117302212260601089037887382200262598",
+        "5066637850921463603001689152130702510691309665971848984551789224031532240292",
+        "4222575506342961001052323857466868245596202202118237252286417317084494678062");
+    s.Round(false,
+        "2919565560395273474653456663643621058897649501626354982855207508310069954086",
+        "6828792324689892364977311977277548750189770865063718432946006481461319858171",
+        "2245543836264212411244499299744964607957732316191654500700776604707526766099");
+    s.Round(false,
+        "19602444885919216544870739287153239096493385668743835386720501338355679311704",
+        "8239538512351936341605373169291864076963368674911219628966947078336484944367",
+        "15053013456316196458870481299866861595818749671771356646798978105863499965417");
+    s.Round(false,
+        "7173615418515925804810790963571435428017065786053377450925733428353831789901",
+        "8239211677777829016346247446855147819062679124993100113886842075069166957042",
+        "15330855478780269194281285878526984092296288422420009233557393252489043181621");
+    s.Round(false,
+        "10014883178425964324400942419088813432808659204697623248101862794157084619079",
+        "14014440630268834826103915635277409547403899966106389064645466381170788813506",
+        "3580284508947993352601712737893796312152276667249521401778537893620670305946");
+    s.Round(false,
+        "2559754020964039399020874042785294258009596917335212876725104742182177996988",
+        "14898657953331064524657146359621913343900897440154577299309964768812788279359",
+        "2094037260225570753385567402013028115218264157081728958845544426054943497065");
+    s.Round(false,
+        "18051086536715129874440142649831636862614413764019212222493256578581754875930",
+        "21680659279808524976004872421382255670910633119979692059689680820959727969489",
+        "13950668739013333802529221454188102772764935019081479852094403697438884885176");
+    s.Round(false,
+        "9703845704528288130475698300068368924202959408694460208903346143576482802458",
+        "12064310080154762977097567536495874701200266107682637369509532768346427148165",
+        "16970760937630487134309762150133050221647250855182482010338640862111040175223");
+    s.Round(false,
+        "9790997389841527686594908620011261506072956332346095631818178387333642218087",
+        "16314772317774781682315680698375079500119933343877658265473913556101283387175",
+        "82044870826814863425230825851780076663078706675282523830353041968943811739");
+    s.Round(false,
+        "21696416499108261787701615667919260888528264686979598953977501999747075085778",
+        "327771579314982889069767086599893095509690747425186236545716715062234528958",
+        "4606746338794869835346679399457321301521448510419912225455957310754258695442");
+    s.Round(false,
+        "64499140292086295251085369317820027058256893294990556166497635237544139149",
+        "10455028514626281809317431738697215395754892241565963900707779591201786416553",
+        "10421411526406559029881814534127830959833724368842872558146891658647152404488");
+    s.Round(false,
+        "18848084335930758908929996602136129516563864917028006334090900573158639401697",
+        "13844582069112758573505569452838731733665881813247931940917033313637916625267",
+        "13488838454403536473492810836925746129625931018303120152441617863324950564617");
+    s.Round(false,
+        "15742141787658576773362201234656079648895020623294182888893044264221895077688",
+        "6756884846734501741323584200608866954194124526254904154220230538416015199997",
+        "7860026400080412708388991924996537435137213401947704476935669541906823414404");
+    s.Round(false,
+        "7871040688194276447149361970364037034145427598711982334898258974993423182255",
+        "20758972836260983284101736686981180669442461217558708348216227791678564394086",
+        "21723241881201839361054939276225528403036494340235482225557493179929400043949");
+    s.Round(false,
+        "19428469330241922173653014973246050805326196062205770999171646238586440011910",
+        "7969200143746252148180468265998213908636952110398450526104077406933642389443",
+        "10950417916542216146808986264475443189195561844878185034086477052349738113024");
+    s.Round(false,
+        "18149233917533571579549129116652755182249709970669448788972210488823719849654",
+        "3729796741814967444466779622727009306670204996071028061336690366291718751463",
+        "5172504399789702452458550583224415301790558941194337190035441508103183388987");
+    s.Round(false,
+        "6686473297578275808822003704722284278892335730899287687997898239052863590235",
+        "19426913098142877404613120616123695099909113097119499573837343516470853338513",
+        "5120337081764243150760446206763109494847464512045895114970710519826059751800");
+    s.Round(false,
+        "5055737465570446530938379301905385631528718027725177854815404507095601126720",
+        "14235578612970484492268974539959119923625505766550088220840324058885914976980",
+        "653592517890187950103239281291172267359747551606210609563961204572842639923");
+    s.Round(false,
+        "5507360526092411682502736946959369987101940689834541471605074817375175870579",
+        "7864202866011437199771472205361912625244234597659755013419363091895334445453",
+        "21294659996736305811805196472076519801392453844037698272479731199885739891648");
+    s.Round(false,
+        "13767183507040326119772335839274719411331242166231012705169069242737428254651",
+        "810181532076738148308457416289197585577119693706380535394811298325092337781",
+        "14232321930654703053193240133923161848171310212544136614525040874814292190478");
+    s.Round(false,
+        "16796904728299128263054838299534612533844352058851230375569421467352578781209",
+        "16256310366973209550759123431979563367001604350120872788217761535379268327259",
+        "19791658638819031543640174069980007021961272701723090073894685478509001321817");
+    s.Round(false,
+        "7046232469803978873754056165670086532908888046886780200907660308846356865119",
+        "16001732848952745747636754668380555263330934909183814105655567108556497219752",
+        "9737276123084413897604802930591512772593843242069849260396983774140735981896");
+    s.Round(false,
+        "11410895086919039954381533622971292904413121053792570364694836768885182251535",
+        "19098362474249267294548762387533474746422711206129028436248281690105483603471",
+        "11013788190750472643548844759298623898218957233582881400726340624764440203586");
+    s.Round(false,
+        "2206958256327295151076063922661677909471794458896944583339625762978736821035",
+        "7171889270225471948987523104033632910444398328090760036609063776968837717795",
+        "2510237900514902891152324520472140114359583819338640775472608119384714834368");
+    s.Round(false,
+        "8825275525296082671615660088137472022727508654813239986303576303490504107418",
+        "1481125575303576470988538039195271612778457110700618040436600537924912146613",
+        "16268684562967416784133317570130804847322980788316762518215429249893668424280");
+    s.Round(false,
+        "4681491452239189664806745521067158092729838954919425311759965958272644506354",
+        "3131438137839074317765338377823608627360421824842227925080193892542578675835",
+        "7930402370812046914611776451748034256998580373012248216998696754202474945793");
+    s.Round(false,
+        "8973151117361309058790078507956716669068786070949641445408234962176963060145",
+        "10223139291409280771165469989652431067575076252562753663259473331031932716923",
+        "2232089286698717316374057160056566551249777684520809735680538268209217819725");
+    s.Round(false,
+        "16930089744400890347392540468934821520000065594669279286854302439710657571308",
+        "21739597952486540111798430281275997558482064077591840966152905690279247146674",
+        "7508315029150148468008716674010060103310093296969466203204862163743615534994");
+    s.Round(false,
+        "11418894863682894988747041469969889669847284797234703818032750410328384432224",
+        "10895338268862022698088163806301557188640023613155321294365781481663489837917",
+        "18644184384117747990653304688839904082421784959872380449968500304556054962449");
+    s.Round(false,
+        "7414443845282852488299349772251184564170443662081877445177167932875038836497",
+        "5391299369598751507276083947272874512197023231529277107201098701900193273851",
+        "10329906873896253554985208009869159014028187242848161393978194008068001342262");
+    s.Round(false,
+        "4711719500416619550464783480084256452493890461073147512131129596065578741786",
+        "11943219201565014805519989716407790139241726526989183705078747065985453201504",
+        "4298705349772984837150885571712355513879480272326239023123910904259614053334");
+    s.Round(false,
+        "9999044003322463509208400801275356671266978396985433172455084837770460579627",
+        "4908416131442887573991189028182614782884545304889259793974797565686968097291",
+        "11963412684806827200577486696316210731159599844307091475104710684559519773777");
+    s.Round(false,
+        "20129916000261129180023520480843084814481184380399868943565043864970719708502",
+        "12884788430473747619080473633364244616344003003135883061507342348586143092592",
+        "20286808211545908191036106582330883564479538831989852602050135926112143921015");
+    s.Round(false,
+        "16282045180030846845043407450751207026423331632332114205316676731302016331498",
+        "4332932669439410887701725251009073017227450696965904037736403407953448682093",
+        "11105712698773407689561953778861118250080830258196150686012791790342360778288");
+    s.Round(false,
+        "21853934471586954540926699232107176721894655187276984175226220218852955976831",
+        "9807888223112768841912392164376763820266226276821186661925633831143729724792",
+        "13411808896854134882869416756427789378942943805153730705795307450368858622668");
+    s.Round(false,
+        "17906847067500673080192335286161014930416613104209700445088168479205894040011",
+        "14554387648466176616800733804942239711702169161888492380425023505790070369632",
+        "4264116751358967409634966292436919795665643055548061693088119780787376143967");
+    s.Round(true,
+        "2401104597023440271473786738539405349187326308074330930748109868990675625380",
+        "12251645483867233248963286274239998200789646392205783056343767189806123148785",
+        "15331181254680049984374210433775713530849624954688899814297733641575188164316");
+    s.Round(true,
+        "13108834590369183125338853868477110922788848506677889928217413952560148766472",
+        "6843160824078397950058285123048455551935389277899379615286104657075620692224",
+        "10151103286206275742153883485231683504642432930275602063393479013696349676320");
+    s.Round(true,
+        "7074320081443088514060123546121507442501369977071685257650287261047855962224",
+        "11413928794424774638606755585641504971720734248726394295158115188173278890938",
+        "7312756097842145322667451519888915975561412209738441762091369106604423801080");
+    s.Round(true,
+        "7181677521425162567568557182629489303281861794357882492140051324529826589361",
+        "15123155547166304758320442783720138372005699143801247333941013553002921430306",
+        "13409242754315411433193860530743374419854094495153957441316635981078068351329");
+    return s.s0;
+}
+
+// State of Poseidon of width 4 (3 inputs): 8 full rounds, 56 partial rounds
+class PoseidonState4
+{
+public:
+    Field s0, s1, s2, s3;
+
+    __attribute__((always_inline))
+    void Round(bool full, const char *c0, const char *c1, const char *c2, const char *c3)
+    {
+        s0 = PoseidonSBox(s0 + Field(c0));
+        s1 = s1 + Field(c1);
+        s2 = s2 + Field(c2);
+        s3 = s3 + Field(c3);
+        if (full) {
+            s1 = PoseidonSBox(s1);
+            s2 = PoseidonSBox(s2);
+            s3 = PoseidonSBox(s3);
+        }
+        Field m0 =
+            Field("16023668707004248971294664614290028914393192768609916554276071736843535714477") * s0 +
+            Field("17849615858846139011678879517964683507928512741474025695659909954675835121177") * s1 +
+            Field("1013663139540921998616312712475594638459213772728467613870351821911056489570") * s2 +
+            Field("13211800058103802189838759488224684841774731021206389709687693993627918500545") * s3;
+        Field m1 =
+            Field("19204974983793400699898444372535256207646557857575315905278218870961389967884") * s0 +
+            Field("3722304780857845144568029505892077496425786544014166938942516810831732569870") * s1 +
+            Field("11920634922168932145084219049241528148129057802067880076377897257847125830511") * s2 +
+            Field("6085682566123812000257211683010755099394491689511511633947011263229442977967") * s3;
+        Field m2 =
+            Field("14672613178263529785795301930884172260797190868602674472542654261498546023746") * s0 +
+            Field("20850178060552184587113773087797340350525370429749200838012809627359404457643") * s1 +
+            Field("7082289538076771741936674361200789891432311337766695368327626572220036527624") * s2 +
+            Field("1787876543469562003404632310460227730887431311758627706450615128255538398187") * s3;
+        Field m3 =
+            Field("21407770160218607278833379114951608489910182969042472165261557405353704846967") * s0 +
+            Field("16058955581309173858487265533260133430557379878452348481750737813742488209262") * s1 +
+            Field("593311177550138061601452020934455734040559402531605836278498327468203888086") * s2 +
+            Field("341662423637860635938968460722645910313598807845686354625820505885069260074") * s3;
+        s0 = m0;
+        s1 = m1;
+        s2 = m2;
+        s3 = m3;
+    }
+};
+
+__attribute__((always_inline))
+inline Field Poseidon(const Field &in0, const Field &in1, const Field &in2)
+{
+    PoseidonState4 s;
+    s.s1 = in0;
+    s.s2 = in1;
+    s.s3 = in2;
+    s.Round(true,
+        "11633431549750490989983886834189948010834808234699737327785600195936805266405",
+        "17353750182810071758476407404624088842693631054828301270920107619055744005334",
+        "11575173631114898451293296430061690731976535592475236587664058405912382527658",
+        "9724643380371653925020965751082872123058642683375812487991079305063678725624");
+    s.Round(true,
+        "20936725237749945635418633443468987188819556232926135747685274666391889856770",
+        "6427758822462294912934022562310355233516927282963039741999349770315205779230",
+        "16782979953202249973699352594809882974187694538612412531558950864304931387798",
+        "8979171037234948998646722737761679613767384188475887657669871981433930833742");
+    s.Round(true,
+        "5428827536651017352121626533783677797977876323745420084354839999137145767736",
+        "507241738797493565802569310165979445570507129759637903167193063764556368390",
+        "6711578168107599474498163409443059675558516582274824463959700553865920673097",
+        "2197359304646916921018958991647650011119043556688567376178243393652789311643");
+    s.Round(true,
+        "4634703622846121403803831560584049007806112989824652272428991253572845447400",
+        "17008376818199175111793852447685303011746023680921106348278379453039148937791",
+        "18430784755956196942937899353653692286521408688385681805132578732731487278753",
+        "4573768376486344895797915946239137669624900197544620153250805961657870918727");
+    s.Round(false,
+        "5624865188680173294191042415227598609140934495743721047183803859030618890703",
+        "8228252753786907198149068514193371173033070694924002912950645971088002709521",
+        "17586714789554691446538331362711502394998837215506284064347036653995353304693",
+        "12985198716830497423350597750558817467658937953000235442251074063454897365701");
+    s.Round(false,
+        "13480076116139680784838493959937969792577589073830107110893279354229821035984",
+        "480609231761423388761863647137314056373740727639536352979673303078459561332",
+        "19503345496799249258956440299354839375920540225688429628121751361906635419276",
+        "16837818502122887883669221005435922946567532037624537243846974433811447595173");
+    s.Round(false,
+        "5492108497278641078569490709794391352213168666744080628008171695469579703581",
+        "11365311159988448419785032079155356000691294261495515880484003277443744617083",
+        "13876891705632851072613751905778242936713392247975808888614530203269491723653",
+        "10660388389107698747692475159023710744797290186015856503629656779989214850043");
+    s.Round(false,
+        "18876318870401623474401728758498150977988613254023317877612912724282285739292",
+        "15543349138237018307536452195922365893694804703361435879256942490123776892424",
+        "2839988449157209999638903652853828318645773519300826410959678570041742458201",
+        "7566039810305694135184226097163626060317478635973510706368412858136696413063");
+    s.Round(false,
+        "6344830340705033582410486810600848473125256338903726340728639711688240744220",
+        "12475357769019880256619207099578191648078162511547701737481203260317463892731",
+        "13337401254840718303633782478677852514218549070508887338718446132574012311307",
+        "21161869193849404954234950798647336336709035097706159414187214758702055364571");
+    s.Round(false,
+        "20671052961616073313397254362345395594858011165315285344464242404604146448678",
+        "2772189387845778213446441819361180378678387127454165972767013098872140927416",
+        "3339032002224218054945450150550795352855387702520990006196627537441898997147",
+        "14919705931281848425960108279746818433850049439186607267862213649460469542157");
+    s.Round(false,
+        "17056699976793486403099510941807022658662936611123286147276760381688934087770",
+        "16144580075268719403964467603213740327573316872987042261854346306108421013323",
+        "15582343953927413680541644067712456296539774919658221087452235772880573393376",
+        "17528510080741946423534916423363640132610906812668323263058626230135522155749");
+    s.Round(false,
+        "3190600034239022251529646836642735752388641846393941612827022280601486805721",
+        "8463814172152682468446984305780323150741498069701538916468821815030498611418",
+        "16533435971270903741871235576178437313873873358463959658178441562520661055273",
+        "11845696835505436397913764735273748291716405946246049903478361223369666046634");
+    s.Round(false,
+        "18391057370973634202531308463652130631065370546571735004701144829951670507215",
+        "262537877325812689820791215463881982531707709719292538608229687240243203710",
+        "2187234489894387585309965540987639130975753519805550941279098789852422770021",
+        "19189656350920455659006418422409390013967064310525314160026356916172976152967");
+    s.Round(false,
+        "15839474183930359560478122372067744245080413846070743460407578046890458719219",
+        "1805019124769763805045852541831585930225376844141668951787801647576910524592",
+        "323592203814803486950280155834638828455175703393817797003361354810251742052",
+        "9780393509796825017346015868945480913627956475147371732521398519483580624282");
+    s.Round(false,
+        "14009429785059642386335012561867511048847749030947687313594053997432177705759",
+        "13749550162460745037234826077137388777330401847577727796245150843898019635981",
+        "19497187499283431845443758879472819384797584633472792651343926414232528405311",
+        "3708428802547661961864524194762556064568867603968214870300574294082023305587");
+    s.Round(false,
+        "1339414413482882567499652761996854155383863472782829777976929310155400981782",
+        "6396261245879814100794661157306877072718690153118140891315137894471052482309",
+        "2069661495404347929962833138824526893650803079024564477269192079629046031674",
+        "15793521554502133342917616035884588152451122589545915605459159078589855944361");
+    s.Round(false,
+        "17053424498357819626596285492499512504457128907932827007302385782133229252374",
+        "13658536470391360399708067455536748955260723760813498481671323619545320978896",
+        "21546095668130239633971575351786704948662094117932406102037724221634677838565",
+        "21411726238386979516934941789127061362496195649331822900487557574597304399109");
+    s.Round(false,
+        "1944776378988765673004063363506638781964264107780425928778257145151172817981",
+        "15590719714223718537172639598316570285163081746016049278954513732528516468773",
+        "1351266421179051765004709939353170430290500926943038391678843253157009556309",
+        "6772476224477167317130064764757502335545080109882028900432703947986275397548");
+    s.Round(false,
+        "10670120969725161535937685539136065944959698664551200616467222887025111751992",
+        "4731853626374224678749618809759140702342195350742653173378450474772131006181",
+        "14473527495914528513885847341981310373531349450901830749157165104135412062812",
+        "16937191362061486658876740597821783333355021670608822932942683228741190786143");
+    s.Round(false,
+        "5656559696428674390125424316117443507583679061659043998559560535270557939546",
+        "8897648276515725841133578021896617755369443750194849587616503841335248902806",
+        "14938684446722672719637788054570691068799510611164812175626676768545923371470",
+        "15284149043690546115252102390417391226617211133644099356880071475803043461465");
+    s.Round(false,
+        "2623479025068612775740107497276979457946709347831661908218182874823658838107",
+        "6809791961761836061129379546794905411734858375517368211894790874813684813988",
+        "2417620338751920563196799065781703780495622795713803712576790485412779971775",
+        "4445143310792944321746901285176579692343442786777464604312772017806735512661");
+    s.Round(false,
+        "1429019233589939118995503267516676481141938536269008901607126781291273208629",
+        "19874283200702583165110559932895904979843482162236139561356679724680604144459",
+        "13426632171723830006915194799390005513190035492503509233177687891041405113055",
+        "10582332261829184460912611488470654685922576576939233092337240630493625631748");
+    s.Round(false,
+        "21233753931561918964692715735079738969202507286592442257083521969358109931739",
+        "15570526832729960536088203016939646235070527502823725736220985057263010426410",
+        "9379993197409194016084018867205217180276068758980710078281820842068357746159",
+        "20771047769547788232530761122022227554484215799917531852224053856574439035591");
+    s.Round(false,
+        "20468066117407230615347036860121267564735050776924839007390915936603720868039",
+        "5488458379783632930817704196671117722181776789793038046303454621235628350505",
+        "1394272944960494549436156060041871735938329188644910029274839018389507786995",
+        "5147716541319265558364686380685869814344975511061045836883803841066664401308");
+    s.Round(false,
+        "14583556014436264794011679557180458872925270147116325433110111823036572987256",
+        "11881598145635709076820802010238799308467020773223027240974808290357539410246",
+        "1566675577370566803714158020143436746360531503329117352692311127363508063658",
+        "212097210828847555076368799807292486212366234848453077606919035866276438405");
+    s.Round(false,
+        "7447795983723838393344606913699113402588250391491430720006009618589586043349",
+        "7626475329478847982857743246276194948757851985510858890691733676098590062312",
+        "148936322117705719734052984176402258788283488576388928671173547788498414614",
+        "15456385653678559339152734484033356164266089951521103188900320352052358038156");
+    s.Round(false,
+        "18207029603568083031075933940507782729612798852390383193518574746240484434885",
+        "2783356767974552799246444090988849933848968900471538294757665724820698962027",
+        "2721136724873145834448711197875719736776242904173494370334510875996324906822",
+        "2101139679159828164567502977338446902934095964116292264803779234163802308621");
+    s.Round(false,
+        "8995221857405946029753863203034191016106353727035116779995228902499254557482",
+        "502050382895618998241481591846956281507455925731652006822624065608151015665",
+        "4998642074447347292230083981705092465562944918178587362047610976950173759150",
+        "9349925422548495396957991080641322437286312278286826683803695584372829655908");
+    s.Round(false,
+        "11780347248050333407713097022607360765169543706092266937432199545936788840710",
+        "17875657248128792902343900636176628524337469245418171053476833541334867949063",
+        "10366707960411170224546487410133378396211437543372531210718212258701730218585",
+        "16918708725327525329474486073529093971911689155838787615544405646587858805834");
+    s.Round(false,
+        "18845394288827839099791436411179859406694814287249240544635770075956540806104",
+        "9838806160073701591447223014625214979004281138811495046618998465898136914308",
+        "10285680425916086863571101560978592912547567902925573205991454216988033815759",
+        "1292119286233210185026381033809498665433650491423040630240164455269575958565");
+    s.Round(false,
+        "2665524343601461489082054230426835550060387413710679950970616347092017688857",
+        "13502286133892103192305476866434484921895765252706158317341618311553476426306",
+        "686854655578191041672292972738875170071982317195092845673566320025160026512",
+        "9315942923163981372372434957632152754092082859001311184186702151150554806508");
+    s.Round(false,
+        "17166793131238158480636170455452575971861309825745828685724097210995239015581",
+        "4443784618760852757287735236046535266034706880634443644576653970979377878608",
+        "21470445782021672615018345703580059646973568891521510437236903770708690160080",
+        "6932852445473908850835611723958058203645654625170962537129706393570586565567");
+    s.Round(false,
+        "17078326120157725640173982185667969009350208542843294226397809921509565607842",
+        "19251873001736801921864956728611772738233338338726553113352118847732921831266",
+        "13062907978694932362695258750558734366820802962383346229947907261606619788585",
+        "16576609187793673559170206379939616900133457644695219057683704871664434872406");
+    s.Round(false,
+        "17140499059660867342372156843620845644831519603574612796639429147195776838516",
+        "16226688173010504218547945848523900236290532501559570164276462499487632388445",
+        "2806068123803905806401128967330263340459046260107112845068533446899070326517",
+        "17788735370835052317224182711467216134690146479710634688273650370951230404901");
+    s.Round(false,
+        "9840665370904113434661468973557421114403401847108482949465899631150766783733",
+        "17357287363046228581837055771327121704742940914150998420465281177406182088510",
+        "8956082469997974864521346025916496675956939495318858500685756691488425559998",
+        "10583741436561099911914917245130852199607666337956354910388730829023746895549");
+    s.Round(false,
+        "15241902639811607164983030447109332729761435946009172128089506810551693978973",
+        "10889882303914055687481932975789161945462141459528413507160087442461090813788",
+        "19789561133254944544821898921133697408237804586549835559829396563401674817160",
+        "20741336668287037026472434608739333171202674306575625457456116338034432647230");
+    s.Round(false,
+        "17864073449995977742930566850933082711031717858550870842712972350665650521079",
+        "6017691253505466300212182439349954426085752315661098358839308909771637792741",
+        "5209125836207196173669497054522582922896061838702136844305036341250990710540",
+        "8138726312837322624537330169363664364899441867118983214176695868443641051381");
+    s.Round(false,
+        "15491983986041746833254372934846748393213690608865689646440909282144232382678",
+        "5054332867608171303802774230688792431028169804536607979111644888500809938980",
+        "15427030776591294577308915282298854681562344215287630895931797573417982096417",
+        "21754057982677295571284116502193272661309010996970316384923307174180521790164");
+    s.Round(false,
+        "16265286590463120486705206231835953324076688991892805307349612983237844034032",
+        "17679791107777049796013011282788633179411040182820636236163074053597517790779",
+        "4281652562868629887097957174897458165728741859103571825874408386197225591996",
+        "9168010397863299719604788533602757515513214141450093775967322808686129400625");
+    s.Round(false,
+        "17584182367226175071087689123358883902969885218985589531538416263709138156515",
+        "15671512310414658663135385639435845966109237059155734764323312289873534719186",
+        "10536294659491685326297777845632759824567028904726211134518740400643540109527",
+        "13431319759608247201135260841651365578663315527795431484765940626659812285319");
+    s.Round(false,
+        "9584697124715190200241839387725546204368618031045071660911490086723434692561",
+        "5180327104839158483066851400960171505063442195966219343315555549982472660055",
+        "18888217223053385111625483360538133292128748730565502371803782424772027937822",
+        "19535732913737027522540340630296365525208404217634392013266346283017745945894");
+    s.Round(false,
+        "8577759627886344995887423695190093296190181539234301534326157005220006624466",
+        "16793670928407147476673650839110019799844249677846432113010280456483595763987",
+        "13926032620965299897272071104154310460519723329016284975305942957859374938463",
+        "4794697578055472890255676575927616606591024075768967985031137397587590174501");
+    s.Round(false,
+        "3529566190782060578446859853852791941913086545101307988176595267965876143250",
+        "3975008029239568933166738482470827494289192118694622729549964538823092192163",
+        "17739094873244464728483944474780943281491793683051033330476367597242349886622",
+        "7367136451127531266518046223598095299278392589059366687082785080179161005418");
+    s.Round(false,
+        "11175297939460631138047404082172242706491354303440776362693987984031241399771",
+        "21687543815463985355165197827968086406938428974327951792877419032069230058777",
+        "21156136641989461785420005321350884477682466566148802533375726181416623358719",
+        "17347558768803521970212188258074365309929638984714303299899732035040892048478");
+    s.Round(false,
+        "16293716234695956076322008955071091921491953458541407305955104663269677475740",
+        "4206144021605871396668976569508168522675546062304959729829228403361714668567",
+        "19988050626299122864942213847548542155670073758974734015174045163059179151544",
+        "747972634423324369570795147739377097591383105262743308036321386836856106229");
+    s.Round(false,
+        "4612470951309047869982067912468200581649949743307592869671537990797895413707",
+        "9630852913694079049153027193127278569487291430069466630362958024525616303220",
+        "17941539917430916523930519432495442476511211427972760202450248798031711471474",
+        "20332911350443969653703295317915788278109458962706923653715140186132935894113");
+    s.Round(false,
+        "21764801803055897327474057344100833670291402543384934706514147201527191846513",
+        "18792043166429470991157980448329308661526906138700725174612608941551872082876",
+        "12308177224490762720061048892842527800271687977085172836705858261595655154325",
+        "6234555076867437297776538521925679658360922070165740193866337972293380196151");
+    s.Round(false,
+        "4651047048822067434403056477377459986292934655827821636179452835839127581305",
+        "4762047093602693619418269784972874862577325737690375448572644958129932507374",
+        "12373514879531674477721132062882065826558811149582829246378921774344318418269",
+        "452512704634345955634014968317367844987135264395068376894497483188243356523");
+    s.Round(false,
+        "21642936370936057063268550589361090955573362743817395689260298777690935495218",
+        "16170209200627740434842090607802586195654207376087117044989637541681675086276",
+        "11682826760471401430136435257946377996085824742031456481961511737883954750045",
+        "20628055165039718158878805520495324869838279647796500565701893698896698211929");
+    s.Round(false,
+        "16438375313036818694140277721632185529697783132872683043559674569424388375143",
+        "4855690425141732729622202649174026736476144238882856677953515240716341676853",
+        "11680269552161854836013784579325442981497075865007420427279871128110023581360",
+        "7052688838948398479718163301866620773458411881591190572311273079833122884040");
+    s.Round(false,
+        "10339199500986679207942447430230758709198802637648680544816596214595887890122",
+        "16310974164366557619327768780809157500356605306298690718711623172209302167675",
+        "4572051236178600578566286373491186377601851723137133424312445102215267283375",
+        "20933392620931420860078756859763708025350478446661033451436796955762857910093");
+    s.Round(false,
+        "10145870387395991071594748880090507240612313913083518483680901820696866812598",
+        "11173854866888110108878560284050142518686158431744851782991510385755602063727",
+        "3895357290105797542988795070918100785105415165483657264407967118738833241858",
+        "16358886674154007883356717944805100413481233709808000948036974385803613296849");
+    s.Round(false,
+        "10544067501284177518983466437755150442726536257903869254459488412549270232123",
+        "10495171258604974589451578238018388630585794890815982293891430761424812600427",
+        "13820724103604550843562070971473423552484851063169471886037640613650155173554",
+        "2334954333435579600152488915208745055087482119087065911968347050969338669409");
+    s.Round(false,
+        "15100284614446277058846085121308897497066957549089629374506920751044105723791",
+        "8493821960754696376711287628276980042183127459347650448500304251148421115590",
+        "18612435536889941393944858783110719304584209891406420832295898519317994950798",
+        "362101794940079733974215941991047456600874474038781578925062694203564740952");
+    s.Round(false,
+        "11020033081956343850903875701444955317664141075326494650405276926536449284939",
+        "9396289482656518627529185765935649373549564165735162258912975312413185691167",
+        "6879055176150676925438486069371149089824290576271090206945130252868108043422",
+        "12466610601804566637227883322591924115458766539177061670432424956205788935144");
+    s.Round(false,
+        "6570302110526154075173287644133038486970998888099669190857256824048085590052",
+        "20997862990590350605775941983360263378441519274215787225587679916056749626824",
+        "2642485040919927233352421501444361753154137311893617974318977215281720542724",
+        "18832940311494549247524002614969382413324906834787422940144532352384742506504");
+    s.Round(false,
+        "18751288968473015103659806087408412890105261892140397690496125593160830694164",
+        "13938622158186434739533995447553824444480420613323252752005511269934155122652",
+        "12878982657080117316101160964182202074759312554860119090514406868768962707099",
+        "13757859113119127982418426758782225628393556023865807897214601826218702003247");
+    s.Round(false,
+        "11817871682869491875135867072669251115204978941736982465520516648114811792373",
+        "11336448548896065624515261709306933490181794458266726453198857687608284871020",
+        "194970717714150352477887371297168267861902418496792228400198694925721020795",
+        "4999282817977533227652305360183045040853565298259070645110453061034932285549");
+    s.Round(false,
+        "17094174197873140035316532568922652294881600587639905417701074492648767414173",
+        "8484251464872873032022789624790167173458682056313339863651348894878144808746",
+        "10260366716129057466862964875306868898686918428814373470382979997177852668590",
+        "549263552864476084904464374701167884060947403076520259964592729731619317724");
+    s.Round(false,
+        "10052714818439832487575851829190658679562445501271745818931448693381812170889",
+        "1735373362835209096342827192021124337509188507323448903608623506589963950966",
+        "7998373949540733111485892137806629484517602009122941425332571732658301689428",
+        "9035170288660659483243066011612158174896974797912618405030929911180945246244");
+    s.Round(true,
+        "6458619567307414386633203375143968061892762498463026121155477954682976784731",
+        "12314261817227551876673777186352972884847144237148169773300066404053441924532",
+        "19869454329688183813243851218196625862680921049019496233616575272637276975230",
+        "20326917073492686652690019138603910654692396590122884746951129061818467704300");
+    s.Round(true,
+        "20403270805536666081472738304916561119325397964511536801752236086414818653063",
+        "2865941730880218719188224311916978807415673142487507504983320505748719154068",
+        "20614246027521726470902405957496110178017768563127335842405314212897493119848",
+        "12060194341463088508348622863463208827312128863463014006529428845777217660299");
+    s.Round(true,
+        "1128906798719793375274166820235650701301189774851381709919492584451845983197",
+        "19670876372911656158743764425809421400123168087389888660308456184201759209723",
+        "5647230694522866559497222129254930524469944430191328619422533907417776118543",
+        "318629082509194371490189248876734616088516535434806492900653650176451776632");
+    s.Round(true,
+        "13685970881538585172319228162662520285656571966985351768743970447782846353365",
+        "8283840607829148567836919316142994745766280854211662326632930274668867638198",
+        "8968895518159422029900464138741638511289476298837958524156654785428413265371",
+        "10061801991000917366002570579819627134666386452411986168205986791283562415829");
+    return s.s0;
+}
+
+// State of Poseidon of width 5 (4 inputs): 8 full rounds, 60 partial rounds
+class PoseidonState5
+{
+public:
+    Field s0, s1, s2, s3, s4;
+
+    __attribute__((always_inline))
+    void Round(bool full, const char *c0, const char *c1, const char *c2, const char *c3, const char *c4)
+    {
+        s0 = PoseidonSBox(s0 + Field(c0));
+        s1 = s1 + Field(c1);
+        s2 = s2 + Field(c2);
+        s3 = s3 + Field(c3);
+        s4 = s4 + Field(c4);
+        if (full) {
+            s1 = PoseidonSBox(s1);
+            s2 = PoseidonSBox(s2);
+            s3 = PoseidonSBox(s3);
+            s4 = PoseidonSBox(s4);
+        }
+        Field m0 =
+            Field("16789463359527776692258765063233607350971630674230623383979223533600140787105") * s0 +
+            Field("17179611066821656668705197789232102741366879862607190942874777813024566441829") * s1 +
+            Field("18653277315487164762584377009009109585010878033606596417396490909822722930739") * s2 +
+            Field("7373070639853668650581790286343199505413793790160702463077019294817051722180") * s3 +
+            Field("4823864393442908763804841692709014014130031798360007432734996408628916373879") * s4;
+        Field m1 =
+            Field("19196309854577132760746782449135315310664418272926255500908899397538686486585") * s0 +
+            Field("18123132816088485879885148351452823314623055244145916622592591084094232513914") * s1 +
+            Field("18436594886553181913092702411547018228276047601279727265790147051821171174455") * s2 +
+            Field("15167500404313194506503404655898040457721633218143681920692711693000769735187") * s3 +
+            Field("9437986152015460505719924283993842205604222075968464846270136901243896809793") * s4;
+        Field m2 =
+            Field("21445376105821232747280055223032050399373725161014449207033808524504027971613") * s0 +
+            Field("49684738714301073369749035791061182456037935161360748355432247732088942674") * s1 +
+            Field("9826409059947591908303145327284336313371973037536805760095514429930589897515") * s2 +
+            Field("8494798325496773219358794086647759478982958403252584257436898618394561204124") * s3 +
+            Field("21251937175072447337747316555423152807036003235223125066270735279039060889959") * s4;
+        Field m3 =
+            Field("5539100337780919206842837176908516952801756637410959104376645017856664270896") * s0 +
+            Field("6297628909516159190915174165284309160976659474973668336571577778869958189934") * s1 +
+            Field("12792263637464508665199868777503118105486490400267592501708855807938962470650") * s2 +
+            Field("17254685306085558791725544672172906900581495686070720065168939143671412445514") * s3 +
+            Field("3590396502942934679818900672232030233017710909687947858184099000783280809247") * s4;
+        Field m4 =
+            Field("19055249881366445073616526879263250763682650596233071589085239500077496415637") * s0 +
+            Field("7367697936402141224946246030743627391716576575953707640061577218995381577033") * s1 +
+            Field("1322791522030759131093883057746095061798181102708855007233180025036972924046") * s2 +
+            Field("20456741074925985565499300081580917471340328842103779922028754640077047587707") * s3 +
+            Field("9059147312071680695674575245237100802111605600478121517359780850134328696420") * s4;
+        s0 = m0;
+        s1 = m1;
+        s2 = m2;
+        s3 = m3;
+        s4 = m4;
+    }
+};
+
+__attribute__((always_inline))
+inline Field Poseidon(const Field &in0, const Field &in1, const Field &in2, const Field &in3)
+{
+    PoseidonState5 s;
+    s.s1 = in0;
+    s.s2 = in1;
+    s.s3 = in2;
+    s.s4 = in3;
+    s.Round(true,
+        "6652655389322448471317061533546982911992554640679550674058582942754771150993",
+        "2411464732857349694082092299330329691469354396507353145272547491824343787723",
+        "21491443688002139478732659842894153142870918973450440713149176834049574486740",
+        "20196926676989483530222124573030747187074792043523478381149800153065505592963",
+        "12986278951352369831003505493892366673723882190521699331613883287145355738793");
+    s.Round(true,
+        "21126146258242782643168619000295062005037298340836817770565977031890883232034",
+        "15509665795506578582538177431401381655815033647735781734613703976071034655246",
+        "6989769181472743404364681671283889685042701491627165526899522083327752110839",
+        "7062179885254277466334896166987547257487047183881628199983668518000910197987",
+        "13842521112365108087725039904948872289730786568469683976372377853164252494752");
+    s.Round(true,
+        "3830559505943186272618534143266118508463381443414165428900505002474439179836",
+        "17704863473432653834041116667846189591617394753001613253930974854399793083900",
+        "875580502229441633079974792778818749112423694973231971690365132230865385439",
+        "1971134273535892826573832061354985059300866001765691176219451252512658771248",
+        "4865738840363990164915013008693722144676933915103280504727326977328013515878");
+    s.Round(true,
+        "1148603338028060679975883868174895825055359423662532941509525326937127571764",
+        "17506086433923270253695698017062834613463718526046463655503742220257039588796",
+        "21580033018107258179208198773211859664893072138803756118939260252922297665067",
+        "15411900706973212043830142913959920716501447427702082030760032355626616412240",
+        "12219699506725448409610279620972339448030565224304464695714944121760832152291");
+    s.Round(false,
+        "4525719544192047521328360848269156485222470829314314216955024799558286708479",
+        "19667371373588322336224317159113441765198420040800065314868656839300028747331",
+        "18916925604689704279265158984702141998345424765142129953154245912230835240445",
+        "12789343981741773931665143789673052782408749041041266509485929045869073416222",
+        "3094428508959717445577232225505810354980663487713729230015754183012845687401");
+    s.Round(false,
+        "18544590634480965569098056786078005630500574069468005220462377474861119476492",
+        "20990087440247450018723844204951613913840993427110495085701200965767234569705",
+        "17552251989761134508416634118845221324472178264364440017634233349418103869223",
+        "21000797802575507763447855752602183842956182733750968489641741136166640639409",
+        "19292751508591545849778577901067988044973302547209758604667395356943370737868");
+    s.Round(false,
+        "18314088316445539319869442180584299715533304874169767778761887632882728399870",
+        "15003745150856597539000559910957155642193629735521291045949652201905498569732",
+        "7839443900003691950104175747634267110464104444913379977500178134209666299140",
+        "13568305490393393394812598233983935295266242465548739772708079888867621061127",
+        "6453005227995051361096639028742707098785560656441339640433794156400437698140");
+    s.Round(false,
+        "1420171596348195609536167209221442141824294918625468780931400849866478645240",
+        "8347329128252205996443084339884155586061343024498283583400215109265013719709",
+        "7893774494551056447960817286805128884970061671041428326788899872964096959040",
+        "8970476243368194065341537088653900235777512204874037182428362347342487241690",
+        "239049405935404678508864874854718951364753739466303321590415544572014148257");
+    s.Round(false,
+        "15772878921699764223771017074289335629553777447709755479885293350677783703695",
+        "5416082112919155131434995906647355834510201879607888732259087164602171650389",
+        "4384524908062410354304345761652962203632712291085564157560146286207296352050",
+        "4210984612917608245844011498198864216639269565627982123611519493203177283139",
+        "18816442907032290878644773027005263628136050677095986565400687355912498966559");
+    s.Round(false,
+        "21443510232279945782338486087712914668515437675585863788610958361560172084515",
+        "3234314779308300525339049581669531363375743827111579883853941968586490182859",
+        "11029499234949696730080035941750777601416171837281021031653841244636590396063",
+        "11145210633226924132308292113124660576759662647204939721872338908644906571564",
+        "4583160563963432761409369246361117506465307518522062239686649163525543782173");
+    s.Round(false,
+        "9813992026757562966842771727657080117609486122615087352428596024939855084450",
+        "10084171857039480706430282187972782725948479260179367780776125786119489581409",
+        "3874212709197875589640151274548083098712939093643165182881681226579903752816",
+        "21595542491397091124739711708612983479307589335640792812157875295064235960610",
+        "2068530815441314105493629066002923150651375034543842424822712297257260726954");
+    s.Round(false,
+        "2673459852071215292298131389250564595426361004231758522146794940265552265806",
+        "8591046256746588406353455230465605224309754008961178558834659065898923355164",
+        "1020055192431352394776887540248098706183934464205704158014904833376067287118",
+        "11085709480582865378042656141271006552092494690130782253913953070642865919312",
+        "5673844083530503489429922596812992664928167369104420134641855283771127716005");
+    s.Round(false,
+        "10492199162275168254265892158402955076490959375050993042712629236807564461542",
+        "2280843393156259739329331366624245275580688891778782679394848304764573859886",
+        "6807797027131305026345508953353882265754363485246407959111359919046340709440",
+        "12692191384043938397944633973317584101723715998700063415107128429315536223446",
+        "19818676957110967644349139912613239435706480354664804036688552936554140369382");
+    s.Round(false,
+        "18055602608192644695569077694296748842203151828348990995792087204755925787339",
+        "20934555391215769430553078793246717148484784880715746179415906355043590089450",
+        "11420705181439111353998210442417752592951340005396931802449360401461783159557",
+        "19878854521263746227125001670931867821366047088989510542865511663910116386085",
+        "8568201846715449867087132677683368912214864824182424933182820310911278496552");
+    s.Round(false,
+        "19198701614488576617610339232794062430644024620523684127268879880793305460015",
+        "15262122764244854433806270478871594904740306012582364033343126589996733802868",
+        "6412758421155818207287638337822550233376667015263373809976157264137577776202",
+        "17371585001641430978766734501830788427263945848682170096055857509304472649262",
+        "20262970042379497707724791203314262108784948621691331141565359315001027736581");
+    s.Round(false,
+        "3859750447119748295302212198327542106766447958113540005985799287718502362717",
+        "1172269945800307665458943534144481495673510885455899148864236015097947176746",
+        "8164247467959680477306326470118519335673181279975551434197731340070491876250",
+        "4513977811114181395323888111232002391599397736872779927267726121435887238972",
+        "1075250595927474080680862736233039825365918646878264905022213616210377518447");
+    s.Round(false,
+        "18658420120424372681792175914064174056413842231969276203770574969914576681364",
+        "17769673440848360838244654765103041739044212539359630263894092078288342647801",
+        "4319086204044362848967484441065231939136453667264715596505827197873119273506",
+        "11221173270629292820060668122527062274557317856738971635698169204652845111606",
+        "8635411372759272135249379415383299350267629947167809163276219879514948820576");
+    s.Round(false,
+        "926977621651476360285369760355547766944001783780761167546467658394097283069",
+        "17702143780592866375901805387463459229828093905183622296234691441436877570082",
+        "629612289140842594504574984021125242351317893847688437087866691775821981724",
+        "19990548577495092294245865870717186004301934545721835081514347926537975465539",
+        "7124830628609719908679298707909792306162298058570958688501370177898647946696");
+    s.Round(false,
+        "14620227791860703231425817538142948793892390269806790476396226159679984968174",
+        "18495581997440241868332244230687799183899751339442721677540757155760745277888",
+        "16922065056093401385376103551657968760602009001905886435813054626317776258714",
+        "9969610601962874779035054685661667941954971427956866645694064022029705170229",
+        "15281641269114187762159685323068136816556739502211864119670902056596295644116");
+    s.Round(false,
+        "12114994625438879103001132949163961965524612903017200394727056658298824651596",
+        "4840986177718281128440833017205097196672382395936939379498412745183060615212",
+        "12847307562796769659308999092658905656250954898192781948610713494470441775991",
+        "20290096217351155282642224215178246911041509999959311313223857240001143893317",
+        "16151664509646153154405691138084115125600386733136285504828908979176781265710");
+    s.Round(false,
+        "13848845391482751436287906247470303487958950799995701248612703022979890932133",
+        "6335716166231441585596963683321661194889815181545222079376536449814718259931",
+        "1824302750039354704619545544386637317858342555634601563660279997221547953768",
+        "11327469654081586239268713126961534952233559223228327222485848924908493444712",
+        "10077703415170135154603829433031861799853903739210136452726077323833067256620");
+    s.Round(false,
+        "16368073884579385814331927334821006319227867093692644942500207970751483237405",
+        "10621580796499573269115131164341885791299038227955222944695715163010783205295",
+        "2099241376651019397894434242565225315652133572870234550073686122343103853816",
+        "17104632243449417396641550271977294699471083572885397875525767745512335891599",
+        "1935453754847256492223646005402770357836971113012418013930273797463411526183");
+    s.Round(false,
+        "7492761611332930896292052363224494314920390056637668407353957465667515477934",
+        "16836705924460095689555600825174696605443212968244843485187771119291716736958",
+        "16995495500678141665340056658079449793587669420913589967848082091551329904176",
+        "16097379973857697753436437302681608056543122759719328497348770844548177814262",
+        "17476569537128329379528694049566216604638194592812108658767104922628767500420");
+    s.Round(false,
+        "17997217989870184804787026924935938133194070033518938653831611194683423549591",
+        "17573343771046232580761295935281170028624495346579002725814597714902588657750",
+        "2450087639204541254902859018960918562514681200270997307467560465282168310665",
+        "17288084325555056222618040923753050382954155896826087372317882602328092535440",
+        "21837047676579063581498107773514419735425738753079336764356909012851439336687");
+    s.Round(false,
+        "370061273472837873736743292149368449614309676635341873070086681342317566380",
+        "420725183996224279379885018872359102189091670793820517618337092091910692771",
+        "4966571645678139143731798992823327185758562224229132271884647901363447388530",
+        "5039558223429273757296118284876763395391635773837549121798873235133698166026",
+        "14663152729953724779401067486012084029581847325524052152795817923033297673686");
+    s.Round(false,
+        "7201040456590575809960214033959496417566605177095808543357813677845263237276",
+        "16872945504528960415453618286121813996587432836152082188694652370255998768595",
+        "4914824783780909279212078186433590922437371437384817332713271291839616026466",
+        "17503018483514413315464207189113334433424965178631599286655188843769810245465",
+        "4087750571011463387872022799241315348852213278729592692674275176152296405923");
+    s.Round(false,
+        "4006961923780091252337105595934918049936238157468198971234322013673884171131",
+        "4481908842184366902145805444001507554481032302978790080019710161108326487967",
+        "13532316826436461968093937893872910736305115143550039673102602344678825540956",
+        "11602986656925867325907196773754426955346837006705269228226729102186031417465",
+        "15306992574062791537454541745213815567999895856471097922112648012979731636068");
+    s.Round(false,
+        "4497571735611504561173050536899411999551839050319538712220770383407135602945",
+        "2571242673174714867278075260451133687893879636121064640779554188161591611843",
+        "7070272070524747733177730083966686149849667613589868731851816020060781720851",
+        "1308310289745495626002351437755820460104812708071634598163946330870933261232",
+        "9483468192990391193401121929514821570714432121414330663623018046165053411090");
+    s.Round(false,
+        "7317568349845215930675847155716598288688799068821709820024570206796617676748",
+        "1918505733423704616434273602054555051755671749253598966287072464475922854850",
+        "15158168161084905689406532256983805923258003804476527617207287404280855731962",
+        "6855540174355511438343304861678411868002455139032857270673849263857877330771",
+        "5989863238360846166935911112885654223487221280254816980802479355446167746774");
+    s.Round(false,
+        "20283337058688740322296928691341300752003492063748410749625272920572074851396",
+        "18957132189629332408653055312790838576277703952267542471751593810468444454136",
+        "15764518568966520670995753676429154315765754748131847346608706222194564055358",
+        "7192524197002826721654253762628934164676539329903087107420445743247046038858",
+        "142950766663597487919643890566358241353679421113406309294925836697585309311");
+    s.Round(false,
+        "15012262168187689680572958978610204856600235635916074406168861726626292993057",
+        "20795666834671497603181209610179324236645779324677512349797033323222380300794",
+        "12650341271833683789775531792948185319868795529390391267833516836256688318306",
+        "5597700232877580665749288204589530549415282468176625525368428476461504532052",
+        "20949303924691159143653175365242293984396858344688574262804199947001630916385");
+    s.Round(false,
+        "10746523145835332938672833282581864816136388045771578294905302886974358762209",
+        "4998982766221590779170630035756820066555357949247521575936385387288356143784",
+        "6936999580131731861735955554005106460473097800566952971315565150681540640020",
+        "6670695360676548472482680016233507548657051302712214051977034166870814430578",
+        "12210816592786563975173850937247594401582085430897698766795696447223454826466");
+    s.Round(false,
+        "14933901149105284237676334791785996160108290333321693498322435129559137152007",
+        "3848529433916624869590379003597911090976938589461403388133685310398004369431",
+        "12778805225074604003024964969486878839359935515509480774809299341511161183802",
+        "3288267180428684202786697419666969564766921974531343432588030535602163038467",
+        "1272672432174256751826350693883913844502039730140570583479554071765667798207");
+    s.Round(false,
+        "21130828804874452930669244946376257892693846272313548250936991077452679117587",
+        "21254559353072473881932828401787134230282801383134765683324465204971002861493",
+        "4116075860631781527931204624078712926526805345818156200756399332393348685924",
+        "17435888597009729827411190999389277840088354756277916760187756022854497211746",
+        "15837398163415665169712832984380121382150588321621493928953938599666110830812");
+    s.Round(false,
+        "17988638446757562417082379159769772097890681265659458369075768452342579854303",
+        "8144561030363576879343874888624208577604401139613622673042754207987577727758",
+        "20020299925602421262203305284307419339160247406220693128040712457114283033661",
+        "2945951415037890626891130390523013930737768652394758977777336357159436605764",
+        "1505954324723537402640844232704189835623922400329086438898375859826553573763");
+    s.Round(false,
+        "11851584491756305117491374581845512067704002072833714119284164514457248861803",
+        "14471204965036278214508938537949717553799007630471016532866101610339050785912",
+        "7163557293233604902868673807221391042191134560333950452577270522828534690707",
+        "17291625782465108601367695465389799786592304061550212130987221355832952230827",
+        "10240907112109243116543462081552827576656826251172050843989873656917271396422");
+    s.Round(false,
+        "20702261919346727858635106264046787321170414155594199951578791234276181642650",
+        "16678253307828004252292273162411388452019952018258857370242272543091326285541",
+        "19810917631941180098047817620026253706643400683524412974923209268916769874447",
+        "3357220165225360610202375608872621445880880830154732998557832689480921421791",
+        "4392285438534542495332422274902727975330102148971785438164412161504066619105");
+    s.Round(false,
+        "14642025133729666610167675086855441462580619607677226879159952689184960379911",
+        "18142623439987890999821892559271093087005885278955082040377769578204898750505",
+        "11769399023330099592616157336702104329646487200891911089287290893650532639221",
+        "7261353756299584174448625214367175510387913706095214313669922259027644778060",
+        "10406994568199070863112470594593301582798997458844791396920771226539013327304");
+    s.Round(false,
+        "7475277967562870216712397220016587384793504784585573136176313471517144184018",
+        "9598064630327104406929367986473441777975480987434868213697837347643980267620",
+        "21137410002545951849752865514437404724653771608225272412595423069852350320648",
+        "12345612867231779996383303763804719815752861524077922121654106906093103051400",
+        "16461750199070055335468534730937701659470268635084522644824623393184528879703");
+    s.Round(false,
+        "7829250842543018165409887731515254191943527926556191989558018633300783421935",
+        "19801151644322693878208767560968285812646931156576102755771403150148125880648",
+        "808770634664491371274943928223981161442027957963181999892266696287962813461",
+        "2298122748772261447929855283951027113218922003687701626762072351622993276571",
+        "17407798064458858450209051887305178872029674498718760624162479511390762310526");
+    s.Round(false,
+        "18585562277464562541666582720366573863334618817908062612923861658144918595030",
+        "733976598693219656339731904831283238690050114241501938501377743874139460889",
+        "11316063986696838098122262534148335669847478050407756877728672233736962269417",
+        "17614529714381496379478130066245111825610297227468263851608027100133421612826",
+        "12110694197729365219340374599835523099651939156213930558791147158357810646901");
+    s.Round(false,
+        "4337343008663255658976574468931581484970687989356019720784093082313510905405",
+        "1379188959674402095268172673987199124815512095460112504778179157481327937561",
+        "3116148242507754420428768481157196067508084836097458698846114802493377512591",
+        "13306507137873332434793374848948087993544118494881134631519748904811343155566",
+        "18496878480807017010077624766326681523549495609998881196570603040242554712562");
+    s.Round(false,
+        "3940126764022508707486095199473913866137718790062498893812401335738707507732",
+        "10030078765792498033316282784150304209584388923549357286679864120250994473810",
+        "18519871685760382462428068450331593474924737719734568498029727699878543899254",
+        "12599428893576891013523136950822667754415283296587096197120138265392279834128",
+        "16038578953099895530943034305356008247313649524436132877362941968861459073483");
+    s.Round(false,
+        "14319233878082524834510736727226054073026413911339853399113450188859080424272",
+        "13710161613540579690732775978855380876556751245265568031703536595040993113748",
+        "14958726446649273856607176275240008023824615720456760403465034344703779274727",
+        "20935428111942360630758629263346308597806819928838924586682307174931367773605",
+        "5826394436548487315966647466017047216786257295199620110266250301500717796281");
+    s.Round(false,
+        "31401797997389676486806123612280306684597605608110075525648021056710776011",
+        "10784171495708237485952707518956314344821522727746927291389338644844400581452",
+        "11604345371765580191117799693565193618158448665352599382713281103552305960442",
+        "1378145039624937931836538950217364481423707761527018494355648047365613434790",
+        "10284294167221806561993937798090888689421933711157676807977401896199778472860");
+    s.Round(false,
+        "8233695574758520342808807499924062869636681352769371531557726871630696672029",
+        "6570581391072134029876349038190171593169496519436674767949949730275868319732",
+        "4026501263908027819614805027945064360196399012004574117767831931274788631138",
+        "21091098569404004244061462065218203986433580687172854429523306262593782053656",
+        "20711772916118045406356429185975897495222240215931761100801599257137350834799");
+    s.Round(false,
+        "3165519312799351250309462589160165591299333587158531489859211268084164422251",
+        "16470663723473939739601217501478624726068461799539012562455639586886033078064",
+        "15672299304945968727435591100602007503785845873606917887638890765525875123857",
+        "21393538327627889838198844493522533627143658125568123117776524944297103649079",
+        "7688819203734248199049004650451546300187194458173935784579101984183800649342");
+    s.Round(false,
+        "6609663518412297884695057080546416278366560290439222127471462938252865438638",
+        "3476303650597281786976907813110835564442121684386467570637538230409080744769",
+        "20633582549754495054832414039299188930065286005370053173386561254823483851717",
+        "18067076834611402459142612082327591538480657933568191619109271502102126814407",
+        "157209609820117793892254328219308970217366919934739036156851508233236414461");
+    s.Round(false,
+        "1848396116513925340973398423998379465460554039715233953825786874352442451413",
+        "188642786730195655565401615804782553245486295156304142809552609651873793325",
+        "540089254487190924787439362270708251103955915909358626209177199653451469720",
+        "12796274768956950589847157187031845061404119522843128177103898080653493269942",
+        "1785666356337148874573621868025910291826158842346617719666738769156993598966");
+    s.Round(false,
+        "20649919247042517528354490854561347316237285929352042389729444382153378749538",
+        "9568390566108569727471722677925269460696523515877621230569682954652430518787",
+        "8590683334740232786825518158771304803451657249486419816607179533515442407283",
+        "9321198393538172042803957409292145345834077448228642847843261373640165958582",
+        "3651905214805616378360839954289447530035139753215923648216350128870943481828");
+    s.Round(false,
+        "1324345422558073117779462079218851558068746895262914344818945294328678893083",
+        "6666363895154434021620869731925915051086919707989020578203743660669796175288",
+        "9850757893972463103359995012900314323213006625927501272997539940766979170137",
+        "10214293226445704940138790188111862069675188797488928722469679760666574484266",
+        "16862124085118494177559484642483513597285992646267864845521573612482278871023");
+    s.Round(false,
+        "9172340118369291059693735314505606817316211450324955429310200429408035954801",
+        "1968992755714619414656181112336357119271845800144345284299978250769356388249",
+        "17192498940296212027365280042755701662136570107224000496521552617655679821443",
+        "10063385968535643122430064779260670089120686456635080613693015398478175344193",
+        "20101961459945738562625328882763768836449780661345042148985756598106706734632");
+    s.Round(false,
+        "12704305975772252539534386080950631076046431529894091327218544197389260775334",
+        "3008242816727585639441748210631464697850194693570485141354082562181236010097",
+        "7797705698071555811456747812384107102104184812467361013142453143842134807658",
+        "19323240331433203844038522035479659453946066968727795017745942269828428751105",
+        "1698137797127320576751729191866734754105401103859852376273763815257758421427");
+    s.Round(false,
+        "17656850887825900397821271738817912328294075224643535784810269137125067875996",
+        "20755447986835730799031196367323817361150623932048563112034040627213597261325",
+        "6221130271964372280138992636208062417325313096379273438539556580491430711297",
+        "11042709376363248213366896208587241517252100440844476816212498352999929578287",
+        "987361321094619571176752720390429919723900732295551211263814448408232028205");
+    s.Round(false,
+        "15077982986114392945859048373768437818569856001604485167476360943078774679228",
+        "6278894644165961404521866714059972066255652200107181684047812674333675794053",
+        "2649747800006903047073625320829560088088800522557851927539477888486006072675",
+        "2636278052351769676017824297717609512488651850924228608531372135635042762078",
+        "816232991472315395984098922575496846552245086608787214581606973359616326446");
+    s.Round(false,
+        "14372687274434205592004117128588852491871014819273428668840779210928924573820",
+        "7351401720390274950322621121981079413650308506660552567079785209176949174210",
+        "10275293929161727274572318228903710245677747557851999483919909420098936352013",
+        "14869686444606195206734119702227763209172799407142930791211203702643805341518",
+        "937617196362766626935279232045712623531859540210120280128165029613358941709");
+    s.Round(false,
+        "21331527351771920568751070369057714014285398281585036009305608379072813379081",
+        "4305436470381074948146072259605215282335211631970525440530773004228212378618",
+        "5894273721571292784412707230481346442881109207745969297947253583203466014760",
+        "6512250441044591603946512492071171861967500633638753443182294740883123881284",
+        "20863871952569294813936866452848141274047362082838805921071316386912981651979");
+    s.Round(false,
+        "18788566662709810970880679984141390717017951403407913908833463086244783373013",
+        "7784927597396249543149135503684024377171301321636804832597181795981969626201",
+        "13818519831569592521516488188127966399245767953522268350556654747680372036664",
+        "10515208647860053151690062640705322684876580250632027862984821874343071549235",
+        "797604926079325807488629085866693514275115789253871397971708541758696512985");
+    s.Round(false,
+        "8741784289526985522570446847275649913333939699807282742190607491216732972386",
+        "20966712704043418981047968701828936463778140093909973286855779694780086635828",
+        "11359697297415630167449040380538108774924967116147664240213257348125754475868",
+        "8070907838094569287067982462230761680706116783989613960066342967469297961118",
+        "1868550288036217638713133945402464194193242298015503906068429633793800456561");
+    s.Round(false,
+        "198709459347510170000840600179608479136663571567208109852828485236018304733",
+        "1601154135701845545733926027872374554514541574822026314034696802419388627041",
+        "4363994778006302991481199477873248350039564117453810275561422974475581105893",
+        "773054378219982710451611471050404495804413666789496412742983455527754059148",
+        "5209426340109575519362014651321132459061755868557415513439993327176584352934");
+    s.Round(false,
+        "16124961412020675839394907565568143713078242978522632778625312854364651991011",
+        "20812496670075231301471694692369245988519082317145989298573032859079075730004",
+        "3312489967581906638742585802390894285073229440039144559060030129184388053832",
+        "2967475373447822846542676378804990140732835322255774209561143670843223463335",
+        "19744585401442299381952694102570931935735276268739851233412754166721728873141");
+    s.Round(false,
+        "20026293345566344685499234599699178313754630774489046573312844763673073616936",
+        "2611303659034102517884318354550433047021831422518437228002960700934925644951",
+        "6230291832603218406134986471162106408091661326026848531605999413028246206577",
+        "9126162046556730019959291776456914453189657463686708035601186672661595109020",
+        "18827736146609035067773173111376739253733288103277133456626928961785293662143");
+    s.Round(false,
+        "2328703958261360872869074208611873245571971231035163763965210852182760438390",
+        "13796410059666172174899788866809560044715551934510722965495280798363043241416",
+        "1593663256684781552813616365605526150610454082601584196604084376715746899324",
+        "1565874145189898288764434737762721576951043839540107044892767693968417810945",
+        "8709849304563896945461696717753976956465219721409993781555147204068634555572");
+    s.Round(false,
+        "2994256803561260177499267243802460581941891553208150783951937342406846377191",
+        "10452746656507347152042187616753027475507881362159944564077673851918869542550",
+        "20130580998875572619695450234900655050996104101008767761546912649074040426200",
+        "18926933358104691474037431437316089682088433006245222723356764715400831411716",
+        "3783551594057498940671877156409957274854990650480535806320220142873170375307");
+    s.Round(true,
+        "7919031943604095374667473717154511882451510130166237539514111182596247372692",
+        "14518552587329209714850286012780632801030157943402419401997576700600952906519",
+        "4770764028263701271241862755569969531641408032906982530346384375773459918490",
+        "10866502826034731763529371496585294375373238783964914673031891984092997621879",
+        "4234148117462322266937279401468367908013627589417699250592523530383852950379");
+    s.Round(true,
+        "10747942066055887965185603234524367638106812660210378090215017248140719240336",
+        "2587411532912868255102795810490361867789634574022411742057853375399270197531",
+        "17350061113113681344498080520518808976916692173267298878258722510332360424059",
+        "16490282364669098969805528215926442920328903121380947471680517193373377657129",
+        "9274691782659584680377375192682066090127280485689527337429804211265749864190");
+    s.Round(true,
+        "7630965482352419767782717986075793694403609453648729580916814032587325374653",
+        "9483872310024003776681196467845329825094379763716541754956796450187787638623",
+        "12182966986735661215639970080491757244218854808156498220088212871061979325833",
+        "1853790963611367149183440339188924598268644281518961106776656221408171642714",
+        "17425077915972423995335545370701802959607559878032910147159424242864219303096");
+    s.Round(true,
+        "14571075346526399549826264845894977639678567831720652860528738036970272895919",
+        "5627701855249158721927849603102149698163511782011562166637339712383551336091",
+        "3620805686755372260289125555061886982808014642356719556961142525373021656729",
+        "11556995641752009899073583627136467840237831247117281278719511600076965602980",
+        "18960242154096055221658318882298412299294886669455506299567210308762501113202");
+    return s.s0;
+}
@@ -0,0 +1,203 @@
+// Native implementation of nagai.h, over GMP.
+//
+// isekai turns the nagai_* functions into gates; linking a program with this runtime instead runs
+// it natively, e.g. to compute the outputs of an outsource() function much faster than by evaluating
+// its circuit, or to check the circuit against it.
+//
+// The prime is the scalar field of bn128, as in isekai by default. It can be changed with the
+// NAGAI_PRIME environment variable: 'bn128', 'edwards', 'ristretto' (the fields of src/r1cs/r1cs.cr),
+// or a prime in base 10.
+//
+// Values are kept reduced in [0, p): their limbs are their bit decomposition, so nagai_getbit and
+// nagai_lowbits read them directly and the 'split' is never redone. Nagai values are immutable, so
+// nagai_copy only takes a reference; the handles come from a pool and keep their limbs when freed.
+// The runtime is not thread-safe.
+
+#include "nagai.h"
+#include <gmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static_assert(sizeof(unsigned long) == sizeof(uint64_t), "the runtime expects 64 bits longs");
+
+struct Nagai
+{
+    mpz_t value;
+    uint64_t refs;
+    Nagai *next_free;
+};
+
+namespace {
+
+struct Runtime
+{
+    mpz_t prime;
+    // scratch space of mul and div
+    mpz_t tmp;
+    Nagai *free_list = nullptr;
+    std::vector<Nagai *> chunks;
+    Nagai *zero;
+    Nagai *one;
+
+    static const size_t kChunkSize = 1024;
+
+    Runtime()
+    {
+        const char *p = getenv("NAGAI_PRIME");
+        if (!p || !*p || !strcmp(p, "bn128"))
+            p = "21888242871839275222246405745257275088548364400416034343698204186575808495617";
+        else if (!strcmp(p, "edwards"))
+            p = "1552511030102430251236801561344621993261920897571225601";
+        else if (!strcmp(p, "ristretto"))
+            p = "7237005577332262213973186563042994240857116359379907606001950938285454250989";
+        if (mpz_init_set_str(prime, p, 10) != 0 || mpz_cmp_ui(prime, 2) < 0) {
+            fprintf(stderr, "nagai: invalid NAGAI_PRIME '%s'\n", p);
+            abort();
+        }
+        mpz_init2(tmp, 2 * mpz_sizeinbase(prime, 2));
+        // the bits returned by nagai_getbit are shared; their reference is never released
+        zero = alloc();
+        one = alloc();
+        mpz_set_ui(one->value, 1);
+    }
+
+    Nagai *alloc()
+    {
+        if (!free_list) {
+            Nagai *chunk = static_cast<Nagai *>(malloc(kChunkSize * sizeof(Nagai)));
+            if (!chunk) {
+                fprintf(stderr, "nagai: out of memory\n");
+                abort();
+            }
+            chunks.push_back(chunk);
+            const mp_bitcnt_t nbits = mpz_sizeinbase(prime, 2);
+            for (size_t i = 0; i < kChunkSize; ++i) {
+                mpz_init2(chunk[i].value, nbits);
+                chunk[i].next_free = free_list;
+                free_list = &chunk[i];
+            }
+        }
+        Nagai *n = free_list;
+        free_list = n->next_free;
+        n->refs = 1;
+        mpz_set_ui(n->value, 0);
+        return n;
+    }
+
+    void release(Nagai *n)
+    {
+        if (--n->refs == 0) {
+            n->next_free = free_list;
+            free_list = n;
+        }
+    }
+
+    // Reduces n->value, which may be negative or not less than p
+    void reduce(Nagai *n)
+    {
+        if (mpz_sgn(n->value) < 0 || mpz_cmp(n->value, prime) >= 0)
+            mpz_mod(n->value, n->value, prime);
+    }
+};
+
+Runtime &runtime()
+{
+    static Runtime rt;
+    return rt;
+}
+
+} // namespace
+
+Nagai *nagai_init_pos(uint64_t x)
+{
+    Runtime &rt = runtime();
+    Nagai *n = rt.alloc();
+    mpz_set_ui(n->value, x);
+    rt.reduce(n);
+    return n;
+}
+
+Nagai *nagai_init_neg(uint64_t x)
+{
+    Runtime &rt = runtime();
+    Nagai *n = rt.alloc();
+    mpz_set_ui(n->value, x);
+    mpz_neg(n->value, n->value);
+    rt.reduce(n);
+    return n;
+}
+
+Nagai *nagai_init_from_str(const char *s)
+{
+    Runtime &rt = runtime();
+    Nagai *n = rt.alloc();
+    if (mpz_set_str(n->value, s, 10) != 0) {
+        fprintf(stderr, "nagai_init_from_str: invalid argument '%s'\n", s);
+        abort();
+    }
+    rt.reduce(n);
+    return n;
+}
+
+Nagai *nagai_copy(Nagai *n)
+{
+    ++n->refs;
+    return n;
+}
+
+Nagai *nagai_getbit(Nagai *n, uint64_t pos)
+{
+    Runtime &rt = runtime();
+    return nagai_copy(mpz_tstbit(n->value, pos) ? rt.one : rt.zero);
+}
+
+uint64_t nagai_lowbits(Nagai *n)
+{
+    return mpz_getlimbn(n->value, 0);
+}
+
+Nagai *nagai_add(Nagai *a, Nagai *b)
+{
+    Runtime &rt = runtime();
+    Nagai *n = rt.alloc();
+    mpz_add(n->value, a->value, b->value);
+    if (mpz_cmp(n->value, rt.prime) >= 0)
+        mpz_sub(n->value, n->value, rt.prime);
+    return n;
+}
+
+Nagai *nagai_mul(Nagai *a, Nagai *b)
+{
+    Runtime &rt = runtime();
+    Nagai *n = rt.alloc();
+    mpz_mul(rt.tmp, a->value, b->value);
+    mpz_mod(n->value, rt.tmp, rt.prime);
+    return n;
+}
+
+Nagai *nagai_div(Nagai *a, Nagai *b)
+{
+    Runtime &rt = runtime();
+    if (mpz_invert(rt.tmp, b->value, rt.prime) == 0) {
+        // the circuit cannot be satisfied either
+        fprintf(stderr, "nagai_div: division by zero\n");
+        abort();
+    }
+    Nagai *n = rt.alloc();
+    mpz_mul(rt.tmp, rt.tmp, a->value);
+    mpz_mod(n->value, rt.tmp, rt.prime);
+    return n;
+}
+
+bool nagai_nonzero(Nagai *n)
+{
+    return mpz_sgn(n->value) != 0;
+}
+
+void nagai_free(Nagai *n)
+{
+    if (n)
+        runtime().release(n);
+}
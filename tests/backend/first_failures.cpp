@@ -0,0 +1,128 @@
+// Checks skR1CSCheck::FirstFailures (lib/libsnarc/src/R1CSCheck.hpp) against a sequential scan:
+// for several sets of failing constraints, numbers of threads and values of k, the first k failures
+// must be found, in order. Built by first-failures-test with -fsanitize=thread.
+#include "R1CSCheck.hpp"
+#include <random>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+static void check_failed(const char *expr, const char *file, int line)
+{
+    fprintf(stderr, "CHECK(%s) failed at %s:%d.\n", expr, file, line);
+    abort();
+}
+
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            check_failed(#expr, __FILE__, __LINE__); \
+        } \
+    } while (0)
+
+// Integers modulo a 61-bit prime, enough of a field for the check
+struct Mod61 {
+    static const uint64_t P = (uint64_t(1) << 61) - 1;
+    uint64_t v;
+
+    Mod61(uint64_t x = 0) : v(x % P) {}
+
+    Mod61 operator*(const Mod61 &o) const
+    {
+        return Mod61(uint64_t((unsigned __int128) v * o.v % P));
+    }
+
+    bool operator==(const Mod61 &o) const { return v == o.v; }
+};
+
+// n constraints a*b = c, where c is off by one for the failing ones
+struct Constraints {
+    std::vector<uint64_t> a, b;
+    std::vector<bool> fails;
+
+    Constraints(size_t n, const std::vector<size_t> &failing, unsigned seed)
+        : a(n), b(n), fails(n, false)
+    {
+        std::mt19937_64 rng(seed);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = rng();
+            b[i] = rng();
+        }
+        for (size_t i : failing) {
+            fails[i] = true;
+        }
+    }
+
+    void row(size_t i, Mod61 &x, Mod61 &y, Mod61 &z) const
+    {
+        x = Mod61(a[i]);
+        y = Mod61(b[i]);
+        z = x * y;
+        if (fails[i]) {
+            z.v = (z.v + 1) % Mod61::P;
+        }
+    }
+
+    std::vector<size_t> first(size_t k) const
+    {
+        std::vector<size_t> r;
+        for (size_t i = 0; i < fails.size() && r.size() < k; ++i) {
+            if (fails[i]) {
+                r.push_back(i);
+            }
+        }
+        return r;
+    }
+};
+
+static void check_case(const char *name, size_t n, const std::vector<size_t> &failing, unsigned seed)
+{
+    const Constraints cs(n, failing, seed);
+    auto row = [&cs](size_t i, Mod61 &x, Mod61 &y, Mod61 &z) { cs.row(i, x, y, z); };
+    const size_t ks[] = {1, 2, 10, 1000, n + 1};
+    const unsigned threads[] = {1, 2, 3, 8, 0};
+    for (unsigned t : threads) {
+        skR1CSCheck::SetThreads(t);
+        for (size_t k : ks) {
+            const std::vector<size_t> found = skR1CSCheck::FirstFailures<Mod61>(n, k, row);
+            if (found != cs.first(k)) {
+                fprintf(stderr, "%s: n=%zu k=%zu threads=%u: wrong first failures (%zu found, %zu expected)\n",
+                        name, n, k, t, found.size(), cs.first(k).size());
+                CHECK(found == cs.first(k));
+            }
+        }
+    }
+    printf("%s: n=%zu failures=%zu ok\n", name, n, failing.size());
+}
+
+int main()
+{
+    // one block of the check is 1024 constraints
+    check_case("satisfied", 20000, {}, 1);
+    check_case("empty", 0, {}, 2);
+    check_case("first", 20000, {0}, 3);
+    check_case("last", 20000, {19999}, 4);
+    check_case("block edges", 20000, {1023, 1024, 2047, 2048, 10239, 10240}, 5);
+    check_case("one partial block", 700, {3, 500, 699}, 6);
+
+    std::mt19937 rng(7);
+    std::vector<size_t> sparse, dense;
+    for (size_t i = 0; i < 50000; ++i) {
+        if (rng() % 997 == 0) {
+            sparse.push_back(i);
+        }
+        if (rng() % 3 == 0) {
+            dense.push_back(i);
+        }
+    }
+    check_case("sparse", 50000, sparse, 8);
+    check_case("dense", 50000, dense, 9);
+    // the failures are all in the last blocks, which the threads reach last
+    std::vector<size_t> tail;
+    for (size_t i = 45000; i < 50000; i += 7) {
+        tail.push_back(i);
+    }
+    check_case("tail", 50000, tail, 10);
+    return 0;
+}
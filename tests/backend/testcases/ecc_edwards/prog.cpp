@@ -0,0 +1,39 @@
+#include "babyjubjub.hpp"
+
+struct Input {
+    uint64_t k;
+};
+
+struct Output {
+    uint64_t fixed_x;
+    uint64_t fixed_y;
+    uint64_t mul_x;
+    uint64_t mul_y;
+    uint64_t ladder_x;
+    uint64_t ladder_y;
+};
+
+extern "C" {
+    void outsource(struct Input *, struct Output *);
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    EdwardsCurve curve = BabyJubjub();
+    EdwardsPoint base = BabyJubjubBase(&curve);
+    Field k = input->k;
+
+    EdwardsPoint fixed = BabyJubjubMultiplyBase(k, &curve);
+    output->fixed_x = static_cast<uint64_t>(fixed.x);
+    output->fixed_y = static_cast<uint64_t>(fixed.y);
+
+    // (k mod 2^33) * 3B
+    EdwardsPoint p = base.Double().Add(base);
+    EdwardsPoint mul = p.Multiply(k, /*nbits=*/ 33);
+    output->mul_x = static_cast<uint64_t>(mul.x);
+    output->mul_y = static_cast<uint64_t>(mul.y);
+
+    EdwardsPoint ladder = p.Ladder(k, /*nbits=*/ 33);
+    output->ladder_x = static_cast<uint64_t>(ladder.x);
+    output->ladder_y = static_cast<uint64_t>(ladder.y);
+}
@@ -0,0 +1,51 @@
+#include <string.h>
+
+struct Input {
+    int a;
+    int b;
+};
+
+struct Output {
+    int x;
+    int y;
+    int z;
+    int w;
+};
+
+struct Point {
+    int x;
+    char tag;
+    short y;
+    int *ref;
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    // initialized by a copy of a constant global
+    int table[6] = {3, 1, 4, 1, 5, 9};
+    // initialized by a memset
+    int zeros[40] = {0};
+
+    struct Point p = {input->a, 'p', 2, &table[2]};
+    struct Point q;
+    struct Point r = {0};
+    // struct copies
+    q = p;
+    memcpy(input->a < input->b ? &q : &r, &p, sizeof p);
+    q.x += 1;
+
+    int copy[6];
+    memcpy(copy, table, sizeof table);
+    memmove(copy + 1, copy, 3 * sizeof(int));
+
+    memset(zeros + 2, 0xff, 2 * sizeof(int));
+    unsigned char bytes[4];
+    memset(bytes, input->b, sizeof bytes);
+    int words[2];
+    memset(words, input->b, sizeof words);
+
+    output->x = p.x + q.x + r.x + q.y + r.y + *q.ref + (r.ref == &table[2]);
+    output->y = copy[0] + copy[1] * 10 + copy[2] * 100 + copy[3] * 1000 + copy[4] * 10000 + copy[5] * 100000;
+    output->z = zeros[0] + zeros[1] + zeros[2] + zeros[3] + zeros[4] + zeros[39];
+    output->w = bytes[0] + bytes[3] + words[1] + q.tag;
+}
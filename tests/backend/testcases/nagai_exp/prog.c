@@ -0,0 +1,19 @@
+#include "nagai.h"
+
+struct Input {
+    uint64_t a;
+    uint64_t b;
+};
+
+struct Output {
+    uint64_t x;
+    uint64_t y;
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    Nagai *a = nagai_init_pos(input->a);
+    Nagai *b = nagai_init_neg(input->b);
+    output->x = nagai_lowbits(nagai_exp(a, nagai_init_from_str("41"), /*limit=*/ 7));
+    output->y = nagai_lowbits(nagai_add(nagai_mul(a, a), b));
+}
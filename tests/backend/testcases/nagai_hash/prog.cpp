@@ -0,0 +1,42 @@
+#include "hash.hpp"
+
+struct Input {
+    uint64_t a;
+    uint64_t b;
+    // position of the leaf in the Merkle trees (of depth 3)
+    uint64_t index;
+};
+
+struct Output {
+    uint64_t poseidon1;
+    uint64_t poseidon2;
+    uint64_t poseidon4;
+    uint64_t mimc7;
+    uint64_t mimc_hash;
+    uint64_t merkle_poseidon;
+    uint64_t merkle_mimc;
+    uint64_t verified;
+};
+
+extern "C" {
+    void outsource(struct Input *, struct Output *);
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    Field a = input->a;
+    Field b = input->b;
+    Field index = input->index;
+
+    output->poseidon1 = static_cast<uint64_t>(Poseidon(a));
+    output->poseidon2 = static_cast<uint64_t>(Poseidon(a, b));
+    output->poseidon4 = static_cast<uint64_t>(Poseidon(a, b, a + b, index));
+    output->mimc7 = static_cast<uint64_t>(MiMC7(a, b));
+    output->mimc_hash = static_cast<uint64_t>(MiMCHash(a, b));
+
+    Field siblings[3] = {b, a + b, a * b};
+    Field root = MerkleRoot(a, siblings, index, 3);
+    output->merkle_poseidon = static_cast<uint64_t>(root);
+    output->merkle_mimc = static_cast<uint64_t>(MerkleRoot<MiMCHasher>(a, siblings, index, 3));
+    output->verified = MerkleVerify(root, a, siblings, index, 3);
+}
@@ -0,0 +1,29 @@
+#include "nagai.h"
+
+// The Nagai fields are field elements in the circuit; natively, the boilerplate reads them with
+// nagai_init_pos() and writes their low 64 bits.
+struct Input {
+    uint64_t k;
+    Nagai *x;
+    Nagai *y;
+};
+
+struct NizkInput {
+    Nagai *w;
+};
+
+struct Output {
+    Nagai *sum;
+    Nagai *product;
+    Nagai *negated;
+    uint64_t low;
+};
+
+void outsource(struct Input *input, struct NizkInput *nizk_input, struct Output *output)
+{
+    Nagai *k = nagai_init_pos(input->k);
+    output->sum = nagai_add(input->x, nagai_mul(k, nizk_input->w));
+    output->product = nagai_mul(nagai_mul(input->x, input->y), nizk_input->w);
+    output->negated = nagai_mul(input->y, nagai_init_neg(1));
+    output->low = nagai_lowbits(nagai_add(input->x, input->y));
+}
@@ -0,0 +1,40 @@
+struct Input {
+    unsigned a;
+    unsigned b;
+};
+
+struct Output {
+    unsigned x;
+    unsigned y;
+    unsigned z;
+};
+
+struct Pair {
+    unsigned first;
+    unsigned second;
+};
+
+struct Wrapper {
+    struct Pair pair;
+    unsigned flags;
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    struct Wrapper w = {{input->a, input->b}, 7};
+    // initialized by a copy of a constant global (an array of arrays)
+    unsigned table[3][2] = {{1, 2}, {3, 4}, {5, 6}};
+
+    // pointers to leading members, through casts
+    unsigned *first = (unsigned *) &w;
+    struct Pair *pair = (struct Pair *) &w;
+    unsigned *row = (unsigned *) table;
+
+    *first += 1;
+    pair->second *= 2;
+    *row = input->b;
+
+    output->x = w.pair.first + w.pair.second + w.flags;
+    output->y = *first * pair->first + pair->second;
+    output->z = table[0][0] + table[0][1] + table[2][1] + *row;
+}
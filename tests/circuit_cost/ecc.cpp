@@ -0,0 +1,52 @@
+// Scalar multiplication on Baby Jubjub, with the method selected by ECC_METHOD (see ecc-report):
+// 0: ECCPoint::Multiply, on the curve in short Weierstrass form
+// 1: EdwardsPoint::Multiply
+// 2: EdwardsPoint::Ladder
+// 3: BabyJubjubMultiplyBase (fixed base)
+#include "babyjubjub.hpp"
+#include "ecc.hpp"
+
+#ifndef ECC_METHOD
+#   define ECC_METHOD 1
+#endif
+
+struct Input {
+    // the scalar, of 254 bits
+    Nagai *k;
+    // 0, added to the coordinates of the variable base so that they are not constants
+    Nagai *zero;
+};
+
+struct Output {
+    uint64_t x;
+    uint64_t y;
+};
+
+extern "C" {
+    void outsource(struct Input *, struct Output *);
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    Field k = Field::copy_from(input->k);
+    Field zero = Field::copy_from(input->zero);
+    EdwardsCurve curve = BabyJubjub();
+    EdwardsPoint base = BabyJubjubBase(&curve);
+#if ECC_METHOD == 0
+    ECC ecc(
+        Field("7296080957279758407415468581752425029516121466805344781232734728849116493472"),
+        Field("16213513238399463127589930181672055621146936592900766180517188641980520820846"));
+    ECCPoint p = ecc.NewPoint(
+        Field("14414009007687342025526645003307639786191886886413750648631138442071909631647") + zero,
+        Field("14577268218881899420966779687690205425227431577728659819975198491127179315626") + zero);
+    ECCPoint r = p.Multiply(k);
+#elif ECC_METHOD == 1
+    EdwardsPoint r = curve.NewPoint(base.x + zero, base.y + zero).Multiply(k);
+#elif ECC_METHOD == 2
+    EdwardsPoint r = curve.NewPoint(base.x + zero, base.y + zero).Ladder(k);
+#else
+    EdwardsPoint r = BabyJubjubMultiplyBase(k, &curve);
+#endif
+    output->x = static_cast<uint64_t>(r.x);
+    output->y = static_cast<uint64_t>(r.y);
+}
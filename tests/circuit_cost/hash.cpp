@@ -0,0 +1,52 @@
+// Hash of field elements, with the function selected by HASH_METHOD (see hash-report):
+// 0: Poseidon of 2 inputs
+// 1: Poseidon of 4 inputs
+// 2: MiMCHash of 2 inputs
+// 3: root of a Merkle path of depth 20, with Poseidon
+// 4: root of a Merkle path of depth 20, with MiMCHash
+#include "hash.hpp"
+
+#ifndef HASH_METHOD
+#   define HASH_METHOD 0
+#endif
+
+#define DEPTH 20
+
+struct Input {
+    Nagai *a;
+    Nagai *b;
+    // position of the leaf in the Merkle tree
+    Nagai *index;
+};
+
+struct Output {
+    uint64_t hash;
+};
+
+extern "C" {
+    void outsource(struct Input *, struct Output *);
+};
+
+void outsource(struct Input *input, struct Output *output)
+{
+    Field a = Field::copy_from(input->a);
+    Field b = Field::copy_from(input->b);
+#if HASH_METHOD == 0
+    Field r = Poseidon(a, b);
+#elif HASH_METHOD == 1
+    Field r = Poseidon(a, b, a + b, a - b);
+#elif HASH_METHOD == 2
+    Field r = MiMCHash(a, b);
+#else
+    Field index = Field::copy_from(input->index);
+    Field siblings[DEPTH];
+    for (unsigned i = 0; i < DEPTH; ++i)
+        siblings[i] = b + Field(uint64_t(i));
+#   if HASH_METHOD == 3
+    Field r = MerkleRoot<PoseidonHasher>(a, siblings, index, DEPTH);
+#   else
+    Field r = MerkleRoot<MiMCHasher>(a, siblings, index, DEPTH);
+#   endif
+#endif
+    output->hash = static_cast<uint64_t>(r);
+}
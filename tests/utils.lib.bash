@@ -8,6 +8,14 @@ utils_ISEKAI=( "$utils_REPO_ROOT"/isekai )
 utils_BOILERPLATE_GEN=( "$utils_REPO_ROOT"/boilerplate_gen )
 utils_JUDGE=( "$utils_BACKEND_TEST_ROOT"/judge )
 utils_RNG=( "$utils_BACKEND_TEST_ROOT"/rng )
+utils_NAGAI_DIR=$utils_REPO_ROOT/nagai
+# built by nagai/CMakeLists.txt: cmake -S nagai -B nagai/build && cmake --build nagai/build
+utils_NAGAI_LIB=${NAGAI_LIB:-$utils_NAGAI_DIR/build/libnagai.a}
+# the tools of libsnarc, built as in the README: cd lib/libsnarc/build && cmake .. && make
+utils_LIBSNARC_BUILD_DIR=${LIBSNARC_BUILD:-$utils_REPO_ROOT/lib/libsnarc/build}
+utils_ARITH_OPT=( "$utils_LIBSNARC_BUILD_DIR"/arith_opt )
+utils_R1CS_CHECK=( "$utils_LIBSNARC_BUILD_DIR"/r1cs_check )
+utils_PLONK_ROWS=( "$utils_LIBSNARC_BUILD_DIR"/plonk_rows )
 
 utils_BC_FILE=$utils_TEMP_DIR/bitcode.bc
 utils_ARCI_FOR_BC_FILE=$utils_TEMP_DIR/arith_bc.arci
@@ -23,6 +31,8 @@ declare -A utils_EXTENSION_TO_NATIVE_CC=(
     [cpp]=clang++ [cxx]=clang++
 )
 utils_NATIVE_CC_ARGS=( -O0 -Wall -Wextra -fsanitize=undefined )
+# for the programs using nagai.h
+utils_NAGAI_LINK_ARGS=( "$utils_NAGAI_LIB" -lgmp -lstdc++ )
 
 utils__stress_nlines=-1
 
@@ -48,6 +58,7 @@ utils_compile_to_bc() {
     utils_trace_run \
         "${utils_CLANG[@]}" \
         -O0 -c -emit-llvm \
+        -I "$utils_NAGAI_DIR" \
         "$1" \
         -o "$utils_BC_FILE" || return $?
 }
@@ -92,9 +103,18 @@ utils_compile_to_native() {
     fi
     local temp_src=$utils_TEMP_DIR/temp.$ext
     local rc
+    # nagai programs are linked with the native runtime
+    local -a link_args=()
+    if grep -q 'nagai\.h\|field\.hpp\|ecc\.hpp' -- "$1"; then
+        if [[ ! -e "$utils_NAGAI_LIB" ]]; then
+            printf >&2 'Cannot find "%s"; build it with nagai/CMakeLists.txt or set NAGAI_LIB.\n' "$utils_NAGAI_LIB"
+            return 1
+        fi
+        link_args=( "${utils_NAGAI_LINK_ARGS[@]}" )
+    fi
     cat -- "$1" > "$temp_src" && \
-        utils_trace_run "${utils_BOILERPLATE_GEN[@]}" "$1" >> "$temp_src" && \
-        utils_trace_run $native_cc "${utils_NATIVE_CC_ARGS[@]}" "$temp_src" -o "$utils_NATIVE_BIN"
+        utils_trace_run "${utils_BOILERPLATE_GEN[@]}" -I "$utils_NAGAI_DIR" "$1" >> "$temp_src" && \
+        utils_trace_run $native_cc "${utils_NATIVE_CC_ARGS[@]}" -I "$utils_NAGAI_DIR" "$temp_src" -o "$utils_NATIVE_BIN" "${link_args[@]}"
     rc=$?
     rm -f -- "$temp_src"
     return $rc